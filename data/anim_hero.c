@@ -0,0 +1,183 @@
+// Auto-generated by convert_sprites.py — DO NOT EDIT
+#include "anim_hero.h"
+
+// 2 stored rows (SW, NW) x 6 cells, trimmed to 101 tiles, 3232 bytes
+const unsigned int anim_heroTiles[808] __attribute__((aligned(4))) = {
+    0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,
+    0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,
+    0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880300,0xC3880300,0x03880300,
+    0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09305533,0x09305533,0x09305530,
+    0x33880311,0x33880009,0x33880000,0x05500000,0x05500000,0x05500000,0x05500000,0x055B0000,
+    0x0032553C,0x00205533,0x00105533,0x00010550,0x00000550,0x00000550,0x00000550,0x0000B550,
+    0x0BB00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000BB0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,
+    0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,
+    0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,
+    0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220000,0x00000300,0x33880300,0xC3880300,
+    0x00010EE0,0x00012002,0x00012221,0x00022222,0x0CC02222,0x09300000,0x09305533,0x09305533,
+    0x03880311,0x33880009,0x33880000,0x33880000,0x00550000,0x00550000,0x00550000,0x00550000,
+    0x09305530,0x0020553C,0x02005533,0x01005533,0x00105500,0x00005500,0x00005500,0x00005500,
+    0x0055B000,0x00BB0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x000B5500,0x0000BB00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,
+    0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,
+    0x20021000,0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880300,
+    0x00012002,0x00010EE0,0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09305533,
+    0xC3880300,0x03880300,0x33880311,0x33880009,0x33880000,0x00055000,0x00055000,0x00055000,
+    0x09305533,0x09305530,0x0230553C,0x20005533,0x10005533,0x01055000,0x00055000,0x00055000,
+    0x00055000,0x00055B00,0x000BB000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00055000,0x00B55000,0x000BB000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x90000000,0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,
+    0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,
+    0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880000,0xC3880300,
+    0x00010EE0,0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09005533,0x09305533,
+    0x03880300,0x33880300,0x33880311,0x33880009,0x00550000,0x00550000,0x00550000,0x00550000,
+    0x09305530,0x0020553C,0x02305533,0x01005533,0x00105500,0x00005500,0x00005500,0x00005500,
+    0x0055B000,0x00BB0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x000B5500,0x0000BB00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x90000000,0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,
+    0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,
+    0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880300,0xC3880300,0x03880300,
+    0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09305533,0x09305533,0x09305530,
+    0x33880311,0x33880009,0x33880000,0x05500000,0x05500000,0x05500000,0x05500000,0x055B0000,
+    0x0032553C,0x00205533,0x00105533,0x00010550,0x00000550,0x00000550,0x00000550,0x0000B550,
+    0x0BB00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000BB0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,
+    0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,0x20021000,
+    0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,0x00012002,
+    0x12221000,0x22222000,0x22220000,0x00000300,0x33880300,0xC3880300,0x03880311,0x33880009,
+    0x00012221,0x00022222,0x0CC02222,0x09300000,0x09305533,0x09305533,0x09305530,0x0020553C,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,0x90000000,0x00000000,
+    0x33880000,0x33880000,0x00550000,0x00550000,0x00550000,0x00550000,0x0055B000,0x00BB0000,
+    0x02005533,0x01005533,0x00105500,0x00005500,0x00005500,0x00005500,0x000B5500,0x0000BB00,
+    0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,
+    0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,
+    0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330600,0x76330600,0xC6330600,
+    0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00604466,0x00604466,0x0060446C,
+    0x66330677,0x66330000,0x66330000,0x04400000,0x04400000,0x04400000,0x04400000,0x044A0000,
+    0x00614467,0x00104466,0x00704466,0x00070440,0x00000440,0x00000440,0x00000440,0x0000A440,
+    0x0AA00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000AA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,
+    0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,
+    0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110000,0x00000600,0x66330600,0x76330600,
+    0x00070DD0,0x00071001,0x00071117,0x00011111,0x07701111,0x00600000,0x00604466,0x00604466,
+    0xC6330677,0x66330000,0x66330000,0x66330000,0x00440000,0x00440000,0x00440000,0x00440000,
+    0x0060446C,0x00104467,0x01004466,0x07004466,0x00704400,0x00004400,0x00004400,0x00004400,
+    0x0044A000,0x00AA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x000A4400,0x0000AA00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,
+    0x10017000,0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330600,
+    0x00071001,0x00070DD0,0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00604466,
+    0x76330600,0xC6330600,0x66330677,0x66330000,0x66330000,0x00044000,0x00044000,0x00044000,
+    0x00604466,0x0060446C,0x01604467,0x10004466,0x70004466,0x07044000,0x00044000,0x00044000,
+    0x00044000,0x00044A00,0x000AA000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00044000,0x00A44000,0x000AA000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,
+    0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,
+    0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330000,0x76330600,
+    0x00070DD0,0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00004466,0x00604466,
+    0xC6330600,0x66330600,0x66330677,0x66330000,0x00440000,0x00440000,0x00440000,0x00440000,
+    0x0060446C,0x00104467,0x01604466,0x07004466,0x00704400,0x00004400,0x00004400,0x00004400,
+    0x0044A000,0x00AA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x000A4400,0x0000AA00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,
+    0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,
+    0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330600,0x76330600,0xC6330600,
+    0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00604466,0x00604466,0x0060446C,
+    0x66330677,0x66330000,0x66330000,0x04400000,0x04400000,0x04400000,0x04400000,0x044A0000,
+    0x00614467,0x00104466,0x00704466,0x00070440,0x00000440,0x00000440,0x00000440,0x0000A440,
+    0x0AA00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000AA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,0x10017000,
+    0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,0x00071001,
+    0x71117000,0x11111000,0x11110000,0x00000600,0x66330600,0x76330600,0xC6330677,0x66330000,
+    0x00071117,0x00011111,0x07701111,0x00600000,0x00604466,0x00604466,0x0060446C,0x00104467,
+    0x66330000,0x66330000,0x00440000,0x00440000,0x00440000,0x00440000,0x0044A000,0x00AA0000,
+    0x01004466,0x07004466,0x00704400,0x00004400,0x00004400,0x00004400,0x000A4400,0x0000AA00,
+};
+
+const unsigned short anim_heroPal[16] __attribute__((aligned(4))) = {
+    0x0000,0x2A36,0x3EDB,0x59CA,0x2C40,0x40E5,0x4505,0x11B2,0x6E8F,0x6BBD,0x04CA,0x196F,0x1E99,0x6A82,0x7F27,0x0000,
+};
+
+static const MetaPiece anim_hero_pieces[] = {
+    // cell 0: 10 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    { 0, 24, 8, 8, ATTR0_TALL, ATTR1_SIZE_8 },
+    // cell 1: 10 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    { 0, 24, 8, 8, ATTR0_TALL, ATTR1_SIZE_8 },
+    // cell 2: 9 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    { 0, 24, 16, 8, ATTR0_SQUARE, ATTR1_SIZE_8 },
+    // cell 3: 9 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    { 0, 24, 16, 8, ATTR0_SQUARE, ATTR1_SIZE_8 },
+    // cell 4: 10 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    { 0, 24, 8, 8, ATTR0_TALL, ATTR1_SIZE_8 },
+    // cell 5: 7 tiles
+    { 8, 8, 0, 0, ATTR0_SQUARE, ATTR1_SIZE_16 },
+    { 0, 24, 8, 4, ATTR0_SQUARE, ATTR1_SIZE_8 },
+    { 8, 8, 16, 5, ATTR0_WIDE, ATTR1_SIZE_8 },
+    // cell 6: 8 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    // cell 7: 8 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    // cell 8: 8 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    // cell 9: 8 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    // cell 10: 8 tiles
+    { 8, 8, 0, 0, ATTR0_TALL, ATTR1_SIZE_32 },
+    // cell 11: 6 tiles
+    { 8, 8, 0, 0, ATTR0_SQUARE, ATTR1_SIZE_16 },
+    { 8, 8, 16, 4, ATTR0_WIDE, ATTR1_SIZE_8 },
+};
+
+static const MetaCell anim_hero_cells[] = {
+    { 0, 10, 0, 2, 0 },
+    { 80, 10, 2, 2, 0 },
+    { 160, 9, 4, 2, 0 },
+    { 232, 9, 6, 2, 0 },
+    { 304, 10, 8, 2, 0 },
+    { 384, 7, 10, 3, 0 },
+    { 440, 8, 13, 1, 0 },
+    { 504, 8, 14, 1, 0 },
+    { 568, 8, 15, 1, 0 },
+    { 632, 8, 16, 1, 0 },
+    { 696, 8, 17, 1, 0 },
+    { 760, 6, 18, 2, 0 },
+};
+
+static const AnimFrame anim_hero_frames[] = {
+    // idle
+    { 0, 1 },
+    // walk
+    { 0, 4 }, { 1, 4 }, { 2, 4 }, { 3, 4 }, { 4, 4 }, { 5, 4 },
+    // patrol
+    { 0, 8 }, { 1, 8 }, { 2, 8 }, { 3, 8 }, { 4, 8 }, { 5, 8 },
+};
+
+static const AnimSeq anim_hero_seqs[] = {
+    { 0, 1, ANIM_HOLD, 0 },  // idle
+    { 1, 6, 0, 0 },  // walk
+    { 7, 6, 0, 0 },  // patrol
+};
+
+const AnimSet anim_hero = {
+    anim_heroTiles, anim_heroPal, anim_hero_cells, anim_hero_pieces, anim_hero_frames, anim_hero_seqs,
+    3, 6,
+    { 0, 1, 1, 0 },  // SE NE NW SW
+    0x3,
+};
@@ -0,0 +1,16 @@
+// Auto-generated by convert_sprites.py — DO NOT EDIT
+#ifndef ANIM_HERO_H
+#define ANIM_HERO_H
+
+#include "anim.h"
+
+#define HERO_ANIM_IDLE 0
+#define HERO_ANIM_WALK 1
+#define HERO_ANIM_PATROL 2
+
+#define anim_heroTilesLen 3232
+extern const unsigned int anim_heroTiles[808];
+extern const unsigned short anim_heroPal[16];
+extern const AnimSet anim_hero;
+
+#endif // ANIM_HERO_H
@@ -0,0 +1,96 @@
+// Auto-generated by build_archive.py — DO NOT EDIT
+#include "archive.h"
+
+// 11 assets, 1548 bytes (3088 unpacked)
+//    0 fx_tiles       lz77    468 /  2208 bytes at 184
+//    1 fx_pal         raw      32 /    32 bytes at 652
+//    2 hero_pal       raw      32 /    32 bytes at 684
+//    3 pal_meadow     raw     102 /   102 bytes at 716
+//    4 pal_river      raw     102 /   102 bytes at 820
+//    5 pal_hills      raw     102 /   102 bytes at 924
+//    6 pal_fields     raw     102 /   102 bytes at 1028
+//    7 pal_lake       raw     102 /   102 bytes at 1132
+//    8 pal_highlands  raw     102 /   102 bytes at 1236
+//    9 pal_fortress   raw     102 /   102 bytes at 1340
+//   10 pal_ruins      raw     102 /   102 bytes at 1444
+const unsigned int assetArchive[387] __attribute__((aligned(4))) = {
+    0x31435241,0x0000000B,0x00010000,0x000000B8,0x000001D4,0x000008A0,0x00000001,0x0000028C,
+    0x00000020,0x00000020,0x00000002,0x000002AC,0x00000020,0x00000020,0x00000003,0x000002CC,
+    0x00000066,0x00000066,0x00000004,0x00000334,0x00000066,0x00000066,0x00000005,0x0000039C,
+    0x00000066,0x00000066,0x00000006,0x00000404,0x00000066,0x00000066,0x00000007,0x0000046C,
+    0x00000066,0x00000066,0x00000008,0x000004D4,0x00000066,0x00000066,0x00000009,0x0000053C,
+    0x00000066,0x00000066,0x0000000A,0x000005A4,0x00000066,0x00000066,0x0008A010,0xF000003C,
+    0xF001F001,0x0001F001,0x00001511,0x21031010,0x00310A00,0x0032050A,0x90332111,0x03002220,
+    0x1310109F,0x10210001,0xF043F003,0x8001F001,0x133275C0,0x11331110,0x13211011,0x010A0011,
+    0x1D113320,0x10132001,0x30600086,0x09300094,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,
+    0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xA201F001,0xF0F2110E,
+    0xE901F001,0x01F001F0,0x72100110,0x52211167,0x0600BA63,0x11060013,0x010610FF,0xBF000600,
+    0x12000600,0x11011006,0xF003F2FF,0xEB01F001,0xC3026D10,0x02005800,0x58920058,0x42FF1E50,
+    0xF05FF0C7,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,
+    0xF001F0FF,0xF001F001,0x6201F001,0x30F74157,0x00040713,0x11144000,0x51086085,0x01F0F7F7,
+    0x57E201F0,0x0100F001,0xF20300F0,0x5742FF57,0x01F0F7F1,0x01F001F0,0x01F07B40,0xF0FF0140,
+    0xF001F05F,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01A001F0,
+    0x12F0406F,0x0104FE31,0xF00D5235,0xFB01F001,0xC3C65872,0x58700722,0x5601CC04,0xFAC356BF,
+    0x01F06D72,0x01F001F0,0x00336E00,0x00DF136E,0x3203006E,0x67B46304,0xC3F49440,0xF0EC01F0,
+    0xF001F001,0x49412001,0x34420300,0x5002443B,0xD117200B,0x0611346D,0x000042F0,0x50005555,
+    0x11055666,0x30666650,0x05566503,0xA0811310,0x00055023,0x30566500,0x0B10D003,0x007001D0,
+    0x00072703,0x00875000,0x16708003,0x00230000,0x333B6FFF,0x321233DF,0x7ECF4AF9,0x00006565,
+    0x00000000,0x00000000,0x00000000,0x2A360000,0x59CA3EDB,0x40E52C40,0x11B24505,0x6BBD6E8F,
+    0x196F04CA,0x6A821E99,0x00007F27,0x00231442,0x15E722AC,0x2AEF1A49,0x39AD1628,0x2D4A358C,
+    0x46105273,0x110C21D4,0x152E1970,0x41042A37,0x59C84D66,0x6A8E664C,0x195872F2,0x10D10CAE,
+    0x15361515,0x0D6511A6,0x194E21B2,0x29F410EA,0x292920E7,0x0CC92508,0x0CEA08A8,0x112D154F,
+    0x3E3210CC,0x10ED1951,0x1D73150F,0x21B525D6,0x0000088D,0x00231442,0x15E722AB,0x2EEE1A48,
+    0x3DAC1628,0x3149398B,0x4A0F5672,0x110B21D3,0x152D196F,0x45042E36,0x5DC85166,0x728D6A4B,
+    0x19577AF1,0x10D00CAD,0x15351514,0x0D6511A6,0x194D21B1,0x2DF310E9,0x2D2820E7,0x0CC82908,
+    0x0CE908A8,0x112C154E,0x423110CB,0x10EC1950,0x1D72150E,0x21B429D5,0x0000088C,0x00231442,
+    0x15E722AC,0x26F01A49,0x35AE1628,0x294A318C,0x42114E74,0x110C21D5,0x152F1971,0x3D042638,
+    0x55C84966,0x628F624C,0x19596AF3,0x10D20CAF,0x15371516,0x0D6511A6,0x194F21B3,0x25F510EA,
+    0x252920E7,0x0CC92108,0x0CEA08A8,0x112E1550,0x3A3310CC,0x10EE1952,0x1D741510,0x21B621D7,
+    0x0000088E,0x00231042,0x11E81ECD,0x2710166A,0x31AE1249,0x294B2D8D,0x3E114A95,0x110D1DD6,
+    0x112F1571,0x39042659,0x4DC94566,0x5EAF5A6D,0x155A6713,0x10D20CAF,0x11381117,0x0D6511A6,
+    0x154F1DB3,0x25F610EB,0x252A1CE8,0x0CCA2109,0x0CEB08A9,0x112E1150,0x365310CD,0x10EE1552,
+    0x19751110,0x1DB721D8,0x0000088E,0x00231842,0x19E6268B,0x2ECD1E28,0x41AB1A07,0x31493D8B,
+    0x4E0E5A51,0x110B25D2,0x192C1D6E,0x49042E14,0x65C75565,0x766C722B,0x1D557ED0,0x10CF0CAC,
+    0x19331912,0x0D6411A5,0x1D4C25B0,0x2DF210E9,0x2D2824E6,0x0CC82907,0x0CE908A7,0x112B194D,
+    0x461010CB,0x10EB1D4F,0x2171190D,0x25B229D3,0x0000088B,0x00231442,0x15E722AC,0x2AEE1A49,
+    0x3DAC1628,0x2D4A398C,0x4A0F5672,0x110C21D3,0x152D196F,0x45042A36,0x5DC85166,0x6E8D6A4C,
+    0x195776F1,0x10D00CAD,0x15351514,0x0D6511A6,0x194D21B1,0x29F310EA,0x292920E7,0x0CC92508,
+    0x0CEA08A8,0x112C154E,0x423110CC,0x10EC1950,0x1D72150E,0x21B425D5,0x0000088C,0x00231442,
+    0x15A61E4A,0x266D19E8,0x356B15C7,0x2908314A,0x41AD4A10,0x10EA1D91,0x150C192D,0x3CE325D3,
+    0x51874525,0x622C5DEA,0x19146A6F,0x10AE0C8C,0x151214F2,0x0D241165,0x190C1D6F,0x25B110C8,
+    0x25081CC6,0x0CA820E7,0x0CC80887,0x110B150D,0x39CF10AA,0x10CB190E,0x193014ED,0x1D722192,
+    0x0000086B,0x00231042,0x11C71E6C,0x22AF1629,0x318D1208,0x252A2D6C,0x39F04633,0x0CEC1DB4,
+    0x110E1550,0x34E42217,0x49A84146,0x5A4E562C,0x153862B2,0x0CD10CAE,0x111610F5,0x0D450D86,
+    0x152E1D92,0x21D40CCA,0x21091CC7,0x0CC920E8,0x0CCA08A8,0x0D0D112F,0x36120CCC,0x0CCD1531,
+    0x195310EF,0x1D9521B6,0x0000088D,
+};
+
+const char *const assetNames[ASSET_COUNT] = {
+    "fx_tiles",
+    "fx_pal",
+    "hero_pal",
+    "pal_meadow",
+    "pal_river",
+    "pal_hills",
+    "pal_fields",
+    "pal_lake",
+    "pal_highlands",
+    "pal_fortress",
+    "pal_ruins",
+};
+
+// Zone z loads assetZoneLoads[assetZoneStart[z] .. assetZoneStart[z + 1])
+const AssetLoad assetZoneLoads[ASSET_ZONE_LOADS] = {
+    { ASSET_PAL_MEADOW, ASSET_DST_BG_PAL, 0 },
+    { ASSET_PAL_RIVER, ASSET_DST_BG_PAL, 0 },
+    { ASSET_PAL_HILLS, ASSET_DST_BG_PAL, 0 },
+    { ASSET_PAL_FIELDS, ASSET_DST_BG_PAL, 0 },
+    { ASSET_PAL_LAKE, ASSET_DST_BG_PAL, 0 },
+    { ASSET_PAL_HIGHLANDS, ASSET_DST_BG_PAL, 0 },
+    { ASSET_PAL_FORTRESS, ASSET_DST_BG_PAL, 0 },
+    { ASSET_PAL_RUINS, ASSET_DST_BG_PAL, 0 },
+};
+
+const unsigned char assetZoneStart[NUM_ZONES + 1] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+};
@@ -0,0 +1,27 @@
+// Auto-generated by build_archive.py — DO NOT EDIT
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include "asset.h"
+#include "trigger.h"
+
+#define ASSET_FX_TILES 0
+#define ASSET_FX_PAL 1
+#define ASSET_HERO_PAL 2
+#define ASSET_PAL_MEADOW 3
+#define ASSET_PAL_RIVER 4
+#define ASSET_PAL_HILLS 5
+#define ASSET_PAL_FIELDS 6
+#define ASSET_PAL_LAKE 7
+#define ASSET_PAL_HIGHLANDS 8
+#define ASSET_PAL_FORTRESS 9
+#define ASSET_PAL_RUINS 10
+#define ASSET_COUNT 11
+#define ASSET_ZONE_LOADS 8
+
+extern const unsigned int assetArchive[387];
+extern const char *const assetNames[ASSET_COUNT];
+extern const AssetLoad assetZoneLoads[ASSET_ZONE_LOADS];
+extern const unsigned char assetZoneStart[NUM_ZONES + 1];
+
+#endif // ARCHIVE_H
@@ -0,0 +1,79 @@
+// Auto-generated by convert_sprites.py — DO NOT EDIT
+#include "fx.h"
+
+// slash 4x16, spark 2x1, dust 2x1, drop 1x1 tiles, 2208 bytes
+const unsigned int fxTiles[552] __attribute__((aligned(4))) = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x11000000,0x11100000,0x21100000,0x31110000,0x32111000,0x33211100,
+    0x00000000,0x00000000,0x00000000,0x00000022,0x00000033,0x00000113,0x00000111,0x00000011,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x13321100,0x11331110,0x11132111,0x01133211,0x01113320,0x00111320,0x00011000,0x00000000,
+    0x00000011,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00110000,0x22111000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x10000000,0x11000000,0x11100000,0x21110000,0x32111000,
+    0x33211100,0x13321110,0x11332111,0x11133211,0x01113321,0x00111332,0x00011133,0x00001113,
+    0x00000000,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x33211100,0x13321100,0x11332000,0x11132000,0x01100000,0x00000000,0x00000000,0x00000000,
+    0x00000111,0x00000011,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00110000,0x22111000,0x33211100,0x13321110,
+    0x00000000,0x00040000,0x00144000,0x04010000,0x14400000,0x01000000,0x00000000,0x00000001,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x10000000,0x11000000,0x11100000,0x21110000,0x32110000,0x33200000,0x13200000,
+    0x11332111,0x11133211,0x01113321,0x00111332,0x00011133,0x00001113,0x00000111,0x00000011,
+    0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x40000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00040000,0x00144000,0x00010004,0x00000014,0x00000401,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x11000000,0x11000000,0x11100000,0x21100000,0x31110000,0x32110000,
+    0x00000000,0x04000000,0x14400000,0x01000022,0x00000033,0x00000113,0x00000113,0x00000111,
+    0x00001440,0x00000100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x33111000,0x13211000,0x13311100,0x11321100,0x11332000,0x11132000,0x01100000,0x00000000,
+    0x00000011,0x00000011,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00002000,0x00004000,0x00004000,0x02443442,0x00004000,0x00004000,0x00002000,0x00000000,
+    0x00000000,0x00000000,0x00004000,0x00043400,0x00004000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00555500,0x05566650,0x05666650,0x05666650,0x05566550,0x00555500,0x00000000,
+    0x00000000,0x00000000,0x00055000,0x00566500,0x00566500,0x00055000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00007000,0x00072700,0x00078700,0x00008000,0x00000000,0x00000000,
+};
+
+const unsigned short fxPal[16] __attribute__((aligned(4))) = {
+    0x0000,0x0023,0x6FFF,0x333B,0x33DF,0x3212,0x4AF9,0x7ECF,0x6565,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+};
@@ -0,0 +1,18 @@
+// Auto-generated by convert_sprites.py — DO NOT EDIT
+#ifndef FX_H
+#define FX_H
+
+#define FX_TILE_SLASH 0
+#define FX_SLASH_FRAMES 4
+#define FX_TILE_SPARK 64
+#define FX_SPARK_FRAMES 2
+#define FX_TILE_DUST 66
+#define FX_DUST_FRAMES 2
+#define FX_TILE_DROP 68
+#define FX_DROP_FRAMES 1
+
+#define fxTilesLen 2208
+extern const unsigned int fxTiles[552];
+extern const unsigned short fxPal[16];
+
+#endif // FX_H
@@ -1,458 +0,0 @@
-
-//{{BLOCK(hero_walk)
-
-//======================================================================
-//
-//	hero_walk, 192x128@4, 
-//	+ palette 16 entries, not compressed
-//	+ 384 tiles Metatiled by 4x4 not compressed
-//	Total size: 32 + 12288 = 12320
-//
-//	Time-stamp: 2026-02-15, 15:33:36
-//	Exported by Cearn's GBA Image Transmogrifier, v0.9.2
-//	( http://www.coranac.com/projects/#grit )
-//
-//======================================================================
-
-const unsigned int hero_walkTiles[3072] __attribute__((aligned(4))) __attribute__((visibility("hidden")))=
-{
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,
-	0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,
-	0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880300,0xC3880300,0x03880300,
-	0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09305533,0x09305533,0x09305530,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x33880311,0x33880009,0x33880000,0x05500000,0x05500000,0x05500000,0x05500000,0x055B0000,
-	0x0032553C,0x00205533,0x00105533,0x00010550,0x00000550,0x00000550,0x00000550,0x0000B550,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0BB00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000BB0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,
-	0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,
-	0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220000,0x00000300,0x33880300,0xC3880300,
-	0x00010EE0,0x00012002,0x00012221,0x00022222,0x0CC02222,0x09300000,0x09305533,0x09305533,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x03880311,0x33880009,0x33880000,0x33880000,0x00550000,0x00550000,0x00550000,0x00550000,
-	0x09305530,0x0020553C,0x02005533,0x01005533,0x00105500,0x00005500,0x00005500,0x00005500,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0055B000,0x00BB0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000B5500,0x0000BB00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x20021000,0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880300,
-	0x00012002,0x00010EE0,0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09305533,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x90000000,0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0xC3880300,0x03880300,0x33880311,0x33880009,0x33880000,0x00055000,0x00055000,0x00055000,
-	0x09305533,0x09305530,0x0230553C,0x20005533,0x10005533,0x01055000,0x00055000,0x00055000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00055000,0x00055B00,0x000BB000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00055000,0x00B55000,0x000BB000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,
-	0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880000,0xC3880300,
-	0x00010EE0,0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09005533,0x09305533,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x90000000,0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x03880300,0x33880300,0x33880311,0x33880009,0x00550000,0x00550000,0x00550000,0x00550000,
-	0x09305530,0x0020553C,0x02305533,0x01005533,0x00105500,0x00005500,0x00005500,0x00005500,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0055B000,0x00BB0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000B5500,0x0000BB00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,
-	0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,
-	0x20021000,0x12221000,0x22222000,0x22220000,0x00000000,0x33880300,0xC3880300,0x03880300,
-	0x00012002,0x00012221,0x00022222,0x0CC02222,0x09000000,0x09305533,0x09305533,0x09305530,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x90000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x33880311,0x33880009,0x33880000,0x05500000,0x05500000,0x05500000,0x05500000,0x055B0000,
-	0x0032553C,0x00205533,0x00105533,0x00010550,0x00000550,0x00000550,0x00000550,0x0000B550,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0BB00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000BB0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,0x20021000,
-	0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,0x00012002,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90000000,0x90000000,0x00000000,
-	0x12221000,0x22222000,0x22220000,0x00000300,0x33880300,0xC3880300,0x03880311,0x33880009,
-	0x00012221,0x00022222,0x0CC02222,0x09300000,0x09305533,0x09305533,0x09305530,0x0020553C,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x33880000,0x33880000,0x00550000,0x00550000,0x00550000,0x00550000,0x0055B000,0x00BB0000,
-	0x02005533,0x01005533,0x00105500,0x00005500,0x00005500,0x00005500,0x000B5500,0x0000BB00,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,
-	0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x20021000,0x12221000,0x22222000,0x22220CC0,0x00000090,0x33550390,0x33550390,0x03550390,
-	0x00012002,0x00012221,0x00022222,0x00002222,0x00000000,0x00308833,0x0030883C,0x00308830,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000009,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0xC3552300,0x33550200,0x33550100,0x05501000,0x05500000,0x05500000,0x05500000,0x055B0000,
-	0x11308833,0x90008833,0x00008833,0x00000550,0x00000550,0x00000550,0x00000550,0x0000B550,
-	0x00000009,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0BB00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000BB0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,
-	0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220CC0,0x00000390,0x33550390,0x33550390,
-	0x00010EE0,0x00012002,0x00012221,0x00022222,0x00002222,0x00300000,0x00308833,0x0030883C,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000009,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x03550390,0xC3550200,0x33550020,0x33550010,0x00550100,0x00550000,0x00550000,0x00550000,
-	0x11308830,0x90008833,0x00008833,0x00008833,0x00005500,0x00005500,0x00005500,0x00005500,
-	0x00000009,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0055B000,0x00BB0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000B5500,0x0000BB00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x20021000,0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220CC0,0x00000090,0x33550390,
-	0x00012002,0x00010EE0,0x00012002,0x00012221,0x00022222,0x00002222,0x00000000,0x00308833,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x33550390,0x03550390,0xC3550320,0x33550002,0x33550001,0x00055010,0x00055000,0x00055000,
-	0x0030883C,0x00308830,0x11308833,0x90008833,0x00008833,0x00055000,0x00055000,0x00055000,
-	0x00000000,0x00000009,0x00000009,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00055000,0x00055B00,0x000BB000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00055000,0x00B55000,0x000BB000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,
-	0x00000000,0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0EE01000,0x20021000,0x12221000,0x22222000,0x22220CC0,0x00000090,0x33550090,0x33550390,
-	0x00010EE0,0x00012002,0x00012221,0x00022222,0x00002222,0x00000000,0x00008833,0x0030883C,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x03550390,0xC3550200,0x33550320,0x33550010,0x00550100,0x00550000,0x00550000,0x00550000,
-	0x00308830,0x00308833,0x11308833,0x90008833,0x00005500,0x00005500,0x00005500,0x00005500,
-	0x00000000,0x00000009,0x00000009,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0055B000,0x00BB0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000B5500,0x0000BB00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,
-	0x00000000,0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x20021000,0x12221000,0x22222000,0x22220CC0,0x00000090,0x33550390,0x33550390,0x03550390,
-	0x00012002,0x00012221,0x00022222,0x00002222,0x00000000,0x00308833,0x0030883C,0x00308830,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000009,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0xC3552300,0x33550200,0x33550100,0x05501000,0x05500000,0x05500000,0x05500000,0x055B0000,
-	0x11308833,0x90008833,0x00008833,0x00000550,0x00000550,0x00000550,0x00000550,0x0000B550,
-	0x00000009,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0BB00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000BB0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00020000,0x00000000,0x22220000,0x22221000,0x20021000,0x0EE01000,0x20021000,
-	0x00000000,0x00002000,0x00000000,0x00002222,0x00012222,0x00012002,0x00010EE0,0x00012002,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x12221000,0x22222000,0x22220CC0,0x00000390,0x33550390,0x33550390,0x03550390,0xC3550200,
-	0x00012221,0x00022222,0x00002222,0x00300000,0x00308833,0x0030883C,0x11308830,0x90008833,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000009,0x00000009,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x33550020,0x33550010,0x00550100,0x00550000,0x00550000,0x00550000,0x0055B000,0x00BB0000,
-	0x00008833,0x00008833,0x00005500,0x00005500,0x00005500,0x00005500,0x000B5500,0x0000BB00,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,
-	0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330600,0x76330600,0xC6330600,
-	0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00604466,0x00604466,0x0060446C,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x66330677,0x66330000,0x66330000,0x04400000,0x04400000,0x04400000,0x04400000,0x044A0000,
-	0x00614467,0x00104466,0x00704466,0x00070440,0x00000440,0x00000440,0x00000440,0x0000A440,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0AA00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000AA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,
-	0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110000,0x00000600,0x66330600,0x76330600,
-	0x00070DD0,0x00071001,0x00071117,0x00011111,0x07701111,0x00600000,0x00604466,0x00604466,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0xC6330677,0x66330000,0x66330000,0x66330000,0x00440000,0x00440000,0x00440000,0x00440000,
-	0x0060446C,0x00104467,0x01004466,0x07004466,0x00704400,0x00004400,0x00004400,0x00004400,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0044A000,0x00AA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000A4400,0x0000AA00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x10017000,0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330600,
-	0x00071001,0x00070DD0,0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00604466,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x76330600,0xC6330600,0x66330677,0x66330000,0x66330000,0x00044000,0x00044000,0x00044000,
-	0x00604466,0x0060446C,0x01604467,0x10004466,0x70004466,0x07044000,0x00044000,0x00044000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00044000,0x00044A00,0x000AA000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00044000,0x00A44000,0x000AA000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,
-	0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330000,0x76330600,
-	0x00070DD0,0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00004466,0x00604466,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0xC6330600,0x66330600,0x66330677,0x66330000,0x00440000,0x00440000,0x00440000,0x00440000,
-	0x0060446C,0x00104467,0x01604466,0x07004466,0x00704400,0x00004400,0x00004400,0x00004400,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0044A000,0x00AA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000A4400,0x0000AA00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,
-	0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x10017000,0x71117000,0x11111000,0x11110000,0x00000000,0x66330600,0x76330600,0xC6330600,
-	0x00071001,0x00071117,0x00011111,0x07701111,0x00000000,0x00604466,0x00604466,0x0060446C,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x66330677,0x66330000,0x66330000,0x04400000,0x04400000,0x04400000,0x04400000,0x044A0000,
-	0x00614467,0x00104466,0x00704466,0x00070440,0x00000440,0x00000440,0x00000440,0x0000A440,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0AA00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000AA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,0x10017000,
-	0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,0x00071001,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x71117000,0x11111000,0x11110000,0x00000600,0x66330600,0x76330600,0xC6330677,0x66330000,
-	0x00071117,0x00011111,0x07701111,0x00600000,0x00604466,0x00604466,0x0060446C,0x00104467,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x66330000,0x66330000,0x00440000,0x00440000,0x00440000,0x00440000,0x0044A000,0x00AA0000,
-	0x01004466,0x07004466,0x00704400,0x00004400,0x00004400,0x00004400,0x000A4400,0x0000AA00,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,
-	0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x10017000,0x71117000,0x11111000,0x11110770,0x00000000,0x66440600,0x66440600,0xC6440600,
-	0x00071001,0x00071117,0x00011111,0x00001111,0x00000000,0x00603366,0x00603367,0x0060336C,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x76441600,0x66440100,0x66440700,0x04407000,0x04400000,0x04400000,0x04400000,0x044A0000,
-	0x77603366,0x00003366,0x00003366,0x00000440,0x00000440,0x00000440,0x00000440,0x0000A440,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0AA00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000AA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,
-	0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110770,0x00000600,0x66440600,0x66440600,
-	0x00070DD0,0x00071001,0x00071117,0x00011111,0x00001111,0x00600000,0x00603366,0x00603367,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0xC6440600,0x76440100,0x66440010,0x66440070,0x00440700,0x00440000,0x00440000,0x00440000,
-	0x7760336C,0x00003366,0x00003366,0x00003366,0x00004400,0x00004400,0x00004400,0x00004400,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0044A000,0x00AA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000A4400,0x0000AA00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x10017000,0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110770,0x00000000,0x66440600,
-	0x00071001,0x00070DD0,0x00071001,0x00071117,0x00011111,0x00001111,0x00000000,0x00603366,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x66440600,0xC6440600,0x76440610,0x66440001,0x66440007,0x00044070,0x00044000,0x00044000,
-	0x00603367,0x0060336C,0x77603366,0x00003366,0x00003366,0x00044000,0x00044000,0x00044000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00044000,0x00044A00,0x000AA000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00044000,0x00A44000,0x000AA000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,
-	0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0DD07000,0x10017000,0x71117000,0x11111000,0x11110770,0x00000000,0x66440000,0x66440600,
-	0x00070DD0,0x00071001,0x00071117,0x00011111,0x00001111,0x00000000,0x00003366,0x00603367,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0xC6440600,0x76440100,0x66440610,0x66440070,0x00440700,0x00440000,0x00440000,0x00440000,
-	0x0060336C,0x00603366,0x77603366,0x00003366,0x00004400,0x00004400,0x00004400,0x00004400,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0044A000,0x00AA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x000A4400,0x0000AA00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,
-	0x00000000,0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x10017000,0x71117000,0x11111000,0x11110770,0x00000000,0x66440600,0x66440600,0xC6440600,
-	0x00071001,0x00071117,0x00011111,0x00001111,0x00000000,0x00603366,0x00603367,0x0060336C,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x76441600,0x66440100,0x66440700,0x04407000,0x04400000,0x04400000,0x04400000,0x044A0000,
-	0x77603366,0x00003366,0x00003366,0x00000440,0x00000440,0x00000440,0x00000440,0x0000A440,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x0AA00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000AA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00010000,0x00000000,0x11110000,0x11117000,0x10017000,0x0DD07000,0x10017000,
-	0x00000000,0x00001000,0x00000000,0x00001111,0x00071111,0x00071001,0x00070DD0,0x00071001,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x71117000,0x11111000,0x11110770,0x00000600,0x66440600,0x66440600,0xC6440600,0x76440100,
-	0x00071117,0x00011111,0x00001111,0x00600000,0x00603366,0x00603367,0x7760336C,0x00003366,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x66440010,0x66440070,0x00440700,0x00440000,0x00440000,0x00440000,0x0044A000,0x00AA0000,
-	0x00003366,0x00003366,0x00004400,0x00004400,0x00004400,0x00004400,0x000A4400,0x0000AA00,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-};
-
-const unsigned short hero_walkPal[16] __attribute__((aligned(4))) __attribute__((visibility("hidden")))=
-{
-	0x0000,0x2A36,0x3EDB,0x59CA,0x2C40,0x40E5,0x4505,0x11B2,
-	0x6E8F,0x6BBD,0x04CA,0x196F,0x1E99,0x6A82,0x7F27,0x0000,
-};
-
-//}}BLOCK(hero_walk)
@@ -1,28 +0,0 @@
-
-//{{BLOCK(hero_walk)
-
-//======================================================================
-//
-//	hero_walk, 192x128@4, 
-//	+ palette 16 entries, not compressed
-//	+ 384 tiles Metatiled by 4x4 not compressed
-//	Total size: 32 + 12288 = 12320
-//
-//	Time-stamp: 2026-02-15, 15:33:36
-//	Exported by Cearn's GBA Image Transmogrifier, v0.9.2
-//	( http://www.coranac.com/projects/#grit )
-//
-//======================================================================
-
-#ifndef GRIT_HERO_WALK_H
-#define GRIT_HERO_WALK_H
-
-#define hero_walkTilesLen 12288
-extern const unsigned int hero_walkTiles[3072];
-
-#define hero_walkPalLen 32
-extern const unsigned short hero_walkPal[16];
-
-#endif // GRIT_HERO_WALK_H
-
-//}}BLOCK(hero_walk)
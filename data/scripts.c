@@ -0,0 +1,69 @@
+// Auto-generated by build_scripts.py — DO NOT EDIT
+#include "scripts.h"
+#include "entity.h"
+#include "particle.h"
+#include "warp.h"
+
+// 8 scripts, 134 bytes
+const unsigned char scriptCode[134] = {
+    // intro @ 0
+    SOP_WAIT_MOVE,
+    SOP_FXP, FX_DUST, 0, 0,
+    SOP_END,
+    // river @ 6
+    SOP_SET, 0, 4, 0,
+    SOP_FXP, FX_SPLASH, 1, 0,
+    SOP_WAIT, 12, 0,
+    SOP_FXP, FX_SPLASH, 0, 1,
+    SOP_WAIT, 12, 0,
+    SOP_DJNZ, 0, 4, 0,
+    SOP_END,
+    // gate @ 29
+    SOP_SPAWN, ENT_GUARD, 147, 4, DIR_NW,
+    SOP_FX, FX_DUST, 147, 4,
+    SOP_WAIT, 8, 0,
+    SOP_SPAWN, ENT_GUARD, 147, 11, DIR_NW,
+    SOP_FX, FX_DUST, 147, 11,
+    SOP_RUN, SCRIPT_BEACON,
+    SOP_WAIT_MOVE,
+    SOP_FLAG, 0,
+    SOP_END,
+    // beacon @ 56
+    SOP_SET, 1, 20, 0,
+    SOP_FX, FX_SPARKS, 150, 3,
+    SOP_WAIT, 30, 0,
+    SOP_DJNZ, 1, 4, 0,
+    SOP_END,
+    // hall @ 72
+    SOP_FX, FX_SPARKS, 160, 7,
+    SOP_WAIT_KEY, (KEY_B) & 0xFF, (KEY_B) >> 8,
+    SOP_FX, FX_SPARKS, 160, 7,
+    SOP_FX, FX_SPARKS, 160, 8,
+    SOP_END,
+    // ruins @ 88
+    SOP_WAIT_COL, 185,
+    SOP_FX, FX_SPARKS, 185, 7,
+    SOP_WAIT, 20, 0,
+    SOP_FX, FX_SPARKS, 185, 8,
+    SOP_WAIT_KEY, (KEY_B) & 0xFF, (KEY_B) >> 8,
+    SOP_FXP, FX_SPARKS, 0, 0,
+    SOP_END,
+    // stress @ 109
+    SOP_SET, 0, 232, 3,
+    SOP_SET, 1, 0, 0,
+    SOP_ADD, 1, 1,
+    SOP_DJNZ, 0, 8, 0,
+    SOP_END,
+    // portal @ 125
+    SOP_WARP, 3, 8, WARP_FADE,
+    SOP_FXP, FX_DUST, 0, 0,
+    SOP_END,
+};
+
+const unsigned short scriptStart[SCRIPT_COUNT] = {
+    0, 6, 29, 56, 72, 88, 109, 125,
+};
+
+const unsigned char scriptCutscene[4] = {
+    SCRIPT_RIVER, SCRIPT_GATE, SCRIPT_HALL, SCRIPT_RUINS,
+};
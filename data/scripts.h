@@ -0,0 +1,23 @@
+// Auto-generated by build_scripts.py — DO NOT EDIT
+#ifndef SCRIPTS_H
+#define SCRIPTS_H
+
+#include "script.h"
+
+#define SCRIPT_INTRO 0
+#define SCRIPT_RIVER 1
+#define SCRIPT_GATE 2
+#define SCRIPT_BEACON 3
+#define SCRIPT_HALL 4
+#define SCRIPT_RUINS 5
+#define SCRIPT_STRESS 6
+#define SCRIPT_PORTAL 7
+#define SCRIPT_COUNT 8
+#define SCRIPT_BOOT SCRIPT_INTRO
+#define SCRIPT_CUTSCENES 4
+
+extern const unsigned char scriptCode[134];
+extern const unsigned short scriptStart[SCRIPT_COUNT];
+extern const unsigned char scriptCutscene[SCRIPT_CUTSCENES];
+
+#endif // SCRIPTS_H
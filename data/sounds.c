@@ -0,0 +1,691 @@
+// Auto-generated by build_sounds.py — DO NOT EDIT
+#include "sounds.h"
+
+static const s8 snd_slash[1051] __attribute__((aligned(4))) = {
+     -26,  64,  43, -53, -29,  -4,  48,  67, -55,-104,  11,   5,  64, -43, -30,  -2,
+     -50,  66,  94, -34, -87, -37,  42,   8, -11,  -3, -80, -78, -33,   9,  -9, -29,
+     -59, -42, -44, -55,  57,  27,   7, -63,  43,  71, -10, -15,  10,   5,  47,  15,
+      68,  44, -30, -19,  34,  63,  37,  29, -64, -67,  11,   3, -16,  15,  18,   2,
+     -28,  -5,  22,  53,   6, -33, -24, -55, -44,  32,  60,   3, -30, -43,  11,  77,
+      48,  -3,  20, -30,  11,  74,  30, -13, -49, -13,  60, -22,  38,  34,  29,  19,
+      44,  31,  28,  -6, -68,   9,  10, -13,  16,   5, -29, -42, -11,  23,  36,  12,
+     -56, -59, -58,   3,  57,  57,  40,  23, -37,  26,  37, -16, -46, -70,  -7, -36,
+     -38,  23,   2, -47, -60, -25, -38, -15,  35,   7, -28, -26, -60, -15,   7, -16,
+     -44,  13, -12, -31,  18,  50, -30, -62, -63,  -2, -26,  31,  36,  10, -38,  20,
+      27,  18,  -5,  21, -12, -12, -31,   7, -23,  -7,  43,  31, -27,  18,  -7,  53,
+      44,   0, -35, -64,  16, -27,  38,  56,  12, -40,  10,  41,  38,  23,   1, -20,
+     -44,  -5,  -4, -13, -21,  13, -24, -20, -27,  29,  52, -16, -25, -30,  18,  19,
+      -3,  -9,  24,  32,  29, -21,  19,  25,  18,  52, -10,   4, -45, -40,  30,  -2,
+      30,  13,  17, -20, -22, -14,  38,  26,  39,  26, -35,  -9, -25, -26, -25,  22,
+      16,  14, -16,   9,  34,  10,   9, -26, -48, -34,  23,  21,  46,  10, -20,   3,
+      14, -31,  16, -13, -23,  17, -40, -36,  24,   7, -12, -17, -22,   2, -38,  15,
+       0,  43,  46,  -3, -25, -18, -38,   4, -19, -24,  31, -12,  -7, -15, -17, -24,
+      33,  44,  38, -26, -34,  -6,  32,  19,  26,  19, -16, -12, -23, -22, -23,  -7,
+      36,   3,   1,  -2,  20,   0,  -2,   0,  -7,  15,  16, -18, -16,   5,  16,  17,
+     -10, -37, -32, -38,  -4, -17, -17,  11, -11,   6,  -9,  13, -14,   6,  27, -14,
+      19, -24,   1,  23,  26,   5, -12,   1,  18, -17,   9, -19,  23, -11,  -4,  22,
+      15,  15,  13,  14,  18,  -4,   3, -16,   2,   0, -20, -27,  24,  30,  16,   6,
+      13,  -9, -14, -12,  -9, -16,  11,  -1,  -2, -31, -20, -23, -18,  -7,  22,   2,
+      -9,  -5, -21, -30,  -1,   8,  16,   4,   6,   4, -19,  -8,   0,  -6,   3,   8,
+      19,  16, -15,  -2, -20, -18,   5,  24, -10,   5,  10, -13,   4,  20,   6,  17,
+      17,   5,  10,  12,  18,   8,  -6,  -4,  -8,   1,   6, -25,  -4,   7,  -1,   8,
+      -6,  12, -19,  10,   7,   2,  -9,  21,  30,  -3,  12,  12,   2,   2,  -5,  18,
+      29,   8,  18,   1, -18, -18, -24,  10,  23,  -4,  10,   2, -16, -16, -20,   0,
+     -20, -12,   2, -12,   6,   4,   8, -16, -16,  -2,  -5,   9,  -1,   9,  11,   8,
+      12,  -1,  -1,  16,  19,  12,   1,  -9, -21,   1, -18,   4,   5,  23,  20,  24,
+      -8,  -6,  -5, -13,  -5,  -4,   5, -10,   0,  -1, -10, -11,   2,   3,   1,   9,
+       4,  -4, -15, -12,  -4,   6,   8,   1,  18,   8,  18,   4,   9,  14,  -9, -18,
+      -3,   1,  -1, -10,  -1,   0,  -4,   6,  -2,   2,  11,  11,   6,  14,  11,   8,
+       4,  -7,  -3,   0,  12,  13,  18,  17,  16,   7,  -5, -13,  -2,   7,   2,  -7,
+      13,   7,   4, -12,  -4,   2,  -7,  -9,   2, -11,   2,  18,  13,   1,   3,  -1,
+     -13, -14,   7,  -3,  -8,  12,   7,  -1,  -1,   2, -13,  -3,   3,  10,  -1,   7,
+      -1,   4,  -8,   3,   6,  -8, -12,   9,  10,  15,  -5,  13,   7,  -5,  -6,   1,
+       4,  -9,   2,  -5,  15,   6,  14,   9,   2,  -9,  -5, -13, -13,   4,   1,  11,
+       0,   7,   6,  -6, -15,  -9,  -5, -11,  -8,  -9,   5,  14,  -2, -12,   0,   3,
+       8,   1,  -4,   8,  -4,   8,  -4,  -1,   0,  -5, -12, -12,   2,  -2,   2,  -3,
+       8,   1,   5,  11,  11, -11,   1,   5,  -5,  -4,   3,  13,   4,  12,   9,  -6,
+       5, -13, -14,  -2, -11,  -4,  -6,   1,  11,  13,  -6, -11,   2, -12, -10, -12,
+     -11, -11,   3,   9,   9,  11,   6,  -2,   0,   6,   1,  -7, -11,   7,   6,   1,
+       6,   5,   2,  -9,  -7,  -6, -10,   3,  -2,   3,   7,   9,   9,   9,  -1,   8,
+      -6,   4,   4,   4,  -9, -10,   5,   3,   1,  12,  -4,   1,  -2,  -9,  -7,  -1,
+       4,  -9,  -1,  -6,   7,  -3,  -6,  -1,   4,  -3,  -9,   0,   2,   4,  -4,  -2,
+      -3,   3,   1,   0,   7,  10,   3,  -8,  -2,  -4,   5,   3,   6,   5,   4,  10,
+      10,   1,  -4,  -3,  -1,  -9,  -7,  -3, -10,   2,   3,  -1,  -1,   0,   0,   6,
+       2,   1,  -7,   3,  -5,  -6, -10,   4,   1,   8,  10,  12,   9,  10,   9,   6,
+      -5,  -3,  -2,   4,   3,   2,   4,   0,   8,   6,   2,   2,   9,   3,  -5,  -7,
+      -1,  -2,   3,  -5,  -3,   3,  -5,  -5,   2,  -1,  -4,  -3,   2,   0,  -7,  -9,
+       1,   0,  -6,   3,  -6,  -2,   6,   6,   1,   7,   4,   6,   6,  -1,   0,  -1,
+       3,   3,   2,   4,   7,   0,  -2,   5,   6,   3,   2,   0,   4,   3,   0,  -8,
+       1,  -2,  -5,  -4,   2,  -5,  -4,  -1,   6,   6,   8,   3,   1,   0,  -1,  -2,
+       1,   4,  -2,   0,  -2,  -2,   1,   3,   3,   8,  -1,   3,   7,   4,   1,  -3,
+      -3,   2,   3,   1,   4,   5,   5,   1,   1,   5,   2,   5,   2,  -1,   0,  -5,
+      -3,  -3,  -7,  -7,  -6,   1,   0,  -2,   5,  -1,   1,   4,   5,   2,   5,   2,
+       3,   0,   4,   2,  -5,  -6,   2,  -4,  -7,  -4,  -1,   5,   1,   4,   6,  -1,
+       2,   7,   3,   1,  -1,   3,   4,  -4,  -2,  -3,   0,  -5,  -4,  -3,  -1,   3,
+       5,   5,   4,  -1,   0,   3,   0,   0,   4,  -3,   2,  -4,  -3,   1,  -4,  -2,
+      -2,   2,   5,  -1,   1,   5,   3,  -1,   4,   1,   1,  -3,   4,   2,   4,   4,
+      -2,  -1,  -2,   0,   2,  -3,  -3,   1,  -1,  -3,  -2,   1,   2,   6,   3,   3,
+      -1,   0,  -1,   2,  -2,  -3,  -2,  -2,  -3,  -1,  -4,   1,   1,   0,  -4,  -2,
+       1,   2,   4,   5,   1,   1,   0,  -2,  -2,  -1,  -3,   0,   1,   0,   1,  -3,
+      -4,  -1,   1,  -2,  -5,  -5,  -3,   0,  -3,  -2,   1,
+};
+
+static const s8 snd_hit[946] __attribute__((aligned(4))) = {
+      99,  75,  78,  74,  44,  46,  36,  38,  68,  78,  46,  33,  62,  42,  44,  42,
+      29,  22,  24,  39,  75,  76,  56,  69,  54,  59,  52,  80,  63,  78,  76,  86,
+      78, -34, -52, -47, -48, -53, -53, -54, -62, -42, -44, -49, -74, -65, -76, -79,
+     -71, -62, -70, -73, -63, -61, -62, -75, -70, -56, -53, -52, -39, -37, -38, -65,
+     -67, -52, -66,  62,  43,  62,  46,  62,  70,  54,  67,  46,  61,  51,  49,  35,
+      46,  40,  50,  60,  58,  36,  58,  68,  63,  51,  51,  62,  53,  59,  56,  49,
+      62,  51,  52,  35,  39, -64, -48, -62, -68, -68, -67, -55, -54, -56, -35, -27,
+     -31, -28, -26, -42, -34, -45, -42, -46, -54, -40, -29, -41, -31, -40, -36, -25,
+     -26, -45, -44, -45, -48, -36, -39, -34, -33,  43,  30,  39,  48,  35,  40,  39,
+      35,  41,  51,  33,  44,  38,  45,  33,  40,  29,  29,  43,  43,  46,  40,  37,
+      36,  42,  43,  33,  32,  34,  36,  44,  46,  33,  31,  24,  20,  18, -48, -35,
+     -31, -26, -34, -40, -27, -24, -20, -35, -35, -31, -27, -22, -26, -31, -40, -30,
+     -22, -19, -22, -29, -34, -28, -21, -18, -29, -28, -29, -30, -25, -20, -21, -22,
+     -22, -23, -25,  26,  32,  24,  28,  27,  28,  30,  29,  35,  27,  20,  30,  26,
+      23,  24,  27,  34,  33,  27,  27,  26,  26,  25,  21,  22,  22,  20,  27,  24,
+      20,  24,  29,  30,  29,  30,  25,  20,  19,  20, -29, -27, -30, -31, -30, -31,
+     -24, -23, -27, -26, -20, -21, -21, -23, -27, -23, -28, -22, -27, -22, -23, -21,
+     -20, -25, -23, -27, -27, -26, -26, -22, -17, -20, -17, -22, -19, -22, -21, -25,
+     -20, -23,  19,  18,  22,  22,  22,  23,  19,  16,  21,  19,  22,  25,  23,  18,
+      22,  22,  18,  16,  18,  15,  20,  21,  23,  20,  23,  17,  20,  17,  14,  13,
+      13,  18,  17,  17,  18,  16,  18,  19,  21,  19,  21, -12, -13, -15, -18, -20,
+     -16, -19, -17, -17, -20, -20, -16, -16, -13, -12, -17, -15, -19, -18, -17, -14,
+     -14, -17, -16, -16, -17, -17, -14, -12, -12, -16, -13, -14, -13, -16, -17, -14,
+     -15, -18, -16, -13, -12, -14,  18,  18,  18,  17,  15,  17,  15,  17,  16,  17,
+      15,  14,  14,  13,  11,  13,  15,  13,  15,  16,  16,  14,  16,  16,  15,  12,
+      13,  10,  14,  12,  12,  12,  13,  13,  13,  13,  14,  13,  13,  14,  11,  10,
+      10,  10,  13, -13, -14, -14, -13, -11,  -9,  -9, -10, -12, -14, -12, -10, -12,
+     -10, -10, -10, -10, -12, -13, -10, -11, -13, -13, -11, -12, -12, -12, -11, -10,
+     -11,  -9,  -8,  -8, -11, -11,  -9,  -9, -11, -11, -11, -10, -11, -11, -10,  -9,
+     -11,  10,  10,  11,  10,  11,  10,   8,   8,   9,   8,   8,   8,   7,  10,   9,
+      10,  10,   9,  10,   8,  10,   8,   8,   8,   7,   9,   8,   9,   8,   8,   8,
+       8,   8,   8,   8,   9,   8,   7,   8,   8,   9,   8,   8,   7,   6,   6,   7,
+       8,   9,  -8,  -7,  -8,  -9,  -8,  -8,  -7,  -6,  -6,  -7,  -7,  -7,  -7,  -7,
+      -7,  -7,  -7,  -7,  -7,  -7,  -7,  -7,  -6,  -7,  -7,  -8,  -7,  -8,  -8,  -7,
+      -7,  -7,  -7,  -6,  -6,  -6,  -7,  -7,  -7,  -7,  -6,  -7,  -7,  -6,  -7,  -7,
+      -7,  -7,  -6,  -6,  -7,   6,   5,   7,   7,   6,   6,   7,   7,   6,   7,   7,
+       6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   5,   5,   6,   6,   6,   6,
+       6,   5,   5,   5,   6,   6,   6,   5,   6,   5,   5,   6,   5,   5,   5,   6,
+       6,   5,   5,   5,   5,   5,   5,   4,   5,   4,   5,  -5,  -5,  -5,  -5,  -4,
+      -5,  -5,  -5,  -6,  -5,  -5,  -5,  -5,  -4,  -5,  -5,  -6,  -5,  -4,  -5,  -5,
+      -5,  -5,  -5,  -5,  -5,  -5,  -5,  -5,  -5,  -5,  -5,  -4,  -5,  -4,  -4,  -5,
+      -5,  -5,  -5,  -4,  -4,  -4,  -5,  -4,  -4,  -4,  -4,  -4,  -4,  -4,  -5,  -5,
+      -4,  -4,  -4,  -4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+       3,   3,   3,   3,   4,   4,   4,   4,   4,   4,   4,   3,   4,   4,   4,   4,
+       3,   3,   4,   4,   4,   4,   4,   4,   4,   3,   3,   3,   3,   3,   3,   3,
+       3,   3,   4,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+       3,   3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,
+      -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,
+      -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -2,  -3,  -2,  -2,  -3,
+      -2,  -2,  -2,  -2,  -3,  -3,  -3,  -3,  -2,  -3,  -3,  -3,  -3,  -3,  -3,  -2,
+      -2,  -2,  -2,  -2,  -2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,
+       2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+       2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+       2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+       2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  -2,
+      -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -1,  -2,
+      -1,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -1,  -1,  -2,  -2,  -1,  -1,  -2,
+      -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -2,  -1,
+      -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+      -1,  -1,
+};
+
+static const s8 snd_jump[1261] __attribute__((aligned(4))) = {
+      60,  60,  60,  60,  60,  60,  60,  60,  59,  59,  59,  59,  59,  59,  59,  59,
+      59, -59, -59, -59, -59, -59, -58, -58, -58, -58, -58, -58, -58, -58, -58, -58,
+     -58, -58,  58,  58,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+      57,  57,  57, -56, -56, -56, -56, -56, -56, -56, -56, -56, -56, -56, -56, -56,
+     -56, -56, -55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+      55,  54,  54, -54, -54, -54, -54, -54, -54, -54, -54, -54, -54, -54, -54, -54,
+     -54, -53, -53,  53,  53,  53,  53,  53,  53,  53,  53,  53,  53,  53,  53,  53,
+      53,  52,  52, -52, -52, -52, -52, -52, -52, -52, -52, -52, -52, -52, -52, -52,
+     -52, -51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+      51, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50,
+      50,  50,  49,  49,  49,  49,  49,  49,  49,  49,  49,  49,  49,  49,  49, -49,
+     -49, -49, -49, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48,  48,  48,
+      48,  48,  48,  48,  48,  47,  47,  47,  47,  47,  47,  47, -47, -47, -47, -47,
+     -47, -47, -47, -47, -47, -47, -47, -46, -46, -46,  46,  46,  46,  46,  46,  46,
+      46,  46,  46,  46,  46,  46,  46,  46, -46, -45, -45, -45, -45, -45, -45, -45,
+     -45, -45, -45, -45, -45, -45,  45,  45,  45,  45,  45,  45,  44,  44,  44,  44,
+      44,  44,  44,  44, -44, -44, -44, -44, -44, -44, -44, -44, -44, -44, -44, -43,
+     -43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43, -43,
+     -43, -43, -42, -42, -42, -42, -42, -42, -42, -42, -42, -42,  42,  42,  42,  42,
+      42,  42,  42,  42,  42,  42,  41,  41,  41, -41, -41, -41, -41, -41, -41, -41,
+     -41, -41, -41, -41, -41, -41,  41,  41,  41,  41,  41,  40,  40,  40,  40,  40,
+      40,  40,  40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40,  40,
+      39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39, -39, -39, -39, -39,
+     -39, -39, -39, -39, -39, -38, -38, -38,  38,  38,  38,  38,  38,  38,  38,  38,
+      38,  38,  38,  38,  38, -38, -38, -38, -38, -38, -38, -38, -37, -37, -37, -37,
+     -37,  37,  37,  37,  37,  37,  37,  37,  37,  37,  37,  37,  37, -37, -37, -37,
+     -37, -37, -36, -36, -36, -36, -36, -36, -36,  36,  36,  36,  36,  36,  36,  36,
+      36,  36,  36,  36,  36, -36, -36, -36, -36, -36, -35, -35, -35, -35, -35, -35,
+      35,  35,  35,  35,  35,  35,  35,  35,  35,  35,  35,  35, -35, -35, -35, -35,
+     -35, -35, -34, -34, -34, -34, -34, -34,  34,  34,  34,  34,  34,  34,  34,  34,
+      34,  34,  34, -34, -34, -34, -34, -34, -34, -34, -33, -33, -33, -33,  33,  33,
+      33,  33,  33,  33,  33,  33,  33,  33,  33,  33, -33, -33, -33, -33, -33, -33,
+     -33, -33, -33, -33, -32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,
+     -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32,  32,  32,  32,  31,  31,
+      31,  31,  31,  31,  31,  31, -31, -31, -31, -31, -31, -31, -31, -31, -31, -31,
+     -31,  31,  31,  31,  31,  31,  31,  31,  31,  30,  30,  30, -30, -30, -30, -30,
+     -30, -30, -30, -30, -30, -30,  30,  30,  30,  30,  30,  30,  30,  30,  30,  30,
+      30, -30, -30, -30, -30, -29, -29, -29, -29, -29, -29,  29,  29,  29,  29,  29,
+      29,  29,  29,  29,  29,  29, -29, -29, -29, -29, -29, -29, -29, -29, -29, -29,
+      29,  29,  28,  28,  28,  28,  28,  28,  28,  28, -28, -28, -28, -28, -28, -28,
+     -28, -28, -28, -28, -28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28, -28,
+     -27, -27, -27, -27, -27, -27, -27, -27, -27,  27,  27,  27,  27,  27,  27,  27,
+      27,  27,  27, -27, -27, -27, -27, -27, -27, -27, -27, -27, -27,  27,  27,  26,
+      26,  26,  26,  26,  26,  26,  26, -26, -26, -26, -26, -26, -26, -26, -26, -26,
+     -26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26, -26, -26, -26, -26, -26,
+     -25, -25, -25, -25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25, -25, -25,
+     -25, -25, -25, -25, -25, -25, -25, -25,  25,  25,  25,  25,  25,  25,  25,  25,
+      25, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24,  24,  24,  24,  24,  24,
+      24,  24,  24,  24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24,  24,  24,
+      24,  24,  24,  24,  23,  23,  23, -23, -23, -23, -23, -23, -23, -23, -23, -23,
+      23,  23,  23,  23,  23,  23,  23,  23,  23,  23, -23, -23, -23, -23, -23, -23,
+     -23, -23, -23,  23,  23,  23,  23,  23,  23,  22,  22,  22, -22, -22, -22, -22,
+     -22, -22, -22, -22, -22,  22,  22,  22,  22,  22,  22,  22,  22,  22, -22, -22,
+     -22, -22, -22, -22, -22, -22, -22,  22,  22,  22,  22,  22,  22,  22,  22,  21,
+     -21, -21, -21, -21, -21, -21, -21, -21, -21,  21,  21,  21,  21,  21,  21,  21,
+      21,  21, -21, -21, -21, -21, -21, -21, -21, -21, -21,  21,  21,  21,  21,  21,
+      21,  21,  21, -21, -21, -21, -21, -20, -20, -20, -20, -20,  20,  20,  20,  20,
+      20,  20,  20,  20,  20, -20, -20, -20, -20, -20, -20, -20, -20, -20,  20,  20,
+      20,  20,  20,  20,  20,  20, -20, -20, -20, -20, -20, -20, -20, -20, -20,  20,
+      20,  19,  19,  19,  19,  19,  19, -19, -19, -19, -19, -19, -19, -19, -19, -19,
+      19,  19,  19,  19,  19,  19,  19,  19, -19, -19, -19, -19, -19, -19, -19, -19,
+     -19,  19,  19,  19,  19,  19,  19,  19,  19, -19, -19, -19, -19, -19, -18, -18,
+     -18,  18,  18,  18,  18,  18,  18,  18,  18,  18, -18, -18, -18, -18, -18, -18,
+     -18, -18,  18,  18,  18,  18,  18,  18,  18,  18, -18, -18, -18, -18, -18, -18,
+     -18, -18,  18,  18,  18,  18,  18,  18,  18,  18,  18, -18, -17, -17, -17, -17,
+     -17, -17, -17,  17,  17,  17,  17,  17,  17,  17,  17, -17, -17, -17, -17, -17,
+     -17, -17, -17,  17,  17,  17,  17,  17,  17,  17,  17, -17, -17, -17, -17, -17,
+     -17, -17, -17,  17,  17,  17,  17,  17,  17,  17,  17, -17, -17, -17, -16, -16,
+     -16, -16, -16,  16,  16,  16,  16,  16,  16,  16,  16, -16, -16, -16, -16, -16,
+     -16, -16, -16,  16,  16,  16,  16,  16,  16,  16,  16, -16, -16, -16, -16, -16,
+     -16, -16,  16,  16,  16,  16,  16,  16,  16,  16, -16, -16, -16, -16, -16, -16,
+     -16, -16,  15,  15,  15,  15,  15,  15,  15,  15, -15, -15, -15, -15, -15, -15,
+     -15,  15,  15,  15,  15,  15,  15,  15,  15, -15, -15, -15, -15, -15, -15, -15,
+     -15,  15,  15,  15,  15,  15,  15,  15, -15, -15, -15, -15, -15, -15, -15, -15,
+      15,  15,  15,  15,  15,  15,  15, -15, -15, -15, -14, -14, -14, -14, -14,  14,
+      14,  14,  14,  14,  14,  14, -14, -14, -14, -14, -14, -14, -14, -14,  14,  14,
+      14,  14,  14,  14,  14, -14, -14, -14, -14, -14, -14, -14, -14,  14,  14,  14,
+      14,  14,  14,  14, -14, -14, -14, -14, -14, -14, -14, -14,  14,  14,  14,  14,
+      14,  14,  14, -14, -14, -14, -13, -13, -13, -13,  13,  13,  13,
+};
+
+static const s8 snd_land[735] __attribute__((aligned(4))) = {
+      -9,  13,  13,  11,  28,  38,  25,  30,  19,  31,  34,  45,  29,  46,  36,  49,
+      46,  58,  43,  28,  29,  46,  44,  44,  33,  36,  35,  48,  54,  51,  38,  27,
+      43,  45,  35,  44,  33,  31,  42,  28,  16,   4,  -4,  -4,  -5,  -8, -19, -14,
+     -12,  -3,  -7,  -3,  -7,   1,  -8,  -8,  -9, -10,  -9,  -8, -13,  -5,   5,   3,
+       3,   5,  -3,  -4,  -8, -10, -15, -16, -24, -30, -37, -33, -38, -30, -21, -16,
+     -22, -13, -19, -24, -22, -20, -23, -18, -12, -18, -25, -27, -23, -20, -27, -28,
+     -19, -10, -10,  -5,  -1,  -8, -18, -15, -17, -12, -16, -16,  -9, -16, -16, -20,
+     -17, -11,  -1,   4,  -3,  -3,  -1,   2,   6,  14,  20,  14,   8,  16,  10,  17,
+      11,  12,   7,   2,   2,   9,  13,  11,   6,   6,   3,   1,   4,   6,  14,   9,
+      11,  13,   9,   8,   5,  12,  11,   6,   8,   9,  16,  19,  14,  20,  13,  15,
+       9,  14,  10,  14,  17,  19,  13,  11,   6,   9,  14,  13,  14,  14,   9,   6,
+       4,   6,   4,   2,   2,  -2,  -6,  -9, -13, -10,  -9,  -8,  -7, -11,  -7,  -4,
+     -10, -10,  -7,  -8,  -5,  -4,  -3,   0,   1,   0,  -6,  -8,  -6,  -7,  -7,  -9,
+      -6, -10,  -9, -10, -13, -17, -20, -20, -19, -22, -24, -19, -14, -14, -14, -12,
+     -15, -14, -12,  -7,  -6,  -6,  -7,  -4,  -4,  -4,  -3,  -4,  -7,  -6,  -3,  -4,
+      -7,  -9,  -5,  -7,  -5,  -7,  -6,  -2,  -4,  -4,  -3,  -1,   0,  -1,  -3,  -2,
+      -2,   0,   0,  -1,   3,   2,   6,   6,   6,   5,   3,   5,   5,   6,   4,   4,
+       6,   8,   9,   8,   9,   9,   9,   9,   8,   5,   4,   7,   9,  11,   9,  10,
+      11,  11,   9,   7,   9,  11,  12,  11,  11,  12,  11,   8,  10,   9,  10,   9,
+       6,   6,   3,   2,   4,   5,   4,   2,   3,   3,   3,   4,   5,   4,   4,   3,
+       3,   3,   1,  -1,  -3,  -5,  -4,  -4,  -3,  -4,  -5,  -4,  -5,  -5,  -4,  -4,
+      -5,  -6,  -5,  -6,  -5,  -5,  -4,  -5,  -5,  -6,  -6,  -6,  -4,  -5,  -4,  -6,
+      -5,  -4,  -4,  -3,  -4,  -4,  -3,  -2,  -1,  -2,  -1,  -2,  -1,  -2,  -3,  -4,
+      -3,  -2,  -2,  -3,  -3,  -2,  -1,  -3,  -3,  -2,  -2,   0,   1,   1,   1,   1,
+      -1,   0,   0,   1,  -1,   0,   1,   2,   2,   1,   1,   0,   0,   0,  -1,  -1,
+       0,   0,   1,   1,   1,   1,   2,   2,   3,   2,   1,   1,   1,   2,   1,   1,
+       1,   1,   2,   1,   2,   1,   2,   3,   4,   4,   3,   3,   4,   4,   4,   4,
+       4,   4,   4,   4,   3,   3,   2,   3,   4,   3,   4,   3,   2,   3,   2,   2,
+       2,   3,   2,   2,   2,   1,   0,   0,  -1,  -1,   0,   0,   1,   1,   1,   1,
+       1,   1,   1,   2,   2,   2,   1,   2,   2,   1,   1,   0,   0,   0,   1,   0,
+      -1,  -1,  -1,  -2,  -2,  -2,  -1,  -1,   0,  -1,   0,  -1,  -2,  -2,  -1,  -1,
+      -1,  -2,  -2,  -2,  -1,  -1,  -2,  -2,  -3,  -2,  -2,  -2,  -2,  -2,  -2,  -2,
+      -2,  -2,  -2,  -2,  -2,  -2,  -2,  -2,  -3,  -3,  -2,  -2,  -2,  -2,  -2,  -2,
+      -2,  -2,  -2,  -2,  -2,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,   0,  -1,
+      -1,  -2,  -2,  -1,  -1,  -1,  -1,  -2,  -2,  -2,  -1,  -1,  -1,   0,  -1,  -1,
+      -1,  -1,   0,   0,  -1,  -1,  -1,  -1,  -1,   0,   0,   0,   1,   1,   0,   1,
+       0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   0,   0,   1,   0,   0,
+       0,   0,   0,   1,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+       1,   2,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,  -1,  -1,  -1,   0,   0,  -1,   0,  -1,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,  -1,  -1,  -1,  -1,  -1,  -1,  -1,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+static const s8 snd_splash[2312] __attribute__((aligned(4))) = {
+      -6, -71,  10, -49,  31, -42,  63,  34, -20, -35,  15, -43, -69, -15, -30, -73,
+     -28, -14,  31, -53, -66, -41,  33, -18,  15, -35,  13,  53,  67,  18, -61,  37,
+      27,   8, -32,  -7,  31,  26, -17, -43, -97,  -5,  83, -21,  -1,  52,  29,  63,
+     -30,   9,  33, -42, -47,  39,   5,  19,  64,  36,  57, -17,  29, -32, -17,  13,
+      -4, -59, -68, -33, -41,   6, -22,  30, -21,  33,  51,  54,  -5,   7,  27,  52,
+      51,  29, -49, -51, -95, -73,  -5,  -6,   1, -42,  60,  75,   9,  11, -23, -27,
+     -44,  11,  -6,  -9, -36,   1,  19, -31,   1,  48,  54,  61,  36,  20,  52, -13,
+      31,  39,  34,  25, -30,  20,  24,  16,  14,  22,  37,  30,  60, -26,  45,  35,
+      46,  48,  18,   6, -42,  22,  56,   8,  22,  42, -23,   2,  11,  24,  41,   9,
+      23,  53,  11,  53,  16, -18, -38, -12,  49,  66,  46,  27,  30,  38,   9,  65,
+      -5,  -8,  10,  52,  26, -20,  19, -15, -16, -35, -77, -71,  -8,  21,  -9,  33,
+       8,  34, -33, -57,  -2, -39, -42, -15, -35, -32,  13, -13,  26,  40,  51,  53,
+      41,  -1,  16,  31,  44, -22,  34, -10,   7,  12,  15,   4,  23,  36,  37, -26,
+     -35, -25, -54, -66,   3, -43, -33, -34,  25,  57,  51,   3, -38,  33, -10,  -2,
+      40,  17,  40,  56,  26,  31, -16, -10,   9, -17, -15,  27, -16,  16, -25, -23,
+     -12, -34,   7,   3, -25,  11,  -2,  17, -36, -46, -40, -11, -20, -48,  24, -12,
+     -31,  19,  55,  58,   0,  22, -17,   6,  -1, -37, -16, -49,   6,  13,  33,  41,
+     -11, -29,  21,  -5,  21,   8, -32, -33,  25,  32,  33, -23, -63,   0,  29,  40,
+     -18,  38, -16,   7,  16,  -1,  36, -26,  25,  35,  -3, -18,  20,  -2,  -3,  21,
+      53,  38,  -4,  -2, -26,   7,  19,   1,  -4, -22, -13, -55, -19,  37,  -9,  15,
+      27,  16,  34,   7,  19, -27, -30,  -9,  23,   3,  29,  23,   9,  33,  30,  56,
+      38,  -6,  -6,   5, -29, -25,  11,  -4,   6, -14, -38, -26, -34, -23, -31,  22,
+      20,   3,  -5, -23,   3,   4, -31, -23,  -6,  34,  48,  16, -18,  21, -17,  -2,
+      36,  -7,   9,  -1, -21, -29, -16,   9, -24, -36, -40, -20, -12,  17,  10, -27,
+     -52, -31, -36,  11,  24,  25,  14,  -7,  21,  -5, -34, -40, -25,  19,  15,  20,
+       0,  -3,  18,  53,   6,  14,   1, -23, -16, -31,  -2,   1,  18,  18,  -7,  22,
+      33,  20, -16,  -2,  10, -13,  11,  -9, -24, -31,  -3,  14,  10, -12, -17, -42,
+     -41, -25, -40, -46, -28, -39, -11, -34, -22, -34, -39,  -9, -26,   3,   4,  17,
+       9,  10, -11, -17, -29, -38, -17,  -5,  25,  31, -21,  15,   7,  -4, -24, -30,
+     -24, -11,  16,  14,  -3,   9,  21,  -8, -21, -13,  15, -10,   4, -15,  10,   1,
+     -15,  22,  13, -19, -23, -33, -21, -30,   0,   9,  -6, -19,   6,  -9,  10,  22,
+      31,  42,  -1,  16,   1,  24,  24,  -5, -16,  14,   1, -17,  -2, -15, -35, -31,
+       9, -22,  18, -18, -17, -38,  -1,  10,  23,  27,  30,  10,  -7,   6,   5, -19,
+      -5, -11,  20, -15,  11,  19,  31,  13,  12,  -7,  12, -15,   0, -25, -20,  -5,
+      -2,   1, -14, -22, -18, -11,   6,  24,  11,  29,  10,  -9,   0,  10,  17,  -9,
+      17,   7, -18, -20,  11, -15, -15,   0, -22,   9,   4,  -4,  10, -14, -25,   5,
+       9,  -9, -16,  13,  -5, -26, -13, -25,  -6, -19, -26,  -9,  19,  12,  27,  36,
+      30,  17,  -2, -21, -12, -17,   1,  -4,  -5,   9,   1,  19,  10,  -9,  18,  12,
+       2,  -8,   4, -10,  11,  26, -13,  14,  26,  29,  13,   9,   8,  -3, -20, -23,
+      -9, -19, -21,  -4,  -8,   6, -18, -18, -16, -22,   4,   7, -20, -22,   0, -12,
+     -19, -24, -32,   2,  -5, -15, -28, -16,   2,  26,  32,  -9,  -4,  -5,   4,   1,
+      21,  13,   1,  19,  11, -19,  -2,  22,  15,  -6,  13, -11,  12, -12,   5, -10,
+     -23, -24, -10,   6,   7, -17,  12,  22,   3, -17, -15,  17,  28,  -1, -13,  18,
+      -5,  11,  24,  23,  26,  16,  18,  -2,  19,  -4, -18,   2,  21,  17,  10, -12,
+      -2, -15,  -5, -10, -14,  -9,   8,  17, -11,  18,  26,   3,  23,  -6,  -2,  12,
+     -10,  -6, -25, -26, -14,   6,   7, -10,   4,  10,  -1, -13,   3,  15,  -4,  -5,
+      -8,  11, -10, -24, -20, -13,  14, -12,   9,   5,  15,  25,  21,  -3,  13,  -8,
+      16,   1,  -9,   9,   9,  -4, -12,  -4, -11,  -9,  -7, -14, -23, -23,   0,   5,
+      21,  -7,  15,  23,   6,  20,  24,  26,  11,  23,  -1, -18, -20,   1,  15,  -8,
+     -14,   9,  20,  -7, -20, -18, -17, -28, -22,   2, -18,  -9,   3,   7,  -3, -17,
+     -12,  -6,  -3,  -8,  -4,  13, -12, -13,   7,   5,  13,  -9,  14,  -9,   4,  -8,
+       5,  15,  15,  20,   1,  15,  11,  -5, -16, -18,   8,  -1,  -5, -19,   4,   0,
+      -6,   3,   3,  14,  10,   1,  -6,  14,  -4, -19,   6,   9,  19,  14,  23,   8,
+     -10,   1, -10,  -4,  -9, -12,  -5,   0, -11,   7,  -3,   6,   1, -14, -12, -14,
+     -11,  -2,   3,  -6,   2,   6, -11,  -3, -17,   0,  -7,  -1,  12,  10,   8,   4,
+      -6,  -3, -13, -10,   9,   6,   8,  18,   9,  -5,  14,   7,   2, -14,  -1,  10,
+       5,  -7,   2,  -6,  -6, -11,  -4,   3,   2, -10, -12, -16,  -8,  14,  10,  16,
+      -4, -17,  -7,  -9,  -7,   0, -12,   7,   0,   3, -11, -18,  -2, -15,  -4,  -4,
+      -8,  11,  14,   3,  -5,  -9, -17,   7,   7,  12,   0,  -6,  -2,  -8,   8,  18,
+      21,  -1,  -5,   6,   3,   5,   6,  -5,  -3, -15, -20,   7,   7,   8,  -5,  -7,
+      10,  18,  13,  19,   6,  12,  10,  -1,   9, -11, -12,  -7,  10,   0, -10,   0,
+       7,  -9,   0,  -1,  -3,  11,  12,  18,  13,   3,  -3,  -9, -18,  -7, -10,  -4,
+      -8,  -2,  10,   4,  12,   1, -11,   0,  -1,   4,   2,  -2,  -3,  -9,  10,  -4,
+      -2,  11,  11,  18,  13,   1,  10,  -6,  10,   3,   5,  13,   5,  10,  14,   5,
+      12,  -1, -11,   1,   8,   3, -13,  -5, -11, -16, -14,  -2,  -5,   6,  -6,   0,
+      -6,  -7, -13,   0,  -5,   2,   4,   4,   5,   6,  -6,   2,   1,  10,  -6, -12,
+      -1,  -4,  10,  -2,   0,  -5,   1,  -9,   8,  -2,   8,  15,   4,   8,  14,  -6,
+       9,   3,  -1,   7,  -4, -14,   5,  -8,  -2,   2,  -2,   8,  12,  -5,   1,   7,
+       2,  -9,  -2, -11,  -9,  -3,  -8,  -1,   7,   4,   4,  -5, -13,  -8, -10,  -2,
+      -9,  -6,  -3,   5,  -9,   5,  -6,   8,   9,  12,  17,  -3,  -3,   0,  -3,   2,
+      10,  -2,  -6,   6,  -2, -10,   1,  -3,   0, -10,  -3,   5,   0,  -4,   5,   2,
+       0,  -7,   1,   9,  -8,  -7,   0,  -6,   5,  -5,  -8,  -6, -10,   3,   3,  -2,
+       2,   6,   3,   4,   6,   3,  -5,  -9,   0,  -2,   9,  -1,   7,   1,  -7,  -6,
+      -1,   4,  -1,  -7, -11,  -2,   1,   8,   4,   0,   6,   6,   6,  -5,   4,  -1,
+       3,  -7, -14, -15, -15, -16,  -1,   2,  -8,   6,   0,   5,   6,  -1,   7,  13,
+       2,  -1,  -3,   6,   2,  -8, -12,  -3,  -8,   2,   3,  -5,  -9,  -1,  -6,   7,
+       2,  -3,   5,   4,   5,   8,   3,  -9,  -9,   5,   5,  -6, -11, -12,  -9,  -1,
+       7,   6,   2,  10,  -3,   7,   6,  -2,   5,  -4,   0,  -1,  -8,   4,  -4,  -4,
+       0,  -3,  -8,  -8,  -5,   3,   2,   8,  -2,   4,  12,  15,   3,  -6,   1,  -1,
+       3,  -5,   6,   1,   8,  -4,  -6,  -3,  -5,  -6,   5,   3,  10,   4,   7,   6,
+      -3,   1,   6,   7,   3,  -6,   2,   8,  -3,  -9,  -5,   1,  -1,   6,   8,   5,
+       4,   4,   1,  -4,   5,  -3,   4,   1,   5,   8,  10,   9,   1,   5,   9,   6,
+      -1,   7,   8,   2,  -3,   4,   4,  -1,   8,  11,   8,   9,   6,  -1,   5,   6,
+       8,   2,   8,   7,   7,   8,   3,   7,  10,  11,   6,  -4,  -5,  -7,  -9,  -7,
+      -2,   7,  -4,   6,   3,   6,   9,   1,   4,   6,   0,   7,   9,  -4,   4,   0,
+       7,  -4,   4,   1,  -3,  -2,   5,   0,   0,   5,   8,   0,   0,  -2,  -5,  -6,
+     -10, -10,  -5,  -5,   0,  -7,  -7,   3,   3,  -4,   3,  -6,  -6,  -7,  -5,  -2,
+       5,   2,   6,  10,  -2,  -7,   2,  -3,  -1,   1,   0,   4,  -4,  -6,  -9,  -8,
+       4,  -5,  -2,  -5,   1,  -4,   1,   0,   8,  -2,  -2,   5,   3,   0,   6,   7,
+       7,   1,  -1,  -3,   5,  -4,  -7,  -2,   5,   9,   6,   7,   1,   1,   4,  -2,
+       2,   0,  -6,  -4,   1,   5,   4,   6,   0,  -2,  -3,  -2,  -4,   4,   5,  -2,
+      -6,  -3,   1,   3,   0,   2,   2,  -2,   4,  -1,  -5,  -8,  -1,   0,   4,   7,
+      -1,   3,   4,   3,   8,  -1,  -1,  -1,  -4,   0,   4,   2,  -4,  -5,   1,   0,
+      -6,  -6,  -2,  -3,  -6,  -4,  -6,   2,  -2,  -1,  -1,  -1,   5,  -3,  -1,  -4,
+      -8,  -1,  -3,   2,   0,  -6,  -8, -10,  -4,  -3,  -4,  -4,  -3,   3,   6,   7,
+       6,  -2,  -2,   3,  -2,   2,  -4,   2,  -2,  -4,   4,  -3,   3,  -1,  -3,  -5,
+      -8,  -5,  -2,  -4,  -7,   1,   4,   4,  -2,  -5,  -2,  -5,  -4,  -5,   1,   2,
+      -2,   4,   3,   5,   4,   1,   0,  -1,  -5,   3,   0,  -5,  -7,  -5,   1,   0,
+      -2,   4,  -3,  -4,   3,   1,   0,  -5,  -1,   2,   4,  -2,  -1,   4,   5,  -1,
+      -5,   2,   0,  -1,   2,  -2,  -4,  -1,   1,   5,  -2,   1,  -4,  -1,   1,   0,
+      -1,  -2,   2,   5,   2,   3,   1,   0,   1,   2,   0,   0,   4,   0,   2,  -3,
+       4,  -3,   2,  -3,   1,  -5,  -4,  -7,  -4,  -1,  -5,  -2,  -2,   3,   1,  -5,
+      -5,   1,   0,  -1,  -2,  -3,  -5,  -1,  -4,  -5,  -6,  -5,   2,  -2,  -6,   2,
+       1,   5,   5,   2,   1,  -5,  -3,  -4,  -3,   2,   2,   5,   5,   6,  -1,   0,
+       3,   4,   5,   2,  -3,  -1,   0,   3,   0,   4,   6,   5,   4,   7,  -1,  -2,
+      -1,  -1,   1,   0,  -1,  -5,  -7,  -3,  -3,  -4,  -6,  -7,  -6,  -3,  -4,  -2,
+       1,  -4,   0,   2,   4,   7,   0,  -4,   0,   0,   3,   2,   4,  -2,  -1,  -4,
+      -5,  -6,   1,   0,   2,   4,   4,   0,   2,   1,   4,   4,   5,   7,   2,   0,
+      -5,   1,   1,  -2,   0,   4,   5,   6,   2,  -1,  -5,  -6,  -5,  -1,  -4,   2,
+       2,   4,   0,   0,   3,  -2,  -4,  -5,  -5,  -5,  -6,  -5,  -3,  -3,  -2,  -1,
+       1,   1,   5,   6,   6,   3,  -1,  -1,   0,   0,   3,   3,   5,  -1,   1,  -1,
+      -5,  -6,  -4,  -4,  -3,  -5,  -6,  -5,   0,   0,   2,   4,   2,   2,  -2,  -2,
+       1,   3,  -2,  -3,  -2,  -1,   0,   3,  -1,  -4,  -5,  -4,  -3,  -4,   1,  -1,
+      -2,  -3,   2,   2,   3,  -1,  -3,  -2,  -1,  -3,  -4,  -5,  -6,  -5,  -4,  -4,
+      -1,   4,   2,   1,   0,  -3,   0,  -1,   1,   0,  -2,  -2,  -4,  -3,   2,  -1,
+       0,   3,   1,  -1,  -3,  -4,   1,   0,  -1,  -4,   0,  -3,  -1,   1,   3,   4,
+       0,  -2,  -4,  -3,  -2,  -3,  -4,  -2,  -2,  -3,   1,  -3,  -2,  -2,  -2,   0,
+       0,   1,   2,  -2,   3,   1,   3,  -1,   0,   2,  -1,   0,   3,   1,   1,   2,
+       4,   0,   3,   3,   0,  -2,  -3,  -2,   1,   0,  -3,  -4,   1,  -2,   2,   4,
+       2,   2,   3,   4,   3,   3,   4,   0,  -1,   1,   2,   0,   3,  -1,  -3,  -4,
+      -3,   2,   4,   4,   1,   3,   0,   0,   2,   0,   1,   3,   1,   2,  -2,   2,
+       0,  -1,   3,  -1,   0,   3,   1,  -1,  -1,   1,  -1,   2,   4,   4,   2,   0,
+      -2,  -2,  -1,  -1,  -1,  -3,   0,   2,   2,  -1,  -2,  -3,  -1,   2,   0,   2,
+      -2,   0,   0,  -1,   1,   2,   4,   1,   1,   0,  -3,  -1,   1,   3,   0,   0,
+       2,  -1,  -2,  -1,   0,   2,   0,   1,   3,   4,   4,   1,   2,   1,   0,  -1,
+       3,   3,   1,  -2,  -2,   1,  -2,   2,   0,  -2,  -1,   1,  -2,  -1,   1,   0,
+      -1,   0,   0,  -2,   1,   3,   1,   3,   2,  -2,   2,   2,  -1,  -3,   0,  -1,
+      -2,   0,   0,   2,   2,   0,  -1,   2,   3,  -1,   2,   2,   0,   2,   1,   1,
+       3,   0,   2,   1,   0,   2,  -1,   0,   2,  -1,   1,   1,   0,  -1,   1,  -1,
+      -1,  -1,   0,  -2,  -1,  -3,  -1,   0,  -2,  -2,  -1,   1,   3,   2,   2,   0,
+       2,   3,   4,   2,  -1,  -2,  -2,   0,  -1,  -1,   1,  -2,  -3,  -3,  -1,  -1,
+       1,   1,   1,   0,  -2,   0,   0,   1,   0,   2,   0,   2,  -2,   0,   2,  -1,
+      -3,  -4,  -2,   1,  -1,   0,   2,  -1,   2,   1,   0,  -1,  -2,   1,   2,  -1,
+      -2,  -3,  -2,  -2,   1,   2,  -1,   2,   3,   3,   2,   1,   3,   0,   2,   0,
+      -1,  -2,   0,   1,  -1,  -2,   2,   2,   0,   1,   2,   0,   2,   2,   0,   2,
+       0,   1,   1,   0,  -1,  -1,   0,  -1,  -2,   0,  -1,   0,   1,   2,   1,   1,
+      -1,  -2,  -1,  -1,  -2,  -1,   1,   1,   2,   1,   2,   1,  -1,   0,   1,  -1,
+       1,   0,   1,   2,   1,   2,   0,  -1,   1,  -1,   0,   1,   0,  -1,  -2,  -2,
+      -1,  -1,  -2,  -2,  -2,  -2,  -2,   1,   2,   1,   1,   1,   1,   0,   1,   0,
+      -1,  -2,  -1,   0,  -2,   0,   1,   1,   1,  -1,  -1,  -2,  -1,  -1,  -1,   2,
+       0,   2,   0,  -1,  -1,  -1,   0,  -2,   0,   2,  -1,   1,   0,  -2,   0,   2,
+       2,   2,   2,   2,   1,   0,  -1,   0,   2,   3,   3,   1,   1,   0,   1,  -1,
+      -2,  -2,  -2,  -2,  -1,   0,   0,   2,   0,  -2,  -2,   0,  -1,  -2,  -2,   1,
+      -1,  -2,  -1,  -1,   1,   1,   2,   1,  -1,  -2,  -2,  -1,  -1,  -1,  -1,  -2,
+      -1,  -2,  -2,   0,  -1,   0,   0,  -1,
+};
+
+static const s8 snd_chime[3679] __attribute__((aligned(4))) = {
+      83,  43, -41, -43,  -3,   0,   4,  44,  37, -46, -81,   5,  84,  38, -43, -41,
+      -1,   0,   6,  44,  34, -50, -78,  11,  84,  34, -45, -39,   0,   1,   7,  45,
+      30, -53, -75,  16,  83,  29, -47, -38,   1,   1,   9,  45,  27, -55, -72,  21,
+      83,  25, -48, -36,   2,   1,  10,  45,  23, -58, -69,  25,  82,  20, -49, -34,
+       3,   2,  12,  45,  19, -60, -65,  30,  81,  16, -50, -32,   4,   2,  13,  44,
+      16, -62, -61,  34,  79,  11, -51, -30,   5,   2,  14,  44,  12, -64, -57,  38,
+      77,   7, -52, -28,   6,   3,  16,  43,   8, -65, -53,  42,  75,   3, -52, -26,
+       7,   3,  17,  42,   4, -66, -49,  46,  73,  -1, -53, -23,   8,   4,  18,  41,
+       1, -67, -45,  49,  71,  -5, -53, -21,   8,   4,  19,  40,  -3, -68, -40,  52,
+      68,  -9, -53, -19,   9,   5,  20,  39,  -6, -68, -36,  55,  65, -13, -52, -17,
+      10,   5,  21,  37, -10, -68, -32,  58,  62, -16, -52, -15,  10,   5,  22,  36,
+     -13, -68, -27,  60,  59, -20, -51, -13,  11,   6,  23,  34, -17, -68, -23,  62,
+      56, -23, -50, -11,  11,   6,  23,  32, -20, -67, -18,  64,  52, -26, -49,  -9,
+      12,   7,  24,  30, -23, -66, -14,  65,  49, -29, -48,  -7,  12,   7,  24,  28,
+     -26, -65,  -9,  66,  45, -32, -47,  -5,  12,   8,  25,  26, -28, -63,  -5,  67,
+      42, -34, -46,  -3,  13,   8,  25,  24, -31, -62,   0,  68,  38, -37, -44,  -1,
+      13,   9,  25,  22, -33, -60,   4,  68,  34, -39, -43,   0,  13,   9,  25,  20,
+     -36, -58,   8,  68,  30, -41, -41,   2,  13,   9,  25,  17, -38, -56,  12,  68,
+      26, -42, -39,   4,  13,  10,  25,  15, -40, -53,  16,  68,  22, -44, -37,   5,
+      14,  10,  25,  12, -41, -51,  19,  67,  19, -45, -35,   7,  14,  11,  25,  10,
+     -43, -48,  23,  66,  15, -46, -33,   8,  14,  11,  25,   8, -44, -45,  26,  65,
+      11, -47, -31,  10,  14,  11,  24,   5, -45, -42,  30,  64,   7, -48, -29,  11,
+      14,  11,  24,   3, -46, -39,  33,  62,   4, -49, -27,  12,  14,  12,  23,   0,
+     -47, -36,  36,  60,   0, -49, -24,  13,  13,  12,  22,  -2, -48, -33,  38,  59,
+      -3, -49, -22,  14,  13,  12,  21,  -4, -48, -30,  41,  56,  -7, -49, -20,  15,
+      13,  12,  21,  -7, -48, -27,  43,  54, -10, -49, -18,  16,  13,  13,  20,  -9,
+     -48, -23,  45,  52, -13, -49, -16,  17,  13,  13,  19, -11, -48, -20,  47,  49,
+     -16, -48, -13,  17,  13,  13,  17, -13, -48, -16,  49,  47, -19, -47, -11,  18,
+      13,  13,  16, -15, -47, -13,  50,  44, -22, -47,  -9,  19,  12,  13,  15, -17,
+     -47, -10,  51,  41, -25, -46,  -7,  19,  12,  13,  14, -19, -46,  -6,  52,  38,
+     -27, -45,  -5,  19,  12,  13,  13, -21, -45,  -3,  53,  35, -29, -43,  -3,  20,
+      12,  13,  11, -22, -44,   0,  53,  32, -32, -42,  -1,  20,  11,  12,  10, -24,
+     -42,   3,  54,  29, -33, -40,   1,  20,  11,  12,   9, -25, -41,   6,  54,  26,
+     -35, -39,   3,  20,  11,  12,   7, -27, -39,   9,  54,  22, -37, -37,   5,  20,
+      10,  12,   6, -28, -37,  12,  54,  19, -38, -35,   7,  20,  10,  11,   4, -29,
+     -36,  15,  53,  16, -40, -34,   8,  20,  10,  11,   3, -30, -34,  18,  52,  13,
+     -41, -32,  10,  20,   9,  11,   1, -31, -32,  20,  52,  10, -42, -30,  11,  20,
+       9,  10,   0, -31, -30,  23,  51,   6, -42, -28,  13,  20,   9,  10,  -2, -32,
+     -27,  25,  49,   3, -43, -26,  14,  19,   8,   9,  -3, -32, -25,  27,  48,   0,
+     -43, -23,  15,  19,   8,   9,  -4, -33, -23,  29,  47,  -3, -43, -21,  17,  19,
+       8,   8,  -6, -33, -20,  31,  45,  -5, -44, -19,  18,  18,   7,   8,  -7, -33,
+     -18,  33,  43,  -8, -43, -17,  19,  18,   7,   7,  -8, -33, -16,  35,  41, -11,
+     -43, -15,  19,  17,   7,   6, -10, -33, -13,  36,  39, -13, -43, -13,  20,  17,
+       6,   6, -11, -32, -11,  37,  37, -16, -42, -11,  21,  16,   6,   5, -12, -32,
+      -8,  38,  35, -18, -42,  -8,  21,  15,   5,   4, -13, -31,  -6,  39,  33, -20,
+     -41,  -6,  22,  15,   5,   4, -14, -31,  -4,  40,  30, -23, -40,  -4,  22,  14,
+       5,   3, -15, -30,  -1,  41,  28, -25, -39,  -2,  23,  13,   4,   2, -16, -29,
+       1,  41,  25, -26, -37,   0,  23,  13,   4,   1, -17, -28,   3,  41,  23, -28,
+     -36,   2,  23,  12,   4,   1, -18, -27,   6,  41,  20, -30, -35,   3,  23,  11,
+       3,   0, -18, -26,   8,  41,  18, -31, -33,   5,  23,  11,   3,  -1, -19, -25,
+      10,  41,  15, -32, -32,   7,  23,  10,   2,  -2, -20, -23,  12,  41,  13, -33,
+     -30,   9,  23,   9,   2,  -2, -20, -22,  14,  40,  10, -34, -28,  10,  23,   8,
+       1,  -3, -20, -21,  16,  40,   8, -35, -27,  12,  22,   8,   1,  -4, -21, -19,
+      18,  39,   5, -36, -25,  13,  22,   7,   1,  -5, -21, -18,  19,  38,   3, -36,
+     -23,  14,  22,   6,   0,  -5, -21, -16,  21,  37,   0, -37, -21,  16,  21,   6,
+       0,  -6, -21, -14,  22,  36,  -2, -37, -19,  17,  21,   5,  -1,  -7, -21, -13,
+      24,  34,  -4, -37, -17,  18,  20,   4,  -1,  -7, -21, -11,  25,  33,  -7, -37,
+     -15,  19,  19,   3,  -1,  -8, -21,  -9,  26,  32,  -9, -37, -13,  20,  19,   3,
+      -2,  -9, -21,  -8,  27,  30, -11, -36, -11,  20,  18,   2,  -2,  -9, -20,  -6,
+      28,  28, -13, -36,  -9,  21,  17,   1,  -3, -10, -20,  -4,  29,  27, -15, -35,
+      -7,  22,  16,   1,  -3, -10, -20,  -3,  29,  25, -17, -35,  -6,  22,  16,   0,
+      -3, -11, -19,  -1,  30,  23, -18, -34,  -4,  23,  15,   0,  -4, -11, -19,   1,
+      30,  21, -20, -33,  -2,  23,  14,  -1,  -4, -12, -18,   2,  31,  19, -22, -32,
+       0,  23,  13,  -1,  -4, -12, -17,   4,  31,  17, -23, -31,   2,  23,  12,  -2,
+      -5, -12, -16,   5,  31,  15, -24, -30,   3,  23,  11,  -2,  -5, -12, -16,   7,
+      31,  13, -25, -28,   5,  23,  10,  -3,  -5, -13, -15,   8,  30,  11, -26, -27,
+       7,  23,   9,  -3,  -6, -13, -14,  10,  30,   9, -27, -26,   8,  23,   8,  -4,
+      -6, -13, -13,  11,  30,   7, -28, -24,  10,  23,   7,  -4,  -6, -13, -12,  12,
+      29,   5, -29, -23,  11,  22,   6,  -5,  -7, -13, -11,  14,  29,   4, -29, -21,
+      12,  22,   6,  -5,  -7, -13, -10,  15,  28,   2, -30, -20,  14,  22,   5,  -5,
+      -7, -13,  -9,  16,  27,   0, -30, -18,  15,  21,   4,  -6,  -7, -13,  -8,  17,
+      26,  -2, -30, -16,  16,  20,   3,  -6,  -7, -13,  -7,  18,  25,  -4, -30, -15,
+      17,  20,   2,  -6,  -8, -13,  -5,  19,  24,  -6, -30, -13,  18,  19,   1,  -7,
+      -8, -12,  -4,  19,  23,  -7, -30, -11,  18,  18,   0,  -7,  -8, -12,  -3,  20,
+      22,  -9, -30, -10,  19,  18,   0,  -7,  -8, -12,  -2,  20,  21, -11, -30,  -8,
+      20,  17,  -1,  -7,  -8, -11,  -1,  21,  19, -12, -29,  -6,  20,  16,  -2,  -7,
+      -8, -11,   0,  21,  18, -14, -29,  -5,  21,  15,  -3,  -8,  -8, -11,   1,  22,
+      17, -15, -28,  -3,  21,  14,  -3,  -8,  -8, -10,   2,  22,  15, -16, -27,  -1,
+      21,  13,  -4,  -8,  -8, -10,   3,  22,  14, -17, -26,   0,  22,  12,  -5,  -8,
+      -8,  -9,   4,  22,  12, -18, -25,   2,  22,  11,  -5,  -8,  -8,  -9,   5,  22,
+      11, -19, -24,   3,  22,  10,  -6,  -8,  -8,  -8,   6,  22,   9, -20, -23,   5,
+      22,   9,  -6,  -8,  -8,  -7,   7,  22,   8, -21, -22,   6,  22,   8,  -7,  -8,
+      -8,  -7,   8,  22,   6, -22, -21,   7,  22,   7,  -7,  -8,  -8,  -6,   9,  21,
+       5, -22, -20,   9,  21,   6,  -8,  -8,  -8,  -5,  10,  21,   3, -23, -19,  10,
+      21,   5,  -8,  -8,  -8,  -5,  11,  20,   2, -23, -17,  11,  21,   4,  -8,  -8,
+      -7,  -4,  11,  20,   0, -24, -16,  12,  20,   4,  -9,  -8,  -7,  -3,  12,  19,
+      -1, -24, -15,  13,  20,   3,  -9,  -8,  -7,  -3,  13,  19,  -2, -24, -13,  14,
+      19,   2,  -9,  -8,  -7,  -2,  13,  18,  -4, -24, -12,  15,  18,   1,  -9,  -8,
+      -7,  -1,  14,  17,  -5, -24, -11,  16,  18,   0,  -9,  -7,  -6,  -1,  14,  16,
+      -6, -24,  -9,  16,  17,  -1, -10,  -7,  -6,   0,  14,  15,  -8, -24,  -8,  17,
+      16,  -2, -10,  -7,  -6,   1,  15,  14,  -9, -23,  -6,  18,  15,  -3, -10,  -7,
+      -5,   1,  15,  13, -10, -23,  -5,  18,  15,  -3, -10,  -7,  -5,   2,  15,  12,
+     -11, -23,  -3,  19,  14,  -4, -10,  -6,  -5,   3,  15,  11, -12, -22,  -2,  19,
+      13,  -5, -10,  -6,  -4,   3,  15,  10, -13, -22,  -1,  19,  12,  -5, -10,  -6,
+      -4,   4,  15,   9, -14, -21,   1,  19,  11,  -6, -10,  -6,  -3,   5,  15,   8,
+     -15, -20,   2,  19,  10,  -7, -10,  -6,  -3,   5,  15,   7, -15, -19,   3,  19,
+       9,  -7,  -9,  -5,  -3,   6,  15,   6, -16, -18,   4,  19,   8,  -8,  -9,  -5,
+      -2,   6,  15,   5, -17, -18,   5,  19,   7,  -8,  -9,  -5,  -2,   7,  15,   4,
+     -17, -17,   7,  19,   6,  -9,  -9,  -4,  -1,   7,  14,   3, -18, -16,   8,  19,
+       5,  -9,  -9,  -4,  -1,   8,  14,   2, -18, -15,   9,  19,   4,  -9,  -9,  -4,
+       0,   8,  14,   0, -18, -14,  10,  18,   4, -10,  -8,  -4,   0,   9,  13,  -1,
+     -18, -13,  11,  18,   3, -10,  -8,  -3,   0,   9,  13,  -2, -19, -11,  11,  17,
+       2, -10,  -8,  -3,   1,   9,  12,  -3, -19, -10,  12,  17,   1, -10,  -7,  -3,
+       1,  10,  12,  -4, -19,  -9,  13,  16,   0, -10,  -7,  -2,   2,  10,  11,  -5,
+     -19,  -8,  14,  16,  -1, -11,  -7,  -2,   2,  10,  11,  -5, -19,  -7,  14,  15,
+      -2, -11,  -6,  -2,   2,  10,  10,  -6, -18,  -6,  15,  14,  -3, -11,  -6,  -1,
+       3,  10,   9,  -7, -18,  -5,  15,  14,  -3, -11,  -6,  -1,   3,  10,   8,  -8,
+     -18,  -3,  16,  13,  -4, -11,  -5,  -1,   4,  10,   8,  -9, -17,  -2,  16,  12,
+      -5, -11,  -5,  -1,   4,  10,   7, -10, -17,  -1,  16,  11,  -5, -10,  -5,   0,
+       4,  10,   6, -10, -16,   0,  16,  10,  -6, -10,  -4,   0,   5,  10,   6, -11,
+     -16,   1,  16,  10,  -7, -10,  -4,   0,   5,  10,   5, -11, -15,   2,  17,   9,
+      -7, -10,  -4,   1,   5,  10,   4, -12, -15,   3,  17,   8,  -8, -10,  -3,   1,
+       5,  10,   3, -12, -14,   4,  17,   7,  -8, -10,  -3,   1,   6,  10,   2, -13,
+     -13,   5,  16,   6,  -9,  -9,  -2,   2,   6,  10,   2, -13, -13,   6,  16,   5,
+      -9,  -9,  -2,   2,   6,   9,   1, -13, -12,   7,  16,   4,  -9,  -9,  -2,   2,
+       6,   9,   0, -14, -11,   7,  16,   4, -10,  -8,  -1,   2,   6,   9,  -1, -14,
+     -10,   8,  15,   3, -10,  -8,  -1,   3,   7,   8,  -1, -14,  -9,   9,  15,   2,
+     -10,  -8,  -1,   3,   7,   8,  -2, -14,  -8,  10,  15,   1, -10,  -7,   0,   3,
+       7,   8,  -3, -14,  -8,  10,  14,   0, -10,  -7,   0,   3,   7,   7,  -4, -14,
+      -7,  11,  14,  -1, -11,  -6,   0,   3,   7,   7,  -4, -14,  -6,  11,  13,  -1,
+     -11,  -6,   1,   4,   7,   6,  -5, -14,  -5,  12,  13,  -2, -11,  -6,   1,   4,
+       7,   6,  -5, -14,  -4,  12,  12,  -3, -11,  -5,   1,   4,   7,   5,  -6, -13,
+      -3,  13,  11,  -4, -11,  -5,   2,   4,   7,   5,  -7, -13,  -2,  13,  11,  -4,
+     -11,  -4,   2,   4,   7,   4,  -7, -13,  -1,  13,  10,  -5, -10,  -4,   2,   4,
+       7,   4,  -8, -13,   0,  13,   9,  -5, -10,  -4,   2,   5,   7,   3,  -8, -12,
+       0,  14,   9,  -6, -10,  -3,   3,   5,   7,   3,  -8, -12,   1,  14,   8,  -6,
+     -10,  -3,   3,   5,   6,   2,  -9, -11,   2,  14,   7,  -7, -10,  -2,   3,   5,
+       6,   2,  -9, -11,   3,  14,   6,  -7,  -9,  -2,   3,   5,   6,   1,  -9, -10,
+       4,  14,   6,  -8,  -9,  -1,   3,   5,   6,   0, -10, -10,   4,  14,   5,  -8,
+      -9,  -1,   4,   5,   6,   0, -10,  -9,   5,  13,   4,  -9,  -8,  -1,   4,   5,
+       5,  -1, -10,  -8,   6,  13,   3,  -9,  -8,   0,   4,   5,   5,  -1, -10,  -8,
+       6,  13,   3,  -9,  -8,   0,   4,   5,   5,  -2, -10,  -7,   7,  13,   2,  -9,
+      -7,   1,   4,   5,   5,  -2, -10,  -7,   7,  12,   1, -10,  -7,   1,   4,   5,
+       4,  -3, -10,  -6,   8,  12,   0, -10,  -7,   1,   4,   5,   4,  -3, -10,  -5,
+       8,  12,   0, -10,  -6,   2,   4,   5,   4,  -3, -10,  -5,   9,  11,  -1, -10,
+      -6,   2,   5,   5,   3,  -4, -10,  -4,   9,  11,  -2, -10,  -5,   2,   5,   5,
+       3,  -4, -10,  -3,  10,  10,  -2, -10,  -5,   3,   5,   5,   3,  -5, -10,  -3,
+      10,  10,  -3, -10,  -4,   3,   5,   5,   2,  -5, -10,  -2,  10,   9,  -3, -10,
+      -4,   3,   5,   4,   2,  -5,  -9,  -1,  10,   9,  -4, -10,  -3,   3,   5,   4,
+       2,  -6,  -9,   0,  11,   8,  -5, -10,  -3,   4,   5,   4,   1,  -6,  -9,   0,
+      11,   7,  -5,  -9,  -3,   4,   5,   4,   1,  -6,  -9,   1,  11,   7,  -6,  -9,
+      -2,   4,   5,   4,   1,  -6,  -8,   1,  11,   6,  -6,  -9,  -2,   4,   5,   4,
+       0,  -7,  -8,   2,  11,   6,  -6,  -9,  -1,   4,   5,   3,   0,  -7,  -7,   3,
+      11,   5,  -7,  -8,  -1,   4,   4,   3,  -1,  -7,  -7,   3,  11,   4,  -7,  -8,
+       0,   5,   4,   3,  -1,  -7,  -7,   4,  11,   4,  -7,  -8,   0,   5,   4,   3,
+      -1,  -7,  -6,   4,  11,   3,  -8,  -8,   0,   5,   4,   3,  -2,  -7,  -6,   5,
+      10,   2,  -8,  -7,   1,   5,   4,   2,  -2,  -7,  -5,   5,  10,   2,  -8,  -7,
+       1,   5,   4,   2,  -2,  -7,  -5,   6,  10,   1,  -8,  -6,   2,   5,   4,   2,
+      -2,  -7,  -4,   6,  10,   1,  -9,  -6,   2,   5,   4,   2,  -3,  -7,  -4,   6,
+       9,   0,  -9,  -6,   2,   5,   4,   1,  -3,  -7,  -3,   7,   9,  -1,  -9,  -5,
+       2,   5,   3,   1,  -3,  -7,  -3,   7,   9,  -1,  -9,  -5,   3,   5,   3,   1,
+      -4,  -7,  -2,   7,   8,  -2,  -9,  -4,   3,   5,   3,   1,  -4,  -7,  -2,   8,
+       8,  -2,  -9,  -4,   3,   5,   3,   0,  -4,  -7,  -1,   8,   8,  -3,  -9,  -4,
+       4,   5,   3,   0,  -4,  -7,  -1,   8,   7,  -3,  -9,  -3,   4,   5,   3,   0,
+      -4,  -6,   0,   8,   7,  -4,  -9,  -3,   4,   5,   2,   0,  -5,  -6,   0,   8,
+       6,  -4,  -8,  -2,   4,   5,   2,   0,  -5,  -6,   1,   8,   6,  -5,  -8,  -2,
+       4,   4,   2,  -1,  -5,  -6,   1,   9,   5,  -5,  -8,  -1,   5,   4,   2,  -1,
+      -5,  -5,   2,   9,   5,  -5,  -8,  -1,   5,   4,   2,  -1,  -5,  -5,   2,   9,
+       4,  -6,  -8,  -1,   5,   4,   2,  -1,  -5,  -5,   3,   9,   4,  -6,  -7,   0,
+       5,   4,   1,  -2,  -5,  -5,   3,   8,   3,  -6,  -7,   0,   5,   4,   1,  -2,
+      -5,  -4,   3,   8,   3,  -7,  -7,   1,   5,   4,   1,  -2,  -5,  -4,   4,   8,
+       2,  -7,  -6,   1,   5,   3,   1,  -2,  -5,  -4,   4,   8,   2,  -7,  -6,   1,
+       5,   3,   1,  -2,  -5,  -3,   4,   8,   1,  -7,  -6,   2,   5,   3,   0,  -3,
+      -5,  -3,   5,   8,   1,  -7,  -5,   2,   5,   3,   0,  -3,  -5,  -2,   5,   7,
+       0,  -7,  -5,   2,   5,   3,   0,  -3,  -5,  -2,   5,   7,   0,  -7,  -5,   3,
+       5,   3,   0,  -3,  -5,  -2,   5,   7,  -1,  -7,  -4,   3,   5,   2,   0,  -3,
+      -5,  -1,   6,   7,  -1,  -8,  -4,   3,   5,   2,  -1,  -3,  -5,  -1,   6,   6,
+      -2,  -8,  -4,   3,   5,   2,  -1,  -3,  -5,  -1,   6,   6,  -2,  -7,  -3,   4,
+       5,   2,  -1,  -3,  -4,   0,   6,   6,  -3,  -7,  -3,   4,   5,   2,  -1,  -4,
+      -4,   0,   6,   5,  -3,  -7,  -2,   4,   5,   1,  -1,  -4,  -4,   0,   6,   5,
+      -3,  -7,  -2,   4,   4,   1,  -1,  -4,  -4,   1,   6,   5,  -4,  -7,  -2,   4,
+       4,   1,  -2,  -4,  -4,   1,   7,   4,  -4,  -7,  -1,   5,   4,   1,  -2,  -4,
+      -4,   1,   7,   4,  -4,  -7,  -1,   5,   4,   1,  -2,  -4,  -3,   2,   7,   3,
+      -5,  -7,   0,   5,   4,   0,  -2,  -4,  -3,   2,   7,   3,  -5,  -6,   0,   5,
+       4,   0,  -2,  -4,  -3,   2,   6,   3,  -5,  -6,   0,   5,   3,   0,  -2,  -4,
+      -3,   3,   6,   2,  -5,  -6,   1,   5,   3,   0,  -2,  -4,  -2,   3,   6,   2,
+      -6,  -6,   1,   5,   3,   0,  -2,  -4,  -2,   3,   6,   1,  -6,  -5,   1,   5,
+       3,  -1,  -2,  -4,  -2,   3,   6,   1,  -6,  -5,   2,   5,   3,  -1,  -3,  -4,
+      -2,   4,   6,   1,  -6,  -5,   2,   5,   2,  -1,  -3,  -3,  -1,   4,   6,   0,
+      -6,  -4,   2,   5,   2,  -1,  -3,  -3,  -1,   4,   6,   0,  -6,  -4,   2,   5,
+       2,  -1,  -3,  -3,  -1,   4,   5,  -1,  -6,  -4,   3,   5,   2,  -1,  -3,  -3,
+      -1,   4,   5,  -1,  -6,  -3,   3,   5,   2,  -1,  -3,  -3,   0,   4,   5,  -1,
+      -6,  -3,   3,   5,   1,  -2,  -3,  -3,   0,   5,   5,  -2,  -6,  -3,   3,   4,
+       1,  -2,  -3,  -3,   0,   5,   4,  -2,  -6,  -2,   4,   4,   1,  -2,  -3,  -3,
+       0,   5,   4,  -2,  -6,  -2,   4,   4,   1,  -2,  -3,  -3,   1,   5,   4,  -3,
+      -6,  -2,   4,   4,   1,  -2,  -3,  -2,   1,   5,   3,  -3,  -6,  -1,   4,   4,
+       0,  -2,  -3,  -2,   1,   5,   3,  -3,  -6,  -1,   4,   4,   0,  -2,  -3,  -2,
+       1,   5,   3,  -3,  -6,  -1,   4,   4,   0,  -2,  -3,  -2,   2,   5,   3,  -4,
+      -6,   0,   4,   3,   0,  -2,  -3,  -2,   2,   5,   2,  -4,  -5,   0,   4,   3,
+       0,  -2,  -3,  -2,   2,   5,   2,  -4,  -5,   0,   5,   3,  -1,  -2,  -3,  -1,
+       2,   5,   2,  -4,  -5,   1,   5,   3,  -1,  -2,  -3,  -1,   2,   5,   1,  -4,
+      -5,   1,   5,   3,  -1,  -3,  -3,  -1,   3,   5,   1,  -5,  -5,   1,   5,   2,
+      -1,  -3,  -2,  -1,   3,   4,   1,  -5,  -4,   1,   5,   2,  -1,  -3,  -2,  -1,
+       3,   4,   0,  -5,  -4,   2,   5,   2,  -1,  -3,  -2,   0,   3,   4,   0,  -5,
+      -4,   2,   4,   2,  -2,  -3,  -2,   0,   3,   4,   0,  -5,  -3,   2,   4,   2,
+      -2,  -3,  -2,   0,   3,   4,  -1,  -5,  -3,   2,   4,   1,  -2,  -3,  -2,   0,
+       3,   4,  -1,  -5,  -3,   3,   4,   1,  -2,  -3,  -2,   0,   3,   4,  -1,  -5,
+      -3,   3,   4,   1,  -2,  -3,  -2,   0,   3,   3,  -1,  -5,  -2,   3,   4,   1,
+      -2,  -3,  -2,   1,   3,   3,  -2,  -5,  -2,   3,   4,   1,  -2,  -2,  -2,   1,
+       4,   3,  -2,  -5,  -2,   3,   4,   0,  -2,  -2,  -1,   1,   4,   3,  -2,  -5,
+      -2,   3,   4,   0,  -2,  -2,  -1,   1,   4,   3,  -2,  -5,  -1,   4,   4,   0,
+      -2,  -2,  -1,   1,   4,   2,  -3,  -5,  -1,   4,   3,   0,  -2,  -2,  -1,   1,
+       4,   2,  -3,  -5,  -1,   4,   3,   0,  -2,  -2,  -1,   2,   4,   2,  -3,  -4,
+       0,   4,   3,  -1,  -2,  -2,  -1,   2,   4,   2,  -3,  -4,   0,   4,   3,  -1,
+      -3,  -2,  -1,   2,   3,   1,  -3,  -4,   0,   4,   3,  -1,  -3,  -2,   0,   2,
+       3,   1,  -3,  -4,   0,   4,   3,  -1,  -3,  -2,   0,   2,   3,   1,  -4,  -4,
+       1,   4,   2,  -1,  -3,  -2,   0,   2,   3,   1,  -4,  -4,   1,   4,   2,  -1,
+      -3,  -2,   0,   2,   3,   0,  -4,  -3,   1,   4,   2,  -2,  -3,  -2,   0,   2,
+       3,   0,  -4,  -3,   1,   4,   2,  -2,  -3,  -2,   0,   2,   3,   0,  -4,  -3,
+       2,   4,   2,  -2,  -2,  -1,   0,   2,   3,   0,  -4,  -3,   2,   4,   1,  -2,
+      -2,  -1,   0,   2,   3,  -1,  -4,  -3,   2,   4,   1,  -2,  -2,  -1,   1,   3,
+       3,  -1,  -4,  -2,   2,   4,   1,  -2,  -2,  -1,   1,   3,   2,  -1,  -4,  -2,
+       2,   4,   1,  -2,  -2,  -1,   1,   3,   2,  -1,  -4,  -2,   3,   4,   1,  -2,
+      -2,  -1,   1,   3,   2,  -1,  -4,  -2,   3,   3,   0,  -2,  -2,  -1,   1,   3,
+       2,  -2,  -4,  -1,   3,   3,   0,  -2,  -2,  -1,   1,   3,   2,  -2,  -4,  -1,
+       3,   3,   0,  -2,  -2,  -1,   1,   3,   2,  -2,  -4,  -1,   3,   3,   0,  -2,
+      -2,   0,   1,   3,   2,  -2,  -4,  -1,   3,   3,   0,  -2,  -2,   0,   1,   3,
+       1,  -2,  -4,  -1,   3,   3,  -1,  -2,  -2,   0,   1,   3,   1,  -2,  -4,   0,
+       3,   3,  -1,  -2,  -2,   0,   2,   3,   1,  -2,  -3,   0,   3,   3,  -1,  -2,
+      -2,   0,   2,   2,   1,  -3,  -3,   0,   3,   2,  -1,  -2,  -1,   0,   2,   2,
+       1,  -3,  -3,   0,   3,   2,  -1,  -2,  -1,   0,   2,   2,   0,  -3,  -3,   1,
+       3,   2,  -1,  -2,  -1,   0,   2,   2,   0,  -3,  -3,   1,   3,   2,  -1,  -2,
+      -1,   0,   2,   2,   0,  -3,  -3,   1,   3,   2,  -2,  -2,  -1,   1,   2,   2,
+       0,  -3,  -3,   1,   3,   1,  -2,  -2,  -1,   1,   2,   2,   0,  -3,  -2,   1,
+       3,   1,  -2,  -2,  -1,   1,   2,   2,   0,  -3,  -2,   2,   3,   1,  -2,  -2,
+      -1,   1,   2,   2,  -1,  -3,  -2,   2,   3,   1,  -2,  -2,  -1,   1,   2,   2,
+      -1,  -3,  -2,   2,   3,   1,  -2,  -2,  -1,   1,   2,   2,  -1,  -3,  -2,   2,
+       3,   1,  -2,  -2,   0,   1,   2,   2,  -1,  -3,  -2,   2,   3,   0,  -2,  -2,
+       0,   1,   2,   1,  -1,  -3,  -1,   2,   3,   0,  -2,  -2,   0,   1,   2,   1,
+      -1,  -3,  -1,   2,   3,   0,  -2,  -2,   0,   1,   2,   1,  -1,  -3,  -1,
+};
+
+static const s8 snd_square[32] __attribute__((aligned(4))) = {
+      48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+     -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48,
+};
+
+static const s8 snd_triangle[32] __attribute__((aligned(4))) = {
+    -100, -88, -75, -62, -50, -38, -25, -12,   0,  12,  25,  38,  50,  62,  75,  88,
+     100,  88,  75,  62,  50,  38,  25,  12,   0, -12, -25, -38, -50, -62, -75, -88,
+};
+
+// 6 effects at 10512 Hz, 2 instruments, 10048 bytes
+const SoundSample soundSamples[SND_SAMPLES] = {
+    { snd_slash, 1051, SOUND_NO_LOOP, 10512, 2, 24 },
+    { snd_hit, 946, SOUND_NO_LOOP, 10512, 3, 32 },
+    { snd_jump, 1261, SOUND_NO_LOOP, 10512, 1, 18 },
+    { snd_land, 735, SOUND_NO_LOOP, 10512, 1, 20 },
+    { snd_splash, 2312, SOUND_NO_LOOP, 10512, 1, 22 },
+    { snd_chime, 3679, SOUND_NO_LOOP, 10512, 4, 28 },
+    { snd_square, 32, 0, 8372, 0, 0 },
+    { snd_triangle, 32, 0, 8372, 0, 0 },
+};
+
+const u16 soundNotePitch[60] = {
+     1024, 1085, 1149, 1218, 1290, 1367, 1448, 1534, 1625, 1722, 1825, 1933,
+     2048, 2170, 2299, 2435, 2580, 2734, 2896, 3069, 3251, 3444, 3649, 3866,
+     4096, 4340, 4598, 4871, 5161, 5468, 5793, 6137, 6502, 6889, 7298, 7732,
+     8192, 8679, 9195, 9742,10321,10935,11585,12274,13004,13777,14596,15464,
+    16384,17358,18390,19484,20643,21870,23170,24548,26008,27554,29193,30929,
+};
+
+static const u8 song_field[128] = {
+      76,  48,   0,   0,  79,   1,   0,   0,  81,  48,   0,   0,  79,  43,   0,   0,
+      76,  48,   0,   0,  74,   1,   0,   0,  72,  48,   0,   0,   1,  43,   0,   0,
+      74,  45,   0,   0,  76,   1,   0,   0,  79,  45,   0,   0,  76,  52,   0,   0,
+      74,  45,   0,   0,  72,   1,   0,   0,  69,  45,   0,   0,   1,  52,   0,   0,
+      72,  41,   0,   0,  74,   1,   0,   0,  76,  41,   0,   0,  79,  48,   0,   0,
+      81,  41,   0,   0,  79,   1,   0,   0,  76,  41,   0,   0,  74,  48,   0,   0,
+      76,  43,   0,   0,   0,   1,   0,   0,  74,  43,   0,   0,   0,  50,   0,   0,
+      72,  43,   0,   0,   0,   1,   0,   0,   1,  47,   0,   0,   0,  50,   0,   0,
+};
+
+const SoundSong soundSongs[SONG_COUNT] = {
+    { song_field, 64, 0, 8, 2, { SND_SQUARE, SND_TRIANGLE }, { 10, 16 } },
+};
@@ -0,0 +1,26 @@
+// Auto-generated by build_sounds.py — DO NOT EDIT
+#ifndef SOUNDS_H
+#define SOUNDS_H
+
+#include "sound.h"
+
+#define SFX_SLASH 0
+#define SFX_HIT 1
+#define SFX_JUMP 2
+#define SFX_LAND 3
+#define SFX_SPLASH 4
+#define SFX_CHIME 5
+#define SFX_COUNT 6
+#define SND_SQUARE 6
+#define SND_TRIANGLE 7
+#define SND_SAMPLES 8
+
+#define SONG_FIELD 0
+#define SONG_COUNT 1
+#define SOUND_NOTE_HI 96
+
+extern const SoundSample soundSamples[SND_SAMPLES];
+extern const SoundSong soundSongs[SONG_COUNT];
+extern const u16 soundNotePitch[60];
+
+#endif // SOUNDS_H
@@ -0,0 +1,64 @@
+// Auto-generated by build_triggers.py — DO NOT EDIT
+#include "triggers.h"
+
+// 24 triggers, sorted by first column
+const TriggerDef trigDefs[TRIG_COUNT] = {
+    {   0,  37,  0, 15, TRIG_ZONE, ZONE_MEADOW, 0, 0 },  // meadow
+    {   2,   4,  4, 10, TRIG_CHECKPOINT, 0, 0, 0 },  // cp_start
+    {  17,  17,  2,  2, TRIG_PICKUP, 0, TRIG_ONCE, 0 },  // cache_hill1
+    {  35,  37,  4, 10, TRIG_CHECKPOINT, 1, 0, 0 },  // cp_ford
+    {  38,  39,  0, 15, TRIG_CUTSCENE, 0, TRIG_ONCE, 0 },  // cs_river
+    {  38,  57,  0, 15, TRIG_ZONE, ZONE_RIVER, 0, 0 },  // river
+    {  58,  79,  0, 15, TRIG_ZONE, ZONE_HILLS, 0, 0 },  // hills
+    {  62,  62,  3,  3, TRIG_PICKUP, 1, TRIG_ONCE, 0 },  // cache_hill2
+    {  78,  80,  4, 10, TRIG_CHECKPOINT, 2, 0, 0 },  // cp_fields
+    {  80,  99,  0, 15, TRIG_ZONE, ZONE_FIELDS, 0, 0 },  // fields
+    {  97,  99,  4, 10, TRIG_CHECKPOINT, 3, 0, 0 },  // cp_lake
+    { 100, 119,  0, 15, TRIG_ZONE, ZONE_LAKE, 0, 0 },  // lake
+    { 107, 108,  6,  7, TRIG_PICKUP, 2, TRIG_ONCE, 0 },  // cache_shore
+    { 120, 147,  0, 15, TRIG_ZONE, ZONE_HIGHLANDS, 0, 0 },  // highlands
+    { 127, 127, 12, 12, TRIG_PICKUP, 3, TRIG_ONCE, 0 },  // cache_hill3
+    { 144, 147,  4, 10, TRIG_CHECKPOINT, 4, 0, 0 },  // cp_gate
+    { 148, 149,  5, 10, TRIG_CUTSCENE, 1, TRIG_ONCE, 0 },  // cs_gate
+    { 148, 172,  0, 15, TRIG_ZONE, ZONE_FORTRESS, 0, 0 },  // fortress
+    { 155, 165,  6,  9, TRIG_CUTSCENE, 2, TRIG_ONCE, 0 },  // cs_hall
+    { 160, 160,  7,  8, TRIG_PICKUP, 4, TRIG_ONCE, 0 },  // cache_roof
+    { 172, 174,  4, 10, TRIG_CHECKPOINT, 5, 0, 0 },  // cp_ruins
+    { 173, 199,  0, 15, TRIG_ZONE, ZONE_RUINS, 0, 0 },  // ruins
+    { 180, 190,  5, 10, TRIG_CUTSCENE, 3, TRIG_ONCE, 0 },  // cs_ruins
+    { 185, 185,  7,  8, TRIG_PICKUP, 5, TRIG_ONCE, 0 },  // cache_dais
+};
+
+// 25 buckets of 8 columns: trigBucketIds[trigBucketStart[b] .. trigBucketStart[b + 1])
+const unsigned short trigBucketStart[TRIG_BUCKETS + 1] = {
+      0,  2,  3,  5,  6, 10, 11, 12, 15, 16, 18, 20, 21,
+     24, 26, 27, 29, 30, 31, 35, 37, 40, 43, 45, 48, 49,
+};
+
+const unsigned char trigBucketIds[49] = {
+     0, 1,  // cols 0-7
+     0,  // cols 8-15
+     0, 2,  // cols 16-23
+     0,  // cols 24-31
+     0, 3, 4, 5,  // cols 32-39
+     5,  // cols 40-47
+     5,  // cols 48-55
+     5, 6, 7,  // cols 56-63
+     6,  // cols 64-71
+     6, 8,  // cols 72-79
+     8, 9,  // cols 80-87
+     9,  // cols 88-95
+     9,10,11,  // cols 96-103
+    11,12,  // cols 104-111
+    11,  // cols 112-119
+    13,14,  // cols 120-127
+    13,  // cols 128-135
+    13,  // cols 136-143
+    13,15,16,17,  // cols 144-151
+    17,18,  // cols 152-159
+    17,18,19,  // cols 160-167
+    17,20,21,  // cols 168-175
+    21,22,  // cols 176-183
+    21,22,23,  // cols 184-191
+    21,  // cols 192-199
+};
@@ -0,0 +1,16 @@
+// Auto-generated by build_triggers.py — DO NOT EDIT
+#ifndef TRIGGERS_H
+#define TRIGGERS_H
+
+#include "trigger.h"
+
+#define TRIG_COUNT 24
+#define TRIG_BUCKET_SHIFT 3
+#define TRIG_BUCKETS 25
+#define TRIG_BUCKET_MAX 4
+
+extern const TriggerDef trigDefs[TRIG_COUNT];
+extern const unsigned short trigBucketStart[TRIG_BUCKETS + 1];
+extern const unsigned char trigBucketIds[49];
+
+#endif // TRIGGERS_H
@@ -0,0 +1,126 @@
+// bench_compose.c — Compositor benchmark over synthetic worlds
+//
+// Built once per map width (-DMAP_COLS=n) by `make -C host bench-compose`.
+// For each synthetic world (height profile × ground/side variety × feature
+// density) runs precompute_world() and prints one JSON object per line:
+// wall time, stamp counts, hash probe lengths, unique tiles and memory.
+#include "game.h"
+#include "world.h"
+#include "compose.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#ifndef COMPOSE_STATS
+#error "bench_compose needs -DCOMPOSE_STATS"
+#endif
+
+#define BENCH_ITERS 3
+
+enum { H_FLAT, H_ROLLING, H_RUGGED, H_STRIP };
+static const char *const height_names[] = { "flat", "rolling", "rugged", "strip" };
+
+typedef struct {
+    int heights;    // H_*
+    int variety;    // ground/side types in use (1..NUM_GROUND)
+    int density;    // % of cells replaced by a tower or pit feature
+} WorldSpec;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+//=============================================================================
+// Synthetic worlds (all randomness from the game's xorshift, fixed seed)
+//=============================================================================
+static int lattice_h(int lc, int lr) {
+    rng_state = (u32)(lc * 7919 + lr * 104729 + 1);
+    rng_next();
+    return rng_next() % (MAX_HEIGHT + 1);
+}
+
+// Bilinear value noise over an 8×4 cell lattice
+static int rolling_h(int c, int r) {
+    int lc = c / 8, lr = r / 4, fc = c % 8, fr = r % 4;
+    int h00 = lattice_h(lc, lr),     h10 = lattice_h(lc + 1, lr);
+    int h01 = lattice_h(lc, lr + 1), h11 = lattice_h(lc + 1, lr + 1);
+    int top = h00 * (8 - fc) + h10 * fc;
+    int bot = h01 * (8 - fc) + h11 * fc;
+    return (top * (4 - fr) + bot * fr + 16) / 32;
+}
+
+static void build_world(const WorldSpec *w) {
+    if (w->heights == H_STRIP) {
+        generate_world();
+        return;
+    }
+    for (int r = 0; r < MAP_ROWS; r++) {
+        for (int c = 0; c < MAP_COLS; c++) {
+            MapCell *cell = &world_map[r][c];
+            int h = 1;
+            if (w->heights == H_ROLLING) h = rolling_h(c, r);
+            else if (w->heights == H_RUGGED) h = lattice_h(c, r);
+
+            rng_state = (u32)(c * 31 + r * 97 + 12345);
+            rng_next();
+            int kind = rng_next() % w->variety;
+            if ((int)(rng_next() % 100) < w->density) {
+                if (rng_next() & 1) { kind = GROUND_ROOF; h = MAX_HEIGHT; }
+                else                { kind = GROUND_WATER; h = 0; }
+            }
+            cell->ground = (u8)kind;
+            cell->side = (u8)kind;
+            cell->height = (u8)h;
+        }
+    }
+}
+
+//=============================================================================
+// One run → one JSON line
+//=============================================================================
+static void run(const WorldSpec *w) {
+    build_world(w);
+
+    double best = 1e9;
+    for (int i = 0; i < BENCH_ITERS; i++) {
+        double t0 = now_sec();
+        precompute_world();
+        double t = now_sec() - t0;
+        if (t < best) best = t;
+    }
+
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    const ComposeStats *st = &compose_stats;
+    printf("{\"map_cols\":%d,\"heights\":\"%s\",\"variety\":%d,\"density\":%d,"
+           "\"ms\":%.3f,\"stamps_top\":%u,\"stamps_side\":%u,\"lookups\":%u,"
+           "\"probe_avg\":%.3f,\"probe_max\":%u,\"unique_tiles\":%d,\"dict_full\":%u,"
+           "\"tilemap_bytes\":%u,\"dict_bytes\":%d,\"peak_rss_kb\":%ld}\n",
+           MAP_COLS, height_names[w->heights], w->variety, w->density,
+           best * 1e3, st->stamps_top, st->stamps_side, st->lookups,
+           st->lookups ? (double)st->probes / st->lookups : 0.0, st->probe_max,
+           num_tiles, st->dict_full,
+           (unsigned)sizeof(world_tilemap), num_tiles * 64, ru.ru_maxrss);
+    fflush(stdout);
+}
+
+int main(void) {
+    static const int varieties[] = { 1, 3, NUM_GROUND };
+    static const int densities[] = { 0, 10, 30 };
+
+    // The hand-built strip only fits the shipping map width
+    if (MAP_COLS == 200) {
+        WorldSpec w = { H_STRIP, NUM_GROUND, 0 };
+        run(&w);
+    }
+    for (int h = H_FLAT; h <= H_RUGGED; h++)
+        for (int v = 0; v < 3; v++)
+            for (int d = 0; d < 3; d++) {
+                WorldSpec w = { h, varieties[v], densities[d] };
+                run(&w);
+            }
+    return 0;
+}
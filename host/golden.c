@@ -0,0 +1,243 @@
+// golden.c — Golden-image and ring-buffer regression harness
+//
+// Two independent renders of the 240×160 viewport are compared:
+//   world: straight from world_tilemap + tile_dict (what the compositor built)
+//   hw:    from fake VRAM — BG0CNT, scroll registers, the 64×64 ring buffer
+//          and the uploaded charblock (what the GBA would display)
+// `golden` checks the world render against stored PNGs in host/golden/ and
+// the hw render against the world render. `ring` drives the streamer through
+// random scroll sequences and checks the whole ring after every step.
+#include "golden.h"
+#include "game.h"
+#include "world.h"
+#include "compose.h"
+#include "stream.h"
+#include "player.h"
+#include "pngio.h"
+#include "../data/metatiles.h"
+#include <stdio.h>
+
+#define GOLDEN_DIR  "golden"
+
+typedef struct {
+    const char *name;
+    int col, row;       // camera centred on this map cell (at its height)
+} GoldenView;
+
+static const GoldenView golden_views[] = {
+    { "start",      3,  8 },
+    { "hill1",     17,  2 },
+    { "river",     47,  7 },
+    { "lake",     107, 11 },
+    { "hill3",    127, 12 },
+    { "fortress", 160,  7 },
+    { "ruins",    185,  8 },
+    { "west_edge",  0, 15 },
+    { "east_edge", 199, 0 },
+};
+#define NUM_GOLDEN_VIEWS ((int)(sizeof(golden_views) / sizeof(golden_views[0])))
+
+static u8 view_world[SCREEN_W * SCREEN_H];
+static u8 view_hw[SCREEN_W * SCREEN_H];
+static u8 view_golden[SCREEN_W * SCREEN_H];
+
+//=============================================================================
+// Boot: same BG setup as main()
+//=============================================================================
+static void golden_boot(void) {
+    host_reset();
+    generate_world();
+    compute_world_bounds();
+    precompute_world();
+    upload_tiles_to_vram();
+    for (int i = 0; i < MT_PALETTE_SIZE; i++)
+        pal_bg_mem[i] = mt_palette[i];
+    pal_bg_mem[0] = RGB15(2, 2, 5);
+    REG_BG0CNT = stream_bg0cnt();
+    REG_DISPCNT = DCNT_MODE0 | DCNT_BG0 | DCNT_OBJ | DCNT_OBJ_1D;
+    player_init();
+    camera.x = player.world_x;
+    camera.y = player.world_y;
+    stream_init(FP2INT(camera.x), FP2INT(camera.y));
+}
+
+// Move the camera to a cell the way camera_update() would settle on it
+static void camera_to_cell(int col, int row) {
+    int wx, wy;
+    iso_tile_to_world(col, row, &wx, &wy);
+    player.world_x = INT2FP(wx);
+    player.world_y = INT2FP(wy);
+    player.height = world_map[row][col].height;
+    camera.x = player.world_x;
+    camera.y = player.world_y - INT2FP(player.height * SIDE_HEIGHT);
+    camera_update();   // target == position: only applies the clamps
+}
+
+//=============================================================================
+// Renders
+//=============================================================================
+static void render_world(int cam_wx, int cam_wy, u8 *out) {
+    for (int y = 0; y < SCREEN_H; y++) {
+        int wpy = cam_wy - SCREEN_H / 2 + y - WORLD_PX_Y0;
+        for (int x = 0; x < SCREEN_W; x++) {
+            int wpx = cam_wx - SCREEN_W / 2 + x - WORLD_PX_X0;
+            u8 p = 0;
+            if (wpx >= 0 && wpy >= 0 && wpx < WORLD_TILE_W * 8 && wpy < WORLD_TILE_H * 8) {
+                int tid = world_tilemap[(wpy >> 3) * WORLD_TILE_W + (wpx >> 3)];
+                p = tile_dict[tid][(wpy & 7) * 8 + (wpx & 7)];
+            }
+            out[y * SCREEN_W + x] = p;
+        }
+    }
+}
+
+// Regular BG0, 8bpp, any map size, honouring H/V flip bits
+static void render_hw(u8 *out) {
+    u16 cnt = REG_BG0CNT;
+    const u8 *chars = &host_vram[((cnt >> 2) & 3) * 0x4000];
+    const u16 *map = (const u16 *)se_mem[(cnt >> 8) & 31];
+    int size = cnt >> 14;
+    int map_w = (size & 1) ? 64 : 32;
+    int map_h = (size & 2) ? 64 : 32;
+    int hofs = REG_BG0HOFS, vofs = REG_BG0VOFS;
+
+    for (int y = 0; y < SCREEN_H; y++) {
+        int by = (y + vofs) & (map_h * 8 - 1);
+        for (int x = 0; x < SCREEN_W; x++) {
+            int bx = (x + hofs) & (map_w * 8 - 1);
+            int tc = bx >> 3, tr = by >> 3;
+            int sb = (tc >> 5) + (tr >> 5) * (map_w >> 5);
+            u16 se = map[sb * 1024 + (tr & 31) * 32 + (tc & 31)];
+            int px = bx & 7, py = by & 7;
+            if (se & 0x0400) px = 7 - px;
+            if (se & 0x0800) py = 7 - py;
+            out[y * SCREEN_W + x] = chars[(se & 0x3FF) * 64 + py * 8 + px];
+        }
+    }
+}
+
+static int count_diff(const u8 *a, const u8 *b) {
+    int n = 0;
+    for (int i = 0; i < SCREEN_W * SCREEN_H; i++) n += a[i] != b[i];
+    return n;
+}
+
+// Every ring entry must hold the world tile of its loaded window position
+static int check_ring(void) {
+    int bad = 0;
+    for (int i = 0; i < 64; i++) {
+        int wtr = loaded_row_min + i;
+        for (int j = 0; j < 64; j++) {
+            int wtc = loaded_col_min + j;
+            u16 want = 0;
+            if (wtc >= 0 && wtc < WORLD_TILE_W && wtr >= 0 && wtr < WORLD_TILE_H)
+                want = world_tilemap[wtr * WORLD_TILE_W + wtc];
+            int hc = wtc & 63, hr = wtr & 63;
+            u16 got = se_mem[stream_sbb[stream_set] + (hc >> 5) + (hr >> 5) * 2][(hr & 31) * 32 + (hc & 31)];
+            bad += got != want;
+        }
+    }
+    return bad;
+}
+
+//=============================================================================
+// Commands
+//=============================================================================
+int golden_hw_diff(int cam_wx, int cam_wy) {
+    render_world(cam_wx, cam_wy, view_world);
+    render_hw(view_hw);
+    return count_diff(view_world, view_hw);
+}
+
+int golden_main(int update) {
+    golden_boot();
+    int failures = 0;
+
+    for (int v = 0; v < NUM_GOLDEN_VIEWS; v++) {
+        const GoldenView *gv = &golden_views[v];
+        camera_to_cell(gv->col, gv->row);
+        int cam_wx = FP2INT(camera.x), cam_wy = FP2INT(camera.y);
+        update_hw_tilemap(cam_wx, cam_wy);
+        stream_set_scroll(cam_wx, cam_wy);
+
+        render_world(cam_wx, cam_wy, view_world);
+        render_hw(view_hw);
+
+        char path[256];
+        snprintf(path, sizeof(path), GOLDEN_DIR "/%s.png", gv->name);
+
+        int hw_diff = count_diff(view_world, view_hw);
+        int gold_diff = 0;
+        if (update) {
+            if (png_write_indexed(path, view_world, SCREEN_W, SCREEN_H, pal_bg_mem) != 0) {
+                fprintf(stderr, "%s: cannot write\n", path);
+                return 1;
+            }
+        } else if (png_read_indexed(path, view_golden, SCREEN_W, SCREEN_H) != 0) {
+            fprintf(stderr, "%s: missing or unreadable (run `golden-update`)\n", path);
+            gold_diff = -1;
+        } else {
+            gold_diff = count_diff(view_world, view_golden);
+        }
+
+        int fail = hw_diff != 0 || gold_diff != 0;
+        printf("%-10s cam (%5d,%5d)  golden %s  hw %s\n", gv->name, cam_wx, cam_wy,
+               update ? "written" : gold_diff == 0 ? "ok" : "MISMATCH",
+               hw_diff ? "MISMATCH" : "ok");
+        if (gold_diff > 0)
+            printf("           %d pixels differ from %s\n", gold_diff, path);
+        if (hw_diff)
+            printf("           %d pixels differ between world and hw renders\n", hw_diff);
+        if (fail) {
+            char out[256];
+            snprintf(out, sizeof(out), "build/%s.world.png", gv->name);
+            png_write_indexed(out, view_world, SCREEN_W, SCREEN_H, pal_bg_mem);
+            snprintf(out, sizeof(out), "build/%s.hw.png", gv->name);
+            png_write_indexed(out, view_hw, SCREEN_W, SCREEN_H, pal_bg_mem);
+            failures++;
+        }
+    }
+    printf("golden: %d/%d views ok\n", NUM_GOLDEN_VIEWS - failures, NUM_GOLDEN_VIEWS);
+    return failures ? 1 : 0;
+}
+
+int ring_main(u32 seed, long steps) {
+    golden_boot();
+    u32 r = seed ? seed : 1;
+    int cam_wx = FP2INT(camera.x), cam_wy = FP2INT(camera.y);
+    int x_min = FP2INT(bound_wx_min), x_max = FP2INT(bound_wx_max);
+    int y_min = FP2INT(bound_wy_min) - MAX_HEIGHT * SIDE_HEIGHT;
+    int y_max = FP2INT(bound_wy_max);
+
+    for (long s = 0; s < steps; s++) {
+        r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+        if ((r & 63) == 0) {
+            // Teleport (zone warp, respawn)
+            cam_wx = x_min + (int)((r >> 8) % (u32)(x_max - x_min + 1));
+            cam_wy = y_min + (int)((r >> 4) % (u32)(y_max - y_min + 1));
+        } else {
+            // Scroll up to 24 px per axis per step
+            cam_wx += (int)((r >> 8) % 49) - 24;
+            cam_wy += (int)((r >> 16) % 49) - 24;
+        }
+        if (cam_wx < x_min) cam_wx = x_min;
+        if (cam_wx > x_max) cam_wx = x_max;
+        if (cam_wy < y_min) cam_wy = y_min;
+        if (cam_wy > y_max) cam_wy = y_max;
+
+        update_hw_tilemap(cam_wx, cam_wy);
+        stream_set_scroll(cam_wx, cam_wy);
+
+        int ring_bad = check_ring();
+        render_world(cam_wx, cam_wy, view_world);
+        render_hw(view_hw);
+        int px_bad = count_diff(view_world, view_hw);
+        if (ring_bad || px_bad) {
+            fprintf(stderr, "ring: step %ld cam (%d,%d): %d ring entries, %d pixels wrong\n",
+                    s, cam_wx, cam_wy, ring_bad, px_bad);
+            return 1;
+        }
+    }
+    printf("ring: %ld scroll steps ok (seed %u)\n", steps, seed);
+    return 0;
+}
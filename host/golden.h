@@ -0,0 +1,15 @@
+// golden.h — Golden-image and ring-buffer regression harness
+#ifndef GOLDEN_H
+#define GOLDEN_H
+
+#include "platform.h"
+
+// Compare viewport renders against host/golden/*.png (update=1 rewrites them)
+int golden_main(int update);
+// Random scroll sequence; checks ring buffer + hw render after every step
+int ring_main(u32 seed, long steps);
+// Pixels differing between the world render at camera (cam_wx, cam_wy) and
+// fake VRAM as the registers show it (BG0CNT, scroll)
+int golden_hw_diff(int cam_wx, int cam_wy);
+
+#endif // GOLDEN_H
@@ -0,0 +1,153 @@
+// host_platform.c — Fake VRAM/OAM/SRAM/keypad backend for native builds
+#include "platform.h"
+
+u8  host_vram[0x18000];
+u16 host_pal[0x200];
+OBJ_ATTR host_oam[128];
+u8  host_sram[0x8000];
+u16 host_io[0x200];
+volatile DMA_REC host_dma[4];
+
+u16 __key_curr, __key_prev;
+u32 host_vblanks;
+
+static fnptr isr_table[II_MAX];
+
+void host_reset(void) {
+    memset(host_vram, 0, sizeof(host_vram));
+    memset(host_pal, 0, sizeof(host_pal));
+    memset(host_oam, 0, sizeof(host_oam));
+    memset(host_io, 0, sizeof(host_io));
+    memset((void *)host_dma, 0, sizeof(host_dma));
+    memset(isr_table, 0, sizeof(isr_table));
+    // SRAM is battery-backed: an erased cart reads as 0xFF
+    memset(host_sram, 0xFF, sizeof(host_sram));
+    __key_curr = __key_prev = 0;
+    host_vblanks = 0;
+    host_set_keys(0);
+}
+
+void host_set_keys(u16 keys) {
+    REG_KEYINPUT = ~keys & KEY_MASK;
+}
+
+//=============================================================================
+// Interrupts: VBlankIntrWait() "returns" at the start of the next VBlank
+//=============================================================================
+void irq_init(fnptr isr) {
+    (void)isr;
+    memset(isr_table, 0, sizeof(isr_table));
+}
+
+fnptr irq_add(int irq_id, fnptr isr) {
+    fnptr old = isr_table[irq_id];
+    isr_table[irq_id] = isr;
+    return old;
+}
+
+// Fake beam: REG_VCOUNT only moves when the host says so (waits, or
+// host_scanlines() to model CPU time). Each line ends with its HBlank
+// (fired when enabled in REG_IE); crossing line 160 fires VBlank.
+void host_scanlines(int n) {
+    for (int i = 0; i < n; i++) {
+        if ((REG_IE & IRQ_HBLANK) && isr_table[II_HBLANK]) isr_table[II_HBLANK]();
+        int vc = REG_VCOUNT + 1;
+        if (vc >= 228) vc = 0;
+        REG_VCOUNT = vc;
+        if (vc == 160) {
+            host_vblanks++;
+            if (isr_table[II_VBLANK]) isr_table[II_VBLANK]();
+        }
+    }
+}
+
+void VBlankIntrWait(void) {
+    do host_scanlines(1); while (REG_VCOUNT != 160);
+}
+
+// VCount wait: run the beam to the DISPSTAT target line
+void IntrWait(u32 flag_clear, u32 irq) {
+    (void)flag_clear;
+    if (irq & IRQ_VBLANK) VBlankIntrWait();
+    else if (irq & IRQ_VCOUNT) {
+        int target = REG_DISPSTAT >> 8;
+        do host_scanlines(1); while (REG_VCOUNT != target);
+    }
+}
+
+void host_elapse(int frames) {
+    for (int i = 0; i < frames; i++)
+        if (isr_table[II_VBLANK]) isr_table[II_VBLANK]();
+}
+
+//=============================================================================
+// Copies
+//=============================================================================
+void memcpy16(void *dst, const void *src, u32 hwcount) {
+    memcpy(dst, src, hwcount * 2);
+}
+
+void memcpy32(void *dst, const void *src, u32 wcount) {
+    memcpy(dst, src, wcount * 4);
+}
+
+// Like tonc's, copies size / 4 words: a tail of 1..3 bytes is not copied
+void dma3_cpy(void *dst, const void *src, u32 size) {
+    memcpy(dst, src, size & ~3u);
+}
+
+// Header: type in bits 4-7, decompressed size in bits 8-31
+static void lz77_uncomp(const u8 *s, u8 *d) {
+    u32 size = (s[1] | s[2] << 8 | s[3] << 16), n = 0;
+    s += 4;
+    while (n < size) {
+        u8 flags = *s++;
+        for (int b = 0; b < 8 && n < size; b++, flags <<= 1) {
+            if (!(flags & 0x80)) {
+                d[n++] = *s++;
+                continue;
+            }
+            int len = (s[0] >> 4) + 3;
+            int disp = ((s[0] & 15) << 8 | s[1]) + 1;
+            s += 2;
+            for (int i = 0; i < len && n < size; i++, n++) d[n] = d[n - disp];
+        }
+    }
+}
+
+static void rl_uncomp(const u8 *s, u8 *d) {
+    u32 size = (s[1] | s[2] << 8 | s[3] << 16), n = 0;
+    s += 4;
+    while (n < size) {
+        u8 flag = *s++;
+        if (flag & 0x80) {
+            for (int i = 0, len = (flag & 0x7F) + 3; i < len && n < size; i++) d[n++] = *s;
+            s++;
+        } else {
+            for (int i = 0, len = flag + 1; i < len && n < size; i++) d[n++] = *s++;
+        }
+    }
+}
+
+void LZ77UnCompWram(const void *src, void *dst) { lz77_uncomp(src, dst); }
+void LZ77UnCompVram(const void *src, void *dst) { lz77_uncomp(src, dst); }
+void RLUnCompWram(const void *src, void *dst)   { rl_uncomp(src, dst); }
+void RLUnCompVram(const void *src, void *dst)   { rl_uncomp(src, dst); }
+
+void oam_init(OBJ_ATTR *obj, u32 count) {
+    for (u32 i = 0; i < count; i++) {
+        obj[i].attr0 = ATTR0_HIDE;
+        obj[i].attr1 = 0;
+        obj[i].attr2 = 0;
+    }
+    oam_copy(oam_mem, obj, count);
+}
+
+void oam_copy(OBJ_ATTR *dst, const OBJ_ATTR *src, u32 count) {
+    for (u32 i = 0; i < count; i++) {
+        dst[i].attr0 = src[i].attr0;
+        dst[i].attr1 = src[i].attr1;
+        dst[i].attr2 = src[i].attr2;
+        dst[i].fill = src[i].fill;      // affine matrices
+    }
+}
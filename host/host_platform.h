@@ -0,0 +1,216 @@
+// host_platform.h — Native stand-in for the libtonc subset in platform.h
+//
+// VRAM, palette, OAM, SRAM and I/O registers are plain arrays so engine
+// code runs unchanged on a Linux box. Only names the engine uses are here;
+// add to this file (not to engine code) when a module needs more of tonc.
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef uint8_t  u8;   typedef int8_t  s8;
+typedef uint16_t u16;  typedef int16_t s16;
+typedef uint32_t u32;  typedef int32_t s32;
+typedef volatile u8  vu8;  typedef volatile s8  vs8;
+typedef volatile u16 vu16; typedef volatile s16 vs16;
+typedef volatile u32 vu32; typedef volatile s32 vs32;
+
+typedef u16 COLOR;
+typedef u16 SCR_ENTRY;
+typedef struct { u32 data[8]; } TILE;
+typedef TILE CHARBLOCK[512];
+typedef SCR_ENTRY SCREENBLOCK[1024];
+
+typedef struct {
+    u16 attr0, attr1, attr2;
+    s16 fill;
+} __attribute__((aligned(4))) OBJ_ATTR;
+
+typedef void (*fnptr)(void);
+
+#define INLINE     static inline
+#define EWRAM_DATA
+#define EWRAM_BSS
+#define IWRAM_DATA
+#define IWRAM_CODE
+
+//=============================================================================
+// Fake memory (host_platform.c)
+//=============================================================================
+extern u8  host_vram[0x18000];
+extern u16 host_pal[0x200];
+extern OBJ_ATTR host_oam[128];
+extern u8  host_sram[0x8000];
+extern u16 host_io[0x200];        // I/O registers, indexed by offset / 2
+
+#define tile_mem     ((CHARBLOCK *)host_vram)
+#define se_mem       ((SCREENBLOCK *)host_vram)
+#define pal_bg_mem   ((COLOR *)host_pal)
+#define pal_obj_mem  ((COLOR *)&host_pal[0x100])
+#define oam_mem      (host_oam)
+#define sram_mem     (host_sram)
+
+// DMA channels keep real pointers here; nothing is transferred
+typedef struct { const void *src; void *dst; u32 cnt; } DMA_REC;
+extern volatile DMA_REC host_dma[4];
+#define REG_DMA      (host_dma)
+
+#define HOST_REG(ofs)  (*(vu16 *)&host_io[(ofs) >> 1])
+// 32-bit registers alias the u16 array
+typedef volatile u32 __attribute__((may_alias)) host_vu32;
+#define HOST_REG32(ofs) (*(host_vu32 *)&host_io[(ofs) >> 1])
+
+#define REG_DISPCNT    HOST_REG(0x0000)
+#define REG_DISPSTAT   HOST_REG(0x0004)
+#define REG_VCOUNT     HOST_REG(0x0006)
+#define REG_BG0CNT     HOST_REG(0x0008)
+#define REG_BG0HOFS    HOST_REG(0x0010)
+#define REG_BG0VOFS    HOST_REG(0x0012)
+#define REG_MOSAIC     HOST_REG(0x004C)
+#define REG_BLDCNT     HOST_REG(0x0050)
+#define REG_BLDY       HOST_REG(0x0054)
+#define REG_SNDDSCNT   HOST_REG(0x0082)
+#define REG_SNDSTAT    HOST_REG(0x0084)
+#define REG_FIFO_A     HOST_REG32(0x00A0)
+#define REG_TM0D       HOST_REG(0x0100)
+#define REG_TM0CNT     HOST_REG(0x0102)
+#define REG_TM1D       HOST_REG(0x0104)
+#define REG_TM1CNT     HOST_REG(0x0106)
+#define REG_TM2D       HOST_REG(0x0108)
+#define REG_TM2CNT     HOST_REG(0x010A)
+#define REG_TM3D       HOST_REG(0x010C)
+#define REG_TM3CNT     HOST_REG(0x010E)
+#define REG_KEYINPUT   HOST_REG(0x0130)
+#define REG_IE         HOST_REG(0x0200)
+
+//=============================================================================
+// Constants (values match libtonc)
+//=============================================================================
+#define RGB15(r, g, b)  ((r) | ((g) << 5) | ((b) << 10))
+
+#define DCNT_MODE0     0x0000
+#define DCNT_OAM_HBL   0x0020
+#define DCNT_OBJ_1D    0x0040
+#define DCNT_BG0       0x0100
+#define DCNT_OBJ       0x1000
+
+#define BG_CBB(n)      ((n) << 2)
+#define BG_SBB(n)      ((n) << 8)
+#define BG_MOSAIC      0x0040
+#define BG_8BPP        0x0080
+#define BG_SIZE3       0xC000
+#define BG_PRIO(n)     (n)
+
+#define MOS_BH(n)      ((n) & 15)
+#define MOS_BV(n)      (((n) & 15) << 4)
+
+#define BLD_BG0        0x0001
+#define BLD_OBJ        0x0010
+#define BLD_BD         0x0020
+#define BLD_BLACK      0x00C0
+
+#define ATTR0_Y(n)     ((n) & 0xFF)
+#define ATTR0_SQUARE   0x0000
+#define ATTR0_WIDE     0x4000
+#define ATTR0_TALL     0x8000
+#define ATTR0_4BPP     0x0000
+#define ATTR0_HIDE     0x0200
+#define ATTR0_AFF      0x0100
+#define ATTR0_AFF_DBL  0x0300
+#define ATTR1_X(n)     ((n) & 0x1FF)
+#define ATTR1_HFLIP    0x1000
+#define ATTR1_AFF_ID(n) (((n) & 31) << 9)
+#define ATTR1_SIZE_8   0x0000
+#define ATTR1_SIZE_16  0x4000
+#define ATTR1_SIZE_32  0x8000
+#define ATTR2_ID(n)    ((n) & 0x3FF)
+#define ATTR2_PRIO(n)  (((n) & 3) << 10)
+#define ATTR2_PALBANK(n) (((n) & 15) << 12)
+
+#define SDS_A100       0x0004
+#define SDS_AR         0x0100
+#define SDS_AL         0x0200
+#define SDS_ATMR0      0x0000
+#define SDS_ARESET     0x0800
+#define SSTAT_ENABLE   0x0080
+
+#define DMA_DST_FIXED  0x00400000
+#define DMA_REPEAT     0x02000000
+#define DMA_32         0x04000000
+#define DMA_AT_FIFO    0x30000000
+#define DMA_ENABLE     0x80000000
+
+#define TM_FREQ_1      0x0000
+#define TM_FREQ_64     0x0001
+#define TM_CASCADE     0x0004
+#define TM_ENABLE      0x0080
+
+#define KEY_A          0x0001
+#define KEY_B          0x0002
+#define KEY_SELECT     0x0004
+#define KEY_START      0x0008
+#define KEY_RIGHT      0x0010
+#define KEY_LEFT       0x0020
+#define KEY_UP         0x0040
+#define KEY_DOWN       0x0080
+#define KEY_R          0x0100
+#define KEY_L          0x0200
+#define KEY_MASK       0x03FF
+
+#define IRQ_VBLANK     0x0001
+#define IRQ_HBLANK     0x0002
+#define IRQ_VCOUNT     0x0004
+
+enum { II_VBLANK = 0, II_HBLANK, II_VCOUNT, II_TIMER0, II_TIMER1,
+       II_TIMER2, II_TIMER3, II_SERIAL, II_DMA0, II_DMA1, II_DMA2,
+       II_DMA3, II_KEYPAD, II_GAMEPAK, II_MAX };
+
+//=============================================================================
+// Keys (same semantics as tonc_input.h)
+//=============================================================================
+extern u16 __key_curr, __key_prev;
+
+INLINE void key_poll(void) {
+    __key_prev = __key_curr;
+    __key_curr = ~REG_KEYINPUT & KEY_MASK;
+}
+INLINE u32 key_is_down(u32 key) { return __key_curr & key; }
+INLINE u32 key_hit(u32 key)     { return (__key_curr & ~__key_prev) & key; }
+
+//=============================================================================
+// System calls and helpers
+//=============================================================================
+void  irq_init(fnptr isr);
+fnptr irq_add(int irq_id, fnptr isr);
+void  VBlankIntrWait(void);
+void  IntrWait(u32 flag_clear, u32 irq);
+
+void memcpy16(void *dst, const void *src, u32 hwcount);
+void memcpy32(void *dst, const void *src, u32 wcount);
+void dma3_cpy(void *dst, const void *src, u32 size);   // size in bytes, whole words
+
+// BIOS decompression (GBA stream formats; Vram variants write halfwords)
+void LZ77UnCompWram(const void *src, void *dst);
+void LZ77UnCompVram(const void *src, void *dst);
+void RLUnCompWram(const void *src, void *dst);
+void RLUnCompVram(const void *src, void *dst);
+
+void oam_init(OBJ_ATTR *obj, u32 count);
+void oam_copy(OBJ_ATTR *dst, const OBJ_ATTR *src, u32 count);
+
+//=============================================================================
+// Host-only controls
+//=============================================================================
+extern u32 host_vblanks;           // VBlanks the fake beam has crossed
+
+void host_reset(void);             // clear all fake memory and key state
+void host_set_keys(u16 keys);      // drive REG_KEYINPUT (active-high KEY_*)
+void host_elapse(int frames);      // let VBlanks pass without waiting (stall)
+void host_scanlines(int n);        // advance REG_VCOUNT, firing VBlank at line 160
+
+#endif // HOST_PLATFORM_H
@@ -0,0 +1,147 @@
+// pngio.c — Minimal 8-bit indexed PNG reader/writer (zlib) for host tools
+//
+// Only what the golden-image harness needs: color type 3, bit depth 8,
+// no interlace. Rows are written with filter 0; the reader also undoes
+// the standard filters so goldens re-saved by other tools still load.
+#include "pngio.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <zlib.h>
+
+static const u8 png_sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+static void put_be32(u8 *p, u32 v) {
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static u32 get_be32(const u8 *p) {
+    return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | p[3];
+}
+
+static void write_chunk(FILE *f, const char *type, const u8 *data, u32 len) {
+    u8 hdr[8];
+    put_be32(hdr, len);
+    memcpy(hdr + 4, type, 4);
+    fwrite(hdr, 1, 8, f);
+    if (len) fwrite(data, 1, len, f);
+    u32 crc = crc32(0, hdr + 4, 4);
+    crc = crc32(crc, data, len);
+    u8 c[4];
+    put_be32(c, crc);
+    fwrite(c, 1, 4, f);
+}
+
+int png_write_indexed(const char *path, const u8 *pixels, int w, int h,
+                      const u16 *pal) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+
+    u8 ihdr[13];
+    put_be32(ihdr, w);
+    put_be32(ihdr + 4, h);
+    ihdr[8] = 8;    // bit depth
+    ihdr[9] = 3;    // indexed color
+    ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+    u8 plte[256 * 3];
+    for (int i = 0; i < 256; i++) {
+        // BGR555 → RGB888 (replicate top bits into the low bits)
+        int r = pal[i] & 31, g = (pal[i] >> 5) & 31, b = (pal[i] >> 10) & 31;
+        plte[i * 3 + 0] = (r << 3) | (r >> 2);
+        plte[i * 3 + 1] = (g << 3) | (g >> 2);
+        plte[i * 3 + 2] = (b << 3) | (b >> 2);
+    }
+
+    uLong raw_len = (uLong)(w + 1) * h;
+    u8 *raw = malloc(raw_len);
+    for (int y = 0; y < h; y++) {
+        raw[y * (w + 1)] = 0;   // filter: none
+        memcpy(&raw[y * (w + 1) + 1], &pixels[y * w], w);
+    }
+    uLong z_len = compressBound(raw_len);
+    u8 *z = malloc(z_len);
+    compress2(z, &z_len, raw, raw_len, 9);
+
+    fwrite(png_sig, 1, 8, f);
+    write_chunk(f, "IHDR", ihdr, 13);
+    write_chunk(f, "PLTE", plte, sizeof(plte));
+    write_chunk(f, "IDAT", z, (u32)z_len);
+    write_chunk(f, "IEND", (const u8 *)0, 0);
+
+    free(raw);
+    free(z);
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+static int paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+int png_read_indexed(const char *path, u8 *pixels, int w, int h) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    u8 *file = malloc(size);
+    int ok = fread(file, 1, size, f) == (size_t)size;
+    fclose(f);
+    if (!ok || size < 8 || memcmp(file, png_sig, 8) != 0) { free(file); return -1; }
+
+    // Gather IHDR + IDAT
+    u8 *idat = malloc(size);
+    uLong idat_len = 0;
+    int pw = 0, ph = 0, depth = 0, ctype = 0, interlace = 0;
+    for (long pos = 8; pos + 12 <= size; ) {
+        u32 len = get_be32(file + pos);
+        const u8 *type = file + pos + 4, *data = file + pos + 8;
+        if (pos + 12 + (long)len > size) break;
+        if (!memcmp(type, "IHDR", 4)) {
+            pw = get_be32(data); ph = get_be32(data + 4);
+            depth = data[8]; ctype = data[9]; interlace = data[12];
+        } else if (!memcmp(type, "IDAT", 4)) {
+            memcpy(idat + idat_len, data, len);
+            idat_len += len;
+        }
+        pos += 12 + len;
+    }
+    free(file);
+    if (pw != w || ph != h || depth != 8 || ctype != 3 || interlace != 0) {
+        free(idat);
+        return -1;
+    }
+
+    uLong raw_len = (uLong)(w + 1) * h;
+    u8 *raw = malloc(raw_len);
+    int zr = uncompress(raw, &raw_len, idat, idat_len);
+    free(idat);
+    if (zr != Z_OK || raw_len != (uLong)(w + 1) * h) { free(raw); return -1; }
+
+    // Undo row filters (bpp = 1)
+    for (int y = 0; y < h; y++) {
+        const u8 *in = &raw[y * (w + 1) + 1];
+        u8 *out = &pixels[y * w];
+        const u8 *up = y ? &pixels[(y - 1) * w] : (const u8 *)0;
+        int filter = raw[y * (w + 1)];
+        for (int x = 0; x < w; x++) {
+            int a = x ? out[x - 1] : 0;
+            int b = up ? up[x] : 0;
+            int c = (x && up) ? up[x - 1] : 0;
+            int p;
+            switch (filter) {
+                case 0: p = 0; break;
+                case 1: p = a; break;
+                case 2: p = b; break;
+                case 3: p = (a + b) / 2; break;
+                case 4: p = paeth(a, b, c); break;
+                default: free(raw); return -1;
+            }
+            out[x] = (u8)(in[x] + p);
+        }
+    }
+    free(raw);
+    return 0;
+}
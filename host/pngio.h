@@ -0,0 +1,15 @@
+// pngio.h — Minimal 8-bit indexed PNG reader/writer (zlib) for host tools
+#ifndef PNGIO_H
+#define PNGIO_H
+
+#include "platform.h"
+
+// Write w×h palette indices with a 256-entry BGR555 palette
+int png_write_indexed(const char *path, const u8 *pixels, int w, int h,
+                      const u16 *pal);
+
+// Read an 8-bit indexed PNG written by png_write_indexed(); fills `pixels`
+// (w*h bytes). Returns 0 on success, -1 on I/O/format error or size mismatch.
+int png_read_indexed(const char *path, u8 *pixels, int w, int h);
+
+#endif // PNGIO_H
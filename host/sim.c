@@ -0,0 +1,1617 @@
+// sim.c — Headless driver for the engine core
+//
+//   isogame-host bench  [-n iters]                      time world build
+//   isogame-host replay [-o period]                     run the benchmark route,
+//                                                       optionally stalling 2 frames
+//                                                       every `period` iterations
+//   isogame-host fuzz   [-s seed] [-n frames]           random input + invariants
+//   isogame-host sweep  [-j jobs] [-s seed] [-c count] [-n frames]
+//                                                       fuzz many seeds in parallel
+//   isogame-host golden [update]                        viewport renders vs PNGs
+//   isogame-host ring   [-s seed] [-n steps]            ring buffer scroll check
+//   isogame-host entities                               actor pool and broadphase
+//                                                       pair tests over the benchmark
+//                                                       route, plus a 64-actor stress
+//   isogame-host sprites [-n frames]                    depth sort of 128 drifting
+//                                                       sprites, warm vs cold, and a
+//                                                       97-sprite crowd vs the
+//                                                       scanline budget
+//   isogame-host mux [-n frames]                        224 sprites through the
+//                                                       HBlank OAM multiplexer,
+//                                                       checked line by line
+//   isogame-host particles [-n frames]                  effects over the benchmark
+//                                                       route, plus ~250 live
+//                                                       particles sharing matrices
+//   isogame-host flow [-n iters]                        flow field over the benchmark
+//                                                       route, rebuild and lookup cost,
+//                                                       every path walked and checked
+//   isogame-host ai [-n steps]                          AI think scheduling over the
+//                                                       route, and the fortress
+//                                                       garrison at three budgets
+//   isogame-host los [-n frames]                        sight lines from the fortress
+//                                                       garrison to a walking player,
+//                                                       cached vs uncached
+//   isogame-host triggers [-n passes]                   trigger events over the benchmark
+//                                                       route, bucketed vs full scan,
+//                                                       and random jumps checked
+//   isogame-host scripts [-n rounds]                    event scripts over the benchmark
+//                                                       route, and SCRIPT_MAX busy
+//                                                       scripts against their slices
+//   isogame-host sound [-n frames]                      mixer over the benchmark route,
+//                                                       cycles per frame for each voice
+//                                                       count and rate, voice stealing
+//   isogame-host save [-n saves]                        autosaves on the benchmark route,
+//                                                       edit/save/reboot/load round trip,
+//                                                       compaction, power cut at every byte
+//   isogame-host assets [-n reps]                       archive index: ROM size and load
+//                                                       time per asset, unpack checks,
+//                                                       zone palettes on the route
+//   isogame-host zones [-n cols]                        zone transitions from the ruins
+//                                                       under three masks: staging cost,
+//                                                       dropped frames, the flip frame
+//   isogame-host govern                                 benchmark route under a
+//                                                       synthetic load, governor on/off
+#include "game.h"
+#include "world.h"
+#include "compose.h"
+#include "stream.h"
+#include "player.h"
+#include "replay.h"
+#include "timing.h"
+#include "present.h"
+#include "govern.h"
+#include "entity.h"
+#include "broadphase.h"
+#include "flowfield.h"
+#include "ai.h"
+#include "los.h"
+#include "sprite.h"
+#include "objvram.h"
+#include "oammux.h"
+#include "affine.h"
+#include "particle.h"
+#include "trigger.h"
+#include "script.h"
+#include "sound.h"
+#include "save.h"
+#include "asset.h"
+#include "warp.h"
+#include "golden.h"
+#include "../data/anim_hero.h"
+#include "../data/triggers.h"
+#include "../data/scripts.h"
+#include "../data/sounds.h"
+#include "../data/archive.h"
+#include "../data/fx.h"
+#include "../data/metatiles.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+//=============================================================================
+// Engine boot + one frame, mirroring main() minus palette/sprite uploads
+//=============================================================================
+static void sim_vblank_isr(void) {
+    sound_rewind();
+    present_commit();
+    asset_vblank();
+    timing_vblank();
+    sound_vblank();
+}
+
+static void sim_boot(void) {
+    host_reset();
+    irq_add(II_VBLANK, sim_vblank_isr);
+    asset_init();
+    generate_world();
+    compute_world_bounds();
+    precompute_world();
+    upload_tiles_to_vram();
+    REG_BG0CNT = stream_bg0cnt();
+    oam_init(obj_buffer, 128);
+    player_init();
+    camera.x = player.world_x;
+    camera.y = player.world_y;
+    stream_init(FP2INT(camera.x), FP2INT(camera.y));
+    entity_init();
+    sprite_init();
+    oammux_init();
+    objvram_init();
+    affine_init();
+    particle_init();
+    trigger_init();
+    script_init();
+    warp_init();
+    sound_init(SOUND_DEFAULT_CHANNELS, SOUND_DEFAULT_RATE);
+    sound_music(SONG_FIELD);
+    save_init();
+    present_init(1);
+    timing_init();
+    gov_init();
+}
+
+#define CYCLES_PER_LINE    1232                     // 308 dots x 4 cycles
+#define CYCLES_PER_FRAME   (228 * CYCLES_PER_LINE)  // 280896
+
+static double to_lines(u32 cycles) {
+    return (double)cycles / CYCLES_PER_LINE;
+}
+
+//=============================================================================
+// Synthetic CPU load (scanlines), charged through the fake beam so the
+// governor, timing and present see real overruns. Actor and particle
+// demand rise around the fortress (cols 150–170); each streamed ring line
+// costs about a scanline (64 entries).
+//=============================================================================
+#define LOAD_LOGIC_BASE    40
+#define LOAD_RENDER_BASE   30
+#define LOAD_AI_ACTOR      6     // lines per thinking actor
+#define LOAD_PARTICLE_X2   3     // half-lines per live particle
+
+static int load_model;
+
+static int in_fortress(void) {
+    return player.tile_col >= 150 && player.tile_col <= 170;
+}
+
+static void charge_logic(void) {
+    if (!load_model) return;
+    int actors = in_fortress() ? 16 : 4;
+    int particles = in_fortress() ? 48 : 8;
+    if (particles > gov_knobs->particle_cap) particles = gov_knobs->particle_cap;
+    // The VBlank mixer, the SRAM save slice and asset loads come out of
+    // the same frame
+    host_scanlines(LOAD_LOGIC_BASE + actors * LOAD_AI_ACTOR / gov_knobs->ai_think_div +
+                   particles * LOAD_PARTICLE_X2 / 2 +
+                   (int)((sound_stats.cycles + save_stats.cycles + asset_stats.cycles) /
+                         CYCLES_PER_LINE));
+}
+
+// One main-loop iteration: fixed-step logic, then render unless behind
+static void sim_frame(void) {
+    int steps = timing_steps_due();
+    present_wait_input(steps == 1);
+    gov_begin_logic();
+    for (int i = 0; i < steps; i++) {
+        replay_poll();
+        present_note_input();
+        player_update();
+        trigger_update(player.tile_col, player.tile_row);
+        asset_update();
+        script_update();
+        warp_update();
+        save_update();
+        camera_update();
+        entity_update();
+        particle_update();
+        charge_logic();
+    }
+    gov_end_logic(steps);
+    if (!timing_render_due())
+        return;
+    present_begin();
+    u32 lines0 = stream_lines;
+    int cam_wx = FP2INT(camera.x), cam_wy = FP2INT(camera.y);
+    warp_render();
+    update_hw_tilemap(cam_wx, cam_wy);
+    u16 hofs, vofs;
+    stream_scroll(cam_wx, cam_wy, &hofs, &vofs);
+    sprite_begin();
+    affine_begin();
+    player_draw();
+    entity_draw();
+    particle_draw();
+    objvram_end_frame();
+    int oam_count = sprite_end();
+    int aff_count = affine_end(obj_buffer);
+    if (aff_count > oam_count) oam_count = aff_count;
+    if (load_model)
+        host_scanlines(LOAD_RENDER_BASE + (int)(stream_lines - lines0) +
+                       (int)(stream_stats.cycles / CYCLES_PER_LINE));
+    present_submit(hofs, vofs, oam_count);
+    gov_end_render();
+}
+
+// Boot and start the benchmark route; the caller steps it with sim_frame()
+static void start_bench_route(void) {
+    sim_boot();
+    replay_start_script(&bench_route);
+    rng_state = replay_seed();
+}
+
+// Boot and play the whole benchmark route
+static void run_bench_route(void) {
+    start_bench_route();
+    while (replay_mode() == REPLAY_PLAY)
+        sim_frame();
+}
+
+// FNV-1a over the player, camera and shown BG map, for determinism checks
+static u32 sim_digest(void) {
+    u32 h = 0x811C9DC5;
+    const u8 *p[] = { (const u8 *)&player, (const u8 *)&camera,
+                      (const u8 *)se_mem[stream_sbb[stream_set]] };
+    const int n[] = { sizeof(player), sizeof(camera), 4 * sizeof(SCREENBLOCK) };
+    for (int k = 0; k < 3; k++)
+        for (int i = 0; i < n[k]; i++) { h ^= p[k][i]; h *= 0x01000193; }
+    return h;
+}
+
+//=============================================================================
+// Invariants checked every fuzz frame; returns NULL if all hold
+//=============================================================================
+static const char *check_invariants(void) {
+    if (player.tile_col < 0 || player.tile_col >= MAP_COLS ||
+        player.tile_row < 0 || player.tile_row >= MAP_ROWS)
+        return "player tile out of map";
+    if (player.world_x < bound_wx_min || player.world_x > bound_wx_max ||
+        player.world_y < bound_wy_min || player.world_y > bound_wy_max)
+        return "player position out of bounds";
+    if (player.height < 0 || player.height > MAX_HEIGHT)
+        return "player height out of range";
+    if (!player.falling &&
+        world_map[player.tile_row][player.tile_col].height != player.height)
+        return "player height differs from its cell";
+    if (camera.x < bound_wx_min || camera.x > bound_wx_max)
+        return "camera out of bounds";
+    u32 live = 0;
+    for (int i = 0; i < MAX_ENTITIES; i++) {
+        if (ents.type[i] == ENT_NONE) continue;
+        if (i >= ent_high_water)
+            return "live actor above the high-water mark";
+        if (ents.col[i] >= MAP_COLS || ents.row[i] >= MAP_ROWS ||
+            world_map[ents.row[i]][ents.col[i]].height != ents.height[i])
+            return "actor off its patrol height";
+        live++;
+    }
+    if (live != entity_stats.live)
+        return "actor count differs from pool stats";
+    if (broadphase_verify())
+        return "actor missing from its broadphase bucket";
+    live = 0;
+    for (int i = 0; i < PARTICLE_MAX; i++) {
+        if (parts.kind[i] == FX_NONE) continue;
+        if (i >= particle_high_water)
+            return "live particle above the high-water mark";
+        live++;
+    }
+    if (live != particle_stats.live)
+        return "particle count differs from pool stats";
+    if (trigger_verify(player.tile_col, player.tile_row))
+        return "trigger inside set differs from a full scan";
+    if (objvram_verify())
+        return "OBJ VRAM slot holds the wrong frame";
+    if (sprite_slot(SPRITE_ID_PLAYER) < 0)
+        return "player sprite missing from OAM";
+    if (sprite_stats.line_peak > SPRITE_LINE_CYCLES)
+        return "OBJ scanline budget exceeded";
+    return (const char *)0;
+}
+
+// Random key runs from a private xorshift so the game RNG stays untouched
+static u32 fuzz_rng;
+static u32 fuzz_next(void) {
+    fuzz_rng ^= fuzz_rng << 13;
+    fuzz_rng ^= fuzz_rng >> 17;
+    fuzz_rng ^= fuzz_rng << 5;
+    return fuzz_rng;
+}
+
+static int fuzz_seed(u32 seed, long frames, int verbose) {
+    static const u16 dirs[] = {
+        0, KEY_RIGHT, KEY_LEFT, KEY_UP, KEY_DOWN,
+        KEY_RIGHT | KEY_UP, KEY_RIGHT | KEY_DOWN,
+        KEY_LEFT | KEY_UP, KEY_LEFT | KEY_DOWN,
+    };
+    sim_boot();
+    fuzz_rng = seed ? seed : 1;
+    rng_state = seed;
+
+    u16 keys = 0;
+    int run = 0;
+    for (long f = 0; f < frames; f++) {
+        if (run-- <= 0) {
+            keys = dirs[fuzz_next() % 9];
+            if ((fuzz_next() & 3) == 0) keys |= KEY_A;
+            if ((fuzz_next() & 7) == 0) keys |= KEY_B;
+            run = 1 + fuzz_next() % 48;
+        }
+        host_set_keys(keys);
+        sim_frame();
+        const char *err = check_invariants();
+        if (err) {
+            fprintf(stderr, "seed %u frame %ld: %s (col %d row %d h %d)\n",
+                    seed, f, err, player.tile_col, player.tile_row, player.height);
+            return 1;
+        }
+    }
+    if (verbose)
+        printf("seed %u: %ld frames ok, end col %d row %d h %d\n",
+               seed, frames, player.tile_col, player.tile_row, player.height);
+    return 0;
+}
+
+//=============================================================================
+// Commands
+//=============================================================================
+static int cmd_bench(int iters) {
+    host_reset();
+    generate_world();
+    double t0 = now_sec();
+    for (int i = 0; i < iters; i++)
+        precompute_world();
+    double t1 = now_sec();
+    printf("precompute_world: %d iters, %.3f ms/iter, %d unique tiles\n",
+           iters, (t1 - t0) * 1e3 / iters, num_tiles);
+    return 0;
+}
+
+static int cmd_replay(int stall_period) {
+    start_bench_route();
+    long frames = 0;
+    double t0 = now_sec();
+    while (replay_mode() == REPLAY_PLAY) {
+        sim_frame();
+        if (stall_period > 0 && ++frames % stall_period == 0)
+            host_elapse(2);
+    }
+    double t1 = now_sec();
+    frames = frame_stats.steps;
+    printf("bench_route: %ld steps in %.3f ms (%.0f steps/s, %.0fx real time)\n",
+           frames, (t1 - t0) * 1e3, frames / (t1 - t0),
+           frames / (t1 - t0) / 59.73);
+    printf("frames: %u rendered, %u skipped, %u overruns, %u steps dropped\n",
+           frame_stats.renders, frame_stats.skipped, frame_stats.overruns,
+           frame_stats.dropped);
+    const LatencyStats *ls = &latency_stats;
+    if (ls->samples)
+        printf("input latency: %u edges, %u..%u frames (avg %.2f), %u without effect\n",
+               ls->samples, ls->min, ls->max, (double)ls->total / ls->samples,
+               ls->timeouts);
+    printf("end col %d row %d h %d, digest %08X\n",
+           player.tile_col, player.tile_row, player.height, sim_digest());
+    return 0;
+}
+
+// Benchmark route with the load model; display rate measured in the
+// fortress. Returns the fortress frames that were not rendered.
+static int govern_run(int on) {
+    start_bench_route();
+    gov_set_enabled(on);
+    load_model = 1;
+    u32 zone_vblanks = 0, zone_renders = 0, zone_levels[GOV_LEVELS] = { 0 };
+    while (replay_mode() == REPLAY_PLAY) {
+        int zone = in_fortress();
+        u32 v0 = vblank_count, r0 = frame_stats.renders;
+        sim_frame();
+        if (zone) {
+            zone_vblanks += vblank_count - v0;
+            zone_renders += frame_stats.renders - r0;
+            zone_levels[gov_level]++;
+        }
+    }
+    load_model = 0;
+    const GovStats *gs = &gov_stats;
+    printf("governor %-3s: fortress %u frames, %u rendered (%.1f fps); levels %u/%u/%u/%u; "
+           "%u decisions, min headroom %d lines\n",
+           on ? "on" : "off", zone_vblanks, zone_renders,
+           59.73 * zone_renders / zone_vblanks,
+           zone_levels[0], zone_levels[1], zone_levels[2], zone_levels[3],
+           gs->decisions, gs->headroom_min);
+    return zone_renders < zone_vblanks ? (int)(zone_vblanks - zone_renders) : 0;
+}
+
+static int cmd_entities(int iters) {
+    start_bench_route();
+    u32 peak_live = 0;
+    while (replay_mode() == REPLAY_PLAY) {
+        sim_frame();
+        if (entity_stats.live > peak_live) peak_live = entity_stats.live;
+    }
+    const EntityStats *es = &entity_stats;
+    printf("bench_route: peak %u active / %u live of %d slots, %u woken, %u sent dormant, "
+           "%u dropped (pool full)\n",
+           es->peak_active, peak_live, MAX_ENTITIES, es->spawned, es->despawned,
+           es->alloc_failed);
+    const BroadStats *bs = &broad_stats;
+    printf("broadphase: %.1f pair tests per step (peak %u), all-pairs would make %.1f\n",
+           (double)bs->tests_total / frame_stats.steps, bs->tests_peak,
+           (double)bs->naive_total / frame_stats.steps);
+
+    // Stress: camera parked over the fortress garrison
+    entity_init();
+    int wx, wy;
+    iso_tile_to_world(160, 7, &wx, &wy);
+    camera.x = INT2FP(wx);
+    camera.y = INT2FP(wy);
+    entity_update();
+    u32 queries0 = bs->queries_total, tests0 = bs->tests_total, naive0 = bs->naive_total;
+    double t0 = now_sec();
+    for (int i = 0; i < iters; i++)
+        entity_update();
+    double t1 = now_sec();
+    printf("fortress: %u active actors, %.0f ns/update (host)\n",
+           es->active, (t1 - t0) * 1e9 / iters);
+    u32 queries = bs->queries_total - queries0, tests = bs->tests_total - tests0;
+    printf("fortress broadphase: %.1f queries, %.1f pair tests per step (%.1f per query), "
+           "all-pairs would make %.0f\n",
+           (double)queries / iters, (double)tests / iters, (double)tests / queries,
+           (double)(bs->naive_total - naive0) / iters);
+    return es->active >= 64 ? 0 : 1;
+}
+
+// 128 sprites drifting at most one diagonal per frame, like walking actors
+static double sprite_run(int frames, int warm, u32 *shifts_avg, u32 *shifts_max) {
+    u16 key[SPRITE_OAM];
+    u32 r = 1, total = 0, max = 0;
+    for (int i = 0; i < SPRITE_OAM; i++) {
+        r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+        key[i] = SPRITE_KEY(r % MAP_COLS, (r >> 8) % MAP_ROWS, (r >> 16) % 5);
+    }
+    sprite_init();
+    double t0 = now_sec();
+    for (int f = 0; f < frames; f++) {
+        if (!warm) sprite_init();
+        sprite_begin();
+        for (int i = 0; i < SPRITE_OAM; i++) {
+            r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+            if ((r & 15) == 0) key[i] += (r & 16) ? 8 : -8;   // one diagonal
+            sprite_add(i, key[i], 0, 0, 0);
+        }
+        sprite_end();
+        // A warm run's first frame has no previous order: leave it out
+        if (warm && f == 0) continue;
+        total += sprite_stats.shifts;
+        if (sprite_stats.shifts > max) max = sprite_stats.shifts;
+    }
+    double t1 = now_sec();
+    *shifts_avg = total / (frames - warm);
+    *shifts_max = max;
+    return (t1 - t0) * 1e9 / frames;
+}
+
+// A dense fight: the hero plus 96 actors packed into a 56-line band,
+// drifting sideways, through the scanline budget (OAM not multiplexed)
+static int sprite_crowd(int frames) {
+    enum { CROWD = 96 };
+    s16 x[CROWD], y[CROWD];
+    u32 shown[CROWD] = { 0 }, hero_lost = 0, culled = 0, peak = 0, demand_peak = 0;
+    u32 r = 7;
+    for (int i = 0; i < CROWD; i++) {
+        r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+        x[i] = r % SCREEN_W - 16;
+        y[i] = 56 + (r >> 8) % 24 - 16;
+    }
+    sprite_init();
+    oammux_set_enabled(0);
+    for (int f = 0; f < frames; f++) {
+        u16 demand[SCREEN_H] = { 0 };
+        u16 flip;
+        sprite_begin();
+        const MetaCell *mc = anim_cell(&anim_hero, HERO_ANIM_WALK, f / 4 % 6, DIR_SW, &flip);
+        const MetaPiece *pc = anim_cell_pieces(&anim_hero, mc);
+        sprite_add_meta(SPRITE_ID_PLAYER, SPRITE_KEY(0, 0, 0), 104, 64, ATTR0_4BPP, 0, 0,
+                        pc, mc->num_pieces);
+        for (int i = 0; i < CROWD; i++) {
+            x[i] += 1 + i % 3;
+            if (x[i] >= SCREEN_W) x[i] -= SCREEN_W + 32;
+            mc = anim_cell(&anim_hero, HERO_ANIM_PATROL, (f / 8 + i) % 6, i & 3, &flip);
+            pc = anim_cell_pieces(&anim_hero, mc);
+            sprite_add_meta(SPRITE_ID_ENTITY + i, SPRITE_KEY(i, y[i], 0), x[i], y[i],
+                            ATTR0_4BPP, flip, 0, pc, mc->num_pieces);
+            for (int q = 0; q < mc->num_pieces; q++) {
+                int w, h;
+                sprite_obj_size(pc[q].attr0, pc[q].attr1, &w, &h);
+                for (int l = 0; l < h; l++) {
+                    int line = y[i] + pc[q].y + l;
+                    if (line >= 0 && line < SCREEN_H) demand[line] += w;
+                }
+            }
+        }
+        sprite_end();
+        if (sprite_slot(SPRITE_ID_PLAYER) < 0) hero_lost++;
+        for (int i = 0; i < CROWD; i++) shown[i] += sprite_slot(SPRITE_ID_ENTITY + i) >= 0;
+        culled += sprite_stats.culled;
+        if (sprite_stats.line_peak > peak) peak = sprite_stats.line_peak;
+        for (int l = 0; l < SCREEN_H; l++)
+            if (demand[l] > demand_peak) demand_peak = demand[l];
+    }
+    oammux_set_enabled(1);
+    u32 lo = frames, hi = 0;
+    for (int i = 0; i < CROWD; i++) {
+        if (shown[i] < lo) lo = shown[i];
+        if (shown[i] > hi) hi = shown[i];
+    }
+    printf("crowd of %d: line demand up to %u of %d cycles, drawn up to %u; "
+           "%.1f held back per frame, each actor shown %.0f-%.0f%% of frames, "
+           "hero lost %u times\n",
+           CROWD + 1, demand_peak, SPRITE_LINE_CYCLES, peak, (double)culled / frames,
+           100.0 * lo / frames, 100.0 * hi / frames, hero_lost);
+    return hero_lost || peak > SPRITE_LINE_CYCLES;
+}
+
+// A frame withdrawn before its VBlank (present_begin()) never reaches OAM:
+// the next one must still hide everything the last committed frame showed
+static int sprite_withdrawn(void) {
+    static const int counts[] = { 60, 10, 5 };     // committed, withdrawn, committed
+    sim_boot();
+    oammux_set_enabled(0);
+    for (int f = 0; f < 3; f++) {
+        present_begin();
+        sprite_begin();
+        for (int i = 0; i < counts[f]; i++)
+            sprite_add(i, SPRITE_KEY(i, 0, 0), ATTR0_Y(i * 2), ATTR1_X(i * 3), 0);
+        present_submit(0, 0, sprite_end());
+        if (f != 1) present_commit();
+    }
+    oammux_set_enabled(1);
+    int visible = 0;
+    for (int k = 0; k < 128; k++)
+        visible += (oam_mem[k].attr0 & ATTR0_AFF_DBL) != ATTR0_HIDE;
+    printf("withdrawn frame: %d OBJs visible after it, %d expected\n", visible, counts[2]);
+    return visible != counts[2];
+}
+
+static int cmd_sprites(int frames) {
+    start_bench_route();
+    u32 peak = 0, peak_objs = 0, peak_shifts = 0;
+    while (replay_mode() == REPLAY_PLAY) {
+        sim_frame();
+        if (sprite_stats.count > peak) peak = sprite_stats.count;
+        if (sprite_stats.objs > peak_objs) peak_objs = sprite_stats.objs;
+        if (sprite_stats.shifts > peak_shifts) peak_shifts = sprite_stats.shifts;
+    }
+    printf("bench_route: up to %u sprites in %u OBJs, up to %u sort moves per frame\n",
+           peak, peak_objs, peak_shifts);
+
+    // Trimmed cells: OBJ area is what a sprite costs the scanline renderer
+    int cells = 0, tiles = 0, pieces = 0;
+    for (int k = 0; k < anim_hero.num_seqs; k++) {
+        const AnimSeq *sq = &anim_hero.seqs[k];
+        for (int f = 0; f < sq->count; f++)
+            for (int d = 0; d < 4; d++) {
+                u16 flip;
+                const MetaCell *mc = anim_cell(&anim_hero, k, f, d, &flip);
+                cells++;
+                tiles += mc->num_tiles;
+                pieces += mc->num_pieces;
+            }
+    }
+    printf("hero meta-sprites: %.1f of %d tiles, %.2f OBJs per frame drawn "
+           "(%.0f%% fewer OBJ line pixels)\n",
+           (double)tiles / cells, OBJ_SLOT_TILES, (double)pieces / cells,
+           100.0 - 100.0 * tiles / (cells * OBJ_SLOT_TILES));
+    const ObjVramStats *os = &objvram_stats;
+    printf("OBJ VRAM: up to %u of %d slots (%u KB), %.2f frame uploads per step, %u KB copied\n",
+           os->peak, OBJ_SLOTS, os->peak * OBJ_SLOT_TILES * 32 / 1024,
+           (double)os->uploads_total / frame_stats.steps, os->bytes_total / 1024);
+
+    u32 avg, max;
+    double ns = sprite_run(frames, 1, &avg, &max);
+    printf("128 sprites, warm order: %u moves/frame (max %u), %.0f ns/frame (host)\n",
+           avg, max, ns);
+    ns = sprite_run(frames, 0, &avg, &max);
+    printf("128 sprites, cold order: %u moves/frame (max %u), %.0f ns/frame (host)\n",
+           avg, max, ns);
+    return sprite_crowd(frames) | sprite_withdrawn();
+}
+
+// 224 plain sprites of assorted sizes bouncing over the whole screen, shown
+// through the HBlank multiplexer. The beam is stepped line by line and,
+// before each line is fetched, OAM must hold every OBJ that covers it.
+static int cmd_mux(int frames) {
+    enum { N = 224 };
+    static const u16 shapes[5][2] = {
+        { ATTR0_SQUARE, ATTR1_SIZE_8 }, { ATTR0_SQUARE, ATTR1_SIZE_16 },
+        { ATTR0_WIDE, ATTR1_SIZE_8 },   { ATTR0_TALL, ATTR1_SIZE_8 },
+        { ATTR0_TALL, ATTR1_SIZE_32 },
+    };
+    s16 x[N], y[N], dx[N], dy[N];
+    u16 exp0[2][N], exp1[2][N];
+    u8 shown[2][N];
+    u32 seen[N] = { 0 }, stamp = 0;
+    u32 r = 3;
+    for (int i = 0; i < N; i++) {
+        r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+        x[i] = r % SCREEN_W;
+        y[i] = (r >> 8) % (SCREEN_H + 16) - 16;
+        dx[i] = (r >> 16) % 3 - 1;
+        dy[i] = (r >> 20) & 1 ? 1 : -1;
+    }
+    sim_boot();
+    u32 sum_shown = 0, min_shown = N, sum_objs = 0, line_errors = 0;
+    double build_ns = 0;
+    int cur = 0;
+    for (int f = 0; f <= frames; f++) {
+        // Build frame f into the other expectation buffer
+        int nxt = cur ^ 1;
+        double t0 = now_sec();
+        present_begin();
+        sprite_begin();
+        for (int i = 0; i < N; i++) {
+            x[i] += dx[i];
+            y[i] += dy[i];
+            if (x[i] < -16 || x[i] > SCREEN_W) dx[i] = -dx[i];
+            if (y[i] < -16 || y[i] > SCREEN_H) dy[i] = -dy[i];
+            const u16 *sh = shapes[i % 5];
+            exp0[nxt][i] = ATTR0_Y(y[i] & 0xFF) | sh[0];
+            exp1[nxt][i] = ATTR1_X(x[i] & 0x1FF) | sh[1];
+            sprite_add(i, (u16)(y[i] + 64), exp0[nxt][i], exp1[nxt][i], ATTR2_ID(i));
+        }
+        int n = sprite_end();
+        present_submit(0, 0, n);
+        build_ns += (now_sec() - t0) * 1e9;
+        u32 count = 0;
+        for (int i = 0; i < N; i++) count += shown[nxt][i] = sprite_slot(i) >= 0;
+        if (f > 0) {
+            sum_shown += count;
+            if (count < min_shown) min_shown = count;
+            sum_objs += sprite_stats.objs;
+        }
+
+        if (f == 0) {
+            VBlankIntrWait();      // commit frame 0
+            cur = nxt;
+            continue;
+        }
+        // Show frame `cur` for one frame; the last step commits frame f
+        for (int s = 0; s < 228; s++) {
+            host_scanlines(1);
+            int line = REG_VCOUNT + 1;
+            if (line == 228) line = 0;
+            if (line >= SCREEN_H || REG_VCOUNT == SCREEN_H) continue;
+            stamp++;
+            for (int e = 0; e < SPRITE_OAM; e++) {
+                int i = oam_mem[e].attr2 & 0x3FF;
+                if (i < N && oam_mem[e].attr0 == exp0[cur][i] && oam_mem[e].attr1 == exp1[cur][i])
+                    seen[i] = stamp;
+            }
+            for (int i = 0; i < N; i++) {
+                if (!shown[cur][i]) continue;
+                int w, h, top = exp0[cur][i] & 0xFF;
+                sprite_obj_size(exp0[cur][i], exp1[cur][i], &w, &h);
+                if (((line - top) & 0xFF) < h && seen[i] != stamp) line_errors++;
+            }
+        }
+        cur = nxt;
+    }
+    const OamMuxStats *ms = &oammux_stats;
+    printf("mux: %d sprites, %.1f shown per frame (min %u), %.1f OBJs, %u frames multiplexed\n",
+           N, (double)sum_shown / frames, min_shown, (double)sum_objs / frames, ms->frames);
+    printf("HBlank: %u writes, %u IRQs, ~%u cycles in the last frame by the host cost model "
+           "(peak %u, %.1f%% of a frame); %u late, %u without entry\n",
+           ms->writes, ms->irqs, ms->cycles, ms->cycles_peak,
+           100.0 * ms->cycles_peak / CYCLES_PER_FRAME, ms->late, ms->no_entry);
+    printf("OAM checked before every line: %u missing OBJ-lines; build %.0f ns/frame (host)\n",
+           line_errors, build_ns / (frames + 1));
+    return line_errors || ms->late || ms->no_entry || min_shown < 200;
+}
+
+// Benchmark route effects (landing dust, splashes), then a stress test: an
+// two effects per frame at random on-screen cells keep ~250 particles alive,
+// timed through draw, sort and matrix sharing
+static int cmd_particles(int frames) {
+    start_bench_route();
+    u32 peak_objs = 0;
+    while (replay_mode() == REPLAY_PLAY) {
+        sim_frame();
+        if (particle_stats.objs > peak_objs) peak_objs = particle_stats.objs;
+    }
+    const ParticleStats *ps = &particle_stats;
+    printf("bench_route: %u particles spawned, peak %u live in %u OBJs, %u refused (cap %d), "
+           "peak %u cycles (%.1f lines)\n",
+           ps->spawned, ps->peak, peak_objs, ps->refused, particle_cap, ps->cycles_peak,
+           to_lines(ps->cycles_peak));
+
+    sim_boot();
+    particle_cap = PARTICLE_MAX;
+    int cam_col = 40, cam_row = 10;
+    int wx, wy;
+    iso_tile_to_world(cam_col, cam_row, &wx, &wy);
+    camera.x = INT2FP(wx);
+    camera.y = INT2FP(wy);
+    u32 r = 5, live = 0, objs = 0, requests = 0, used = 0, flat = 0, culled = 0;
+    u32 mux = sprite_stats.mux_frames, peak_line = 0, cycles = 0;
+    double update_ns = 0, draw_ns = 0;
+    for (int f = 0; f < frames; f++) {
+        for (int k = 0; k < 2; k++) {
+            r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+            int col = cam_col - 6 + r % 12, row = cam_row - 6 + (r >> 8) % 12;
+            int kind = k == 0 && f % 16 == 0 ? FX_SLASH : FX_SPARKS + (r >> 16) % 3;
+            MapCell *c = get_map_cell(world_map, col, row);
+            if (c) particle_effect(kind, col, row, c->height, (r >> 20) & 3);
+        }
+
+        double t0 = now_sec();
+        particle_update();
+        double t1 = now_sec();
+        present_begin();
+        sprite_begin();
+        affine_begin();
+        particle_draw();
+        int n = sprite_end();
+        int a = affine_end(obj_buffer);
+        present_submit(0, 0, n > a ? n : a);
+        double t2 = now_sec();
+        VBlankIntrWait();
+        if (f < 60) continue;          // let the pool fill
+        update_ns += (t1 - t0) * 1e9;
+        draw_ns += (t2 - t1) * 1e9;
+        live += ps->live;
+        objs += ps->objs;
+        flat += ps->flat;
+        cycles += ps->cycles;
+        requests += affine_stats.requests;
+        used += affine_stats.used;
+        culled += sprite_stats.culled;
+        if (sprite_stats.line_peak > peak_line) peak_line = sprite_stats.line_peak;
+    }
+    int counted = frames - 60;
+    printf("stress: %.0f live (peak %u), %.0f OBJs drawn per frame, %.1f held back by the "
+           "line budget (peak %u cycles), %u frames multiplexed\n",
+           (double)live / counted, ps->peak, (double)objs / counted,
+           (double)culled / counted, peak_line, sprite_stats.mux_frames - mux);
+    printf("matrices: %.1f requests -> %.1f used per frame (peak %u of %d), "
+           "%.2f OBJs per frame drawn flat\n",
+           (double)requests / counted, (double)used / counted, affine_stats.peak, AFFINE_MAX,
+           (double)flat / counted);
+    printf("cycles: update+draw %.0f per frame, peak %u (%.1f lines), by the host cost model\n",
+           (double)cycles / counted, ps->cycles_peak, to_lines(ps->cycles_peak));
+    printf("cost: update %.0f ns, draw+sort+OAM %.0f ns per frame (host)\n",
+           update_ns / counted, draw_ns / counted);
+    return ps->live == 0 || affine_stats.peak > AFFINE_MAX;
+}
+
+// Walk the field from every reachable cell: each step must be legal under
+// the jump/fall rules and lower the distance by one. Returns bad cells.
+static int flow_check(int col0) {
+    int bad = 0;
+    for (int r = 0; r < MAP_ROWS; r++)
+        for (int c = col0; c < col0 + FLOW_COLS; c++) {
+            int d = flow_dist(c, r);
+            if (d == FLOW_FAR) continue;
+            int cc = c, rr = r;
+            for (int k = d; k > 0; k--) {
+                int dir = flow_dir(cc, rr);
+                int nc = cc + (dir == DIR_SE) - (dir == DIR_NW);
+                int nr = rr + (dir == DIR_SW) - (dir == DIR_NE);
+                MapCell *from = get_map_cell(world_map, cc, rr), *to = get_map_cell(world_map, nc, nr);
+                if (dir >= FLOW_HERE || !to || to->height > from->height + 1 ||
+                    flow_dist(nc, nr) != k - 1) {
+                    bad++;
+                    break;
+                }
+                cc = nc;
+                rr = nr;
+            }
+        }
+    return bad;
+}
+
+static volatile u32 flow_sink;     // keeps the lookup loop honest
+
+static int cmd_flow(int iters) {
+    start_bench_route();
+    u32 peak_chasing = 0, builds0 = flow_stats.builds, longest = 0;
+    while (replay_mode() == REPLAY_PLAY) {
+        sim_frame();
+        if (entity_stats.chasing > peak_chasing) peak_chasing = entity_stats.chasing;
+        if (flow_stats.build_steps > longest) longest = flow_stats.build_steps;
+    }
+    const FlowStats *fs = &flow_stats;
+    printf("bench_route: %u fields built (up to %u steps each, %u cells per step), "
+           "up to %u guards chasing\n",
+           fs->builds - builds0, longest, fs->cells_peak, peak_chasing);
+
+    // Fortress: full rebuilds, sliced rebuilds and lookups for its garrison
+    entity_init();
+    int wx, wy;
+    iso_tile_to_world(160, 7, &wx, &wy);
+    camera.x = INT2FP(wx);
+    camera.y = INT2FP(wy);
+    entity_update();
+    int bad = 0;
+    double t0 = now_sec();
+    for (int i = 0; i < iters; i++)
+        flow_build_now(160, 7 + (i & 1));
+    double t1 = now_sec();
+    bad += flow_check(160 - FLOW_COLS / 2);
+    printf("fortress field: %u of %d cells reachable, full rebuild %.0f ns, "
+           "%.0f ns per %d-cell slice (host)\n",
+           fs->reached, FLOW_CELLS, (t1 - t0) * 1e9 / iters,
+           (t1 - t0) * 1e9 / iters * FLOW_CELLS_PER_STEP / fs->reached, FLOW_CELLS_PER_STEP);
+
+    u32 sum = 0, lookups = 0;
+    t0 = now_sec();
+    for (int k = 0; k < iters; k++)
+        for (int i = 0; i < ent_high_water; i++) {
+            if (ents.type[i] == ENT_NONE) continue;
+            sum += flow_dir(ents.col[i], ents.row[i]);
+            lookups++;
+        }
+    t1 = now_sec();
+    flow_sink = sum;
+    printf("lookups: %.1f ns per actor (host, %u actors)\n",
+           (t1 - t0) * 1e9 / lookups, lookups / iters);
+    bad += flow_check(160 - FLOW_COLS / 2);
+    printf("paths: %s\n", bad ? "FAILED" : "every reachable cell walks to the target");
+    return bad != 0;
+}
+
+// Fortress garrison with the player parked among it, `steps` logic steps;
+// returns the longest wait of a think past its due step
+static u32 ai_encounter(int budget, int steps) {
+    sim_boot();
+    ai_budget_cycles = budget;
+    int wx, wy;
+    iso_tile_to_world(160, 7, &wx, &wy);
+    player.world_x = camera.x = INT2FP(wx);
+    player.world_y = camera.y = INT2FP(wy);
+    player.tile_col = 160;
+    player.tile_row = 7;
+    player.height = world_map[7][160].height;
+    entity_init();
+    u32 due = 0, deferred = 0, chasing = 0, peak_chasing = 0;
+    double t0 = now_sec();
+    for (int k = 0; k < steps; k++) {
+        entity_update();
+        due += ai_stats.due;
+        deferred += ai_stats.deferred;
+        chasing += entity_stats.chasing;
+        if (entity_stats.chasing > peak_chasing) peak_chasing = entity_stats.chasing;
+    }
+    double t1 = now_sec();
+    const AiStats *as = &ai_stats;
+    printf("fortress, budget %5d: %u actors, %.1f thinks due / %.1f run per step (peak %u), "
+           "%.1f deferred (peak %u, longest wait %u steps), up to %u cycles; "
+           "%.1f guards chasing (peak %u), %.0f ns/step (host)\n",
+           budget, entity_stats.active, (double)due / steps, (double)as->thinks_total / steps,
+           as->thinks_peak, (double)deferred / steps, as->deferred_peak, as->wait_peak,
+           as->cycles_peak, (double)chasing / steps, peak_chasing, (t1 - t0) * 1e9 / steps);
+    ai_budget_cycles = AI_BUDGET_CYCLES;
+    return as->wait_peak;
+}
+
+// A slot freed and reused every step while its think is deferred must
+// stay queued once, not grow the queue
+static int ai_thinks_run;
+static int ai_count_think(int i) {
+    (void)i;
+    ai_thinks_run++;
+    return 0;
+}
+
+static int ai_reuse(int steps) {
+    ai_init();
+    ai_budget_cycles = 0;               // every think deferred
+    u32 deferred_peak = 0;
+    for (int k = 0; k < steps; k++) {
+        ai_request(5);
+        ai_forget(5);
+        ai_request(5);
+        ai_run(ai_count_think);
+        if (ai_stats.deferred > deferred_peak) deferred_peak = ai_stats.deferred;
+    }
+    ai_budget_cycles = AI_BUDGET_CYCLES;
+    ai_thinks_run = 0;
+    ai_run(ai_count_think);
+    printf("slot reuse: %d steps deferred, queue peak %u, %d think on release\n",
+           steps, deferred_peak, ai_thinks_run);
+    return deferred_peak != 1 || ai_thinks_run != 1;
+}
+
+static int cmd_ai(int steps) {
+    run_bench_route();
+    const AiStats *as = &ai_stats;
+    printf("bench_route: %.2f thinks per step (peak %u, up to %u cycles), %u deferred\n",
+           (double)as->thinks_total / frame_stats.steps, as->thinks_peak, as->cycles_peak,
+           as->deferred_total);
+    // Deferred thinks go first next step, so even a starved budget only
+    // stretches intervals: no think may wait more than a pass over the pool
+    u32 wait = 0;
+    for (int b = AI_BUDGET_CYCLES; b >= AI_BUDGET_CYCLES / 4; b /= 2) {
+        u32 w = ai_encounter(b, steps);
+        if (w > wait) wait = w;
+    }
+    return (wait > AI_QUEUE / 2) | ai_reuse(steps);
+}
+
+// Every actor of the fortress garrison asks every frame whether it sees the
+// player, who walks along row 7 one tile per 16 frames. The cache must
+// agree with a fresh ray, also after a wall is raised across the sight lines.
+static int cmd_los(int frames) {
+    sim_boot();
+    int wx, wy;
+    iso_tile_to_world(160, 7, &wx, &wy);
+    camera.x = INT2FP(wx);
+    camera.y = INT2FP(wy);
+    entity_init();
+    entity_update();
+    u8 src[MAX_ENTITIES];
+    int n = 0;
+    for (int i = 0; i < ent_high_water; i++)
+        if (ents.type[i] != ENT_NONE) src[n++] = (u8)i;
+    int walls = 0;
+    for (int r = 0; r < MAP_ROWS; r++)
+        for (int c = 150; c <= 170; c++) walls += world_map[r][c].height == 4;
+
+    // Uncached cost
+    u32 cells = 0, seen = 0, rays = 0;
+    double t0 = now_sec();
+    for (int f = 0; f < frames; f++) {
+        int pc = 150 + (f / 16) % 21;
+        for (int k = 0; k < n; k++) {
+            int t;
+            seen += los_ray(ents.col[src[k]], ents.row[src[k]], pc, 7, &t);
+            cells += t;
+            rays++;
+        }
+    }
+    double t1 = now_sec();
+    printf("fortress: %d actors, %d wall cells (height 4) in cols 150-170; %.0f%% of sight "
+           "lines clear, %.1f cells per ray\n",
+           n, walls, 100.0 * seen / rays, (double)cells / rays);
+    printf("uncached: %d rays per frame, %.0f ns per ray (host)\n", n, (t1 - t0) * 1e9 / rays);
+
+    // Cached, cross-checked
+    los_init();
+    u32 wrong = 0;
+    double cached = 0;
+    for (int f = 0; f < frames; f++) {
+        int pc = 150 + (f / 16) % 21;
+        if (f == frames / 2) {
+            // Raise a wall across the garrison's sight lines
+            for (int r = 0; r < MAP_ROWS; r++) {
+                world_map[r][158].height = 4;
+                los_cell_changed(158, r);
+            }
+        }
+        double q0 = now_sec();
+        int vis[MAX_ENTITIES];
+        for (int k = 0; k < n; k++)
+            vis[k] = los_visible(ents.col[src[k]], ents.row[src[k]], pc, 7, 0);
+        cached += now_sec() - q0;
+        for (int k = 0; k < n; k++)
+            wrong += vis[k] != los_ray(ents.col[src[k]], ents.row[src[k]], pc, 7, 0);
+    }
+    const LosStats *ls = &los_stats;
+    printf("cached: %.1f%% hits, %.0f ns per query, %.1f rays cast per frame (host); "
+           "%u entries dropped by the wall; %u answers differ from a fresh ray\n",
+           100.0 * ls->hits / ls->queries, cached * 1e9 / ls->queries,
+           (double)(ls->queries - ls->hits) / frames, ls->invalidated, wrong);
+    generate_world();
+    return wrong != 0;
+}
+
+static volatile u32 trig_sink;     // keeps the full-scan loop honest
+
+static int cmd_triggers(int passes) {
+    static const char *const kinds[NUM_TRIG_KINDS] = { "zone", "checkpoint", "cutscene", "pickup" };
+    start_bench_route();
+    int bad = 0;
+    u32 counts[NUM_TRIG_KINDS] = { 0 };
+    printf("bench_route enters:");
+    while (replay_mode() == REPLAY_PLAY) {
+        sim_frame();
+        for (int k = 0; k < trigger_num_events; k++) {
+            const TriggerEvent *e = &trigger_events[k];
+            if (e->edge != TRIG_ENTER) continue;
+            counts[trigDefs[e->id].kind]++;
+            printf(" %s %d", kinds[trigDefs[e->id].kind], trigDefs[e->id].arg);
+        }
+        bad += trigger_verify(player.tile_col, player.tile_row) != 0;
+    }
+    const TriggerStats *ts = &trigger_stats;
+    printf("\nbench_route: %u tile changes, %u events (%u zone, %u checkpoint, %u cutscene, "
+           "%u pickup entries), %.2f tests per change vs %d for a full scan, "
+           "bucket lists up to %u\n",
+           ts->updates, ts->events, counts[TRIG_ZONE], counts[TRIG_CHECKPOINT],
+           counts[TRIG_CUTSCENE], counts[TRIG_PICKUP], (double)ts->tests / ts->updates,
+           TRIG_COUNT, ts->bucket_peak);
+
+    // Walk the strip along the road, both ways, indexed vs a full scan
+    u32 updates = 0;
+    double t0 = now_sec();
+    for (int p = 0; p < passes; p++)
+        for (int c = 0; c < 2 * MAP_COLS; c++) {
+            int col = c < MAP_COLS ? c : 2 * MAP_COLS - 1 - c;
+            trigger_update(col, 7 + (c & 1));
+            updates++;
+        }
+    double t1 = now_sec();
+    u32 sum = 0;
+    for (int p = 0; p < passes; p++)
+        for (int c = 0; c < 2 * MAP_COLS; c++) {
+            int col = c < MAP_COLS ? c : 2 * MAP_COLS - 1 - c, row = 7 + (c & 1);
+            for (int id = 0; id < TRIG_COUNT; id++) {
+                const TriggerDef *t = &trigDefs[id];
+                sum += col >= t->col_lo && col <= t->col_hi &&
+                       row >= t->row_lo && row <= t->row_hi;
+            }
+        }
+    double t2 = now_sec();
+    trig_sink = sum;
+    printf("strip walk: %.1f ns per tile change bucketed, %.1f ns full scan (host, %d triggers)\n",
+           (t1 - t0) * 1e9 / updates, (t2 - t1) * 1e9 / updates, TRIG_COUNT);
+
+    // Random jumps across buckets: the inside set must match a full scan
+    fuzz_rng = 7;
+    for (int k = 0; k < 100000; k++) {
+        int col = fuzz_next() % MAP_COLS, row = fuzz_next() % MAP_ROWS;
+        trigger_update(col, row);
+        bad += trigger_verify(col, row) != 0;
+    }
+    printf("jumps: %s, %u events dropped\n", bad ? "FAILED" : "inside set matches a full scan",
+           ts->dropped);
+    return bad != 0;
+}
+
+static int cmd_scripts(int rounds) {
+    run_bench_route();
+    const ScriptStats *ss = &script_stats;
+    printf("bench_route: %u scripts started, %u finished, %u still running, %u dropped, "
+           "%u bad ops; %u instructions (peak %u per step, %u cycles)\n",
+           ss->started, ss->finished, ss->running, ss->dropped, ss->bad_op,
+           ss->ops_total, ss->ops_peak, ss->cycles_peak);
+
+    // Every slot busy with a loop that never waits: each step must stop at
+    // the slices, and every copy must finish on the same, predicted step
+    int ops_each = 2 + 2 * 1000 + 1;
+    int expect = (ops_each + SCRIPT_SLICE - 1) / SCRIPT_SLICE;
+    int bad = 0;
+    u32 ops = 0, peak = 0, cycles = 0;
+    double t = 0;
+    for (int k = 0; k < rounds; k++) {
+        script_init();
+        scripts[0].id = SCRIPT_NONE;       // no intro
+        while (script_start(SCRIPT_STRESS) >= 0)
+            ;
+        int steps = 0;
+        double t0 = now_sec();
+        do {
+            script_update();
+            steps++;
+            if (ss->ops > peak) peak = ss->ops;
+            if (ss->cycles > cycles) cycles = ss->cycles;
+            ops += ss->ops;
+        } while (ss->running);
+        t += now_sec() - t0;
+        bad += steps != expect || ss->finished != SCRIPT_MAX ||
+               peak > SCRIPT_MAX * SCRIPT_SLICE;
+    }
+    printf("stress: %d scripts x %d instructions, done in %d steps each round; "
+           "up to %u instructions, ~%u cycles (%.1f lines) per step by the host cost "
+           "model; %.1f ns per instruction (host)\n",
+           SCRIPT_MAX, ops_each, expect, peak, cycles, to_lines(cycles),
+           t * 1e9 / ops);
+    printf("slices: %s\n", bad ? "FAILED" : "every step within SCRIPT_MAX x SCRIPT_SLICE");
+    return bad != 0;
+}
+
+// Fire `id` and run one mixer frame
+static void sfx_frame(int id) {
+    sound_sfx(id);
+    sound_rewind();
+    sound_vblank();
+}
+
+static int cmd_sound(int frames) {
+    run_bench_route();
+    const SoundStats *ss = &sound_stats;
+    printf("bench_route: %d voices at %d Hz, %u frames mixed, %.0f cycles per frame "
+           "(peak %u, %.1f lines), up to %u voices; %u SFX played, %u stolen, %u dropped, "
+           "%u merged; %u samples clipped\n",
+           sound_channels, sound_rate_hz(sound_rate), ss->frames,
+           (double)ss->cycles_total / ss->frames, ss->cycles_peak, to_lines(ss->cycles_peak),
+           ss->voices_peak, ss->sfx_played, ss->sfx_stolen, ss->sfx_dropped, ss->sfx_merged,
+           ss->clipped);
+
+    // Worst case per setting: music plus an SFX fired every frame, so every
+    // voice stays busy
+    static const int counts[] = { 3, 4, 6, 8 };
+    printf("cycles per frame with every voice busy (%% of the %u-cycle frame):\n  voices",
+           CYCLES_PER_FRAME);
+    for (int r = 0; r < NUM_SOUND_RATES; r++) printf(" %9d Hz", sound_rate_hz(r));
+    printf("\n");
+    double host_ns = 0;
+    u32 host_frames = 0;
+    for (unsigned c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        printf("  %6d", counts[c]);
+        for (int r = 0; r < NUM_SOUND_RATES; r++) {
+            sound_init(counts[c], r);
+            sound_music(SONG_FIELD);
+            u32 total = 0;
+            double t0 = now_sec();
+            for (int f = 0; f < frames; f++) {
+                sound_sfx(SFX_SPLASH + (f & 1));
+                sound_rewind();
+                sound_vblank();
+                total += ss->cycles;
+            }
+            host_ns += (now_sec() - t0) * 1e9;
+            host_frames += frames;
+            printf(" %6u %4.1f%%", total / frames, 100.0 * total / frames / CYCLES_PER_FRAME);
+        }
+        printf("\n");
+    }
+    printf("host: %.0f ns per mixed frame\n", host_ns / host_frames);
+
+    // Priorities with two SFX voices: a chime holds both against lower
+    // priorities, a third chime steals, a repeat within a frame merges
+    sound_init(SOUND_MUSIC_VOICES + 2, SOUND_RATE_13K);
+    int bad = 0;
+    sfx_frame(SFX_CHIME);
+    sfx_frame(SFX_CHIME);
+    sfx_frame(SFX_JUMP);
+    sfx_frame(SFX_HIT);
+    bad |= ss->sfx_played != 2 || ss->sfx_dropped != 2;
+    sfx_frame(SFX_CHIME);
+    bad |= ss->sfx_stolen != 1;
+    sound_sfx(SFX_SLASH);
+    sound_sfx(SFX_SLASH);
+    sound_rewind();
+    sound_vblank();
+    bad |= ss->sfx_played != 3 || ss->sfx_merged != 1 || ss->sfx_dropped != 3;
+    printf("priorities: %s (%u played, %u stolen, %u dropped, %u merged)\n",
+           bad ? "FAILED" : "ok", ss->sfx_played, ss->sfx_stolen, ss->sfx_dropped,
+           ss->sfx_merged);
+    return bad;
+}
+
+//=============================================================================
+// Saves: bench route autosaves, edit round trip, compaction, torn writes
+//=============================================================================
+// A world edit the way the game makes one: the cell, its sight lines, its
+// tiles and ring entries, and the save's delta
+static void sim_edit_cell(int c, int r, int ground, int side, int height) {
+    MapCell *cell = &world_map[r][c];
+    cell->ground = (u8)ground;
+    cell->side = (u8)side;
+    cell->height = (u8)height;
+    los_cell_changed(c, r);
+    save_cell_changed(c, r);
+    int first = num_tiles;
+    ComposeRect rect;
+    compose_cell(c, r, &rect);
+    stream_refresh(&rect);
+    upload_tiles_from(first);
+}
+
+// FNV-1a over what a save restores
+static u32 save_state_digest(void) {
+    u32 h = 0x811C9DC5;
+    int v[] = { player.tile_col, player.tile_row, player.height, player.facing,
+                player.world_x, player.world_y, trigger_checkpoint_col,
+                trigger_checkpoint_row, (int)script_flags };
+    const u8 *p[] = { (const u8 *)world_map, (const u8 *)v };
+    const int n[] = { sizeof(world_map), sizeof(v) };
+    for (int k = 0; k < 2; k++)
+        for (int i = 0; i < n[k]; i++) { h ^= p[k][i]; h *= 0x01000193; }
+    for (int id = 0; id < TRIG_COUNT; id++) {
+        h ^= (u32)trigger_fired(id);
+        h *= 0x01000193;
+    }
+    return h;
+}
+
+// Pixel hash of every world tile (ids differ between compositions)
+static void world_tile_hashes(u32 *out) {
+    for (int i = 0; i < WORLD_TILE_W * WORLD_TILE_H; i++) {
+        const u8 *px = tile_dict[world_tilemap[i]];
+        u32 h = 0x811C9DC5;
+        for (int k = 0; k < 64; k++) { h ^= px[k]; h *= 0x01000193; }
+        out[i] = h;
+    }
+}
+
+// Shown ring entries or VRAM tiles that disagree with world_tilemap/tile_dict
+static int ring_mismatches(void) {
+    int bad = 0;
+    for (int j = 0; j < 64; j++) {
+        for (int i = 0; i < 64; i++) {
+            int wtc = loaded_col_min + i, wtr = loaded_row_min + j;
+            if (wtc < 0 || wtc >= WORLD_TILE_W || wtr < 0 || wtr >= WORLD_TILE_H) continue;
+            int hc = wtc & 63, hr = wtr & 63;
+            int sb = stream_sbb[stream_set] + (hc >> 5) + (hr >> 5) * 2;
+            u16 id = ((u16 *)se_mem[sb])[(hr & 31) * 32 + (hc & 31)];
+            bad += id != world_tilemap[wtr * WORLD_TILE_W + wtc];
+        }
+    }
+    for (int t = 0; t < num_tiles; t++)
+        bad += memcmp(&tile_mem[stream_cbb[stream_set]][t * 2], tile_dict[t], 64) != 0;
+    return bad;
+}
+
+static u8 save_image[SAVE_SLOT_SIZE * 2];
+
+// Reboot with the save half of SRAM holding `image`; load it if asked
+static void save_power_cycle(const u8 *image, int load) {
+    sim_boot();
+    memcpy(host_sram, image, SAVE_SLOT_SIZE * 2);
+    save_init();
+    if (load) save_load();
+}
+
+static void save_drain(void) {
+    trigger_num_events = 0;
+    while (save_busy()) save_update();
+}
+
+// Cut power after every byte of the next save: each image must load as
+// the save before (`old`) or this one; returns the torn images that load
+// as neither, and counts the ones that load as the new save
+static int save_torn(u32 old, int *num_new, int *num_cuts) {
+    u32 fresh = save_state_digest();
+    save_step_bytes = 1;
+    save_request();
+    int n = 0;
+    u8 *images = NULL;
+    while (save_busy()) {
+        trigger_num_events = 0;
+        save_update();
+        images = realloc(images, (size_t)(n + 1) * sizeof(save_image));
+        memcpy(images + (size_t)n * sizeof(save_image), host_sram, sizeof(save_image));
+        n++;
+    }
+    save_step_bytes = SAVE_STEP_BYTES;
+    memcpy(save_image, host_sram, sizeof(save_image));
+    int bad = 0;
+    *num_new = 0;
+    for (int k = 0; k < n; k++) {
+        save_power_cycle(images + (size_t)k * sizeof(save_image), 1);
+        u32 d = save_state_digest();
+        *num_new += d == fresh;
+        bad += d != fresh && d != old;
+    }
+    free(images);
+    *num_cuts = n;
+    return bad;
+}
+
+static int cmd_save(int saves) {
+    run_bench_route();
+    const SaveStats *ss = &save_stats;
+    printf("bench_route: %u autosaves (%u full), %u deferred, %u bytes over %u steps; "
+           "largest block %u bytes; up to %u cycles (%.1f lines) per step\n",
+           ss->saves, ss->compactions, ss->deferred, ss->bytes, ss->steps, ss->block_peak,
+           ss->cycles_peak, to_lines(ss->cycles_peak));
+
+    // Round trip: a wall across the fortress, a pond by the start (inside
+    // the ring), a flag and a pickup; saved, rebooted and loaded
+    static u32 local[WORLD_TILE_W * WORLD_TILE_H], full[WORLD_TILE_W * WORLD_TILE_H];
+    sim_boot();
+    for (int r = 0; r < MAP_ROWS; r++) sim_edit_cell(158, r, GROUND_STONE, SIDE_BRICK, MAX_HEIGHT);
+    for (int r = 6; r <= 9; r++)
+        for (int c = 5; c <= 7; c++) sim_edit_cell(c, r, GROUND_WATER, SIDE_DIRT, 0);
+    script_flags |= 1u << 5;
+    int once = 0;
+    while (!(trigDefs[once].flags & TRIG_ONCE)) once++;
+    trigger_mark_fired(once);
+    int bad_ring = ring_mismatches();
+    world_tile_hashes(local);
+    save_request();
+    save_drain();
+    memcpy(save_image, host_sram, sizeof(save_image));
+    u32 saved = save_state_digest();
+    u32 block = ss->block_peak;
+    double t0 = now_sec();
+    precompute_world();
+    double t_full = now_sec() - t0;
+    world_tile_hashes(full);
+    int bad_local = 0;
+    for (int i = 0; i < WORLD_TILE_W * WORLD_TILE_H; i++) bad_local += local[i] != full[i];
+
+    save_power_cycle(save_image, 0);
+    t0 = now_sec();
+    save_load();
+    double t_load = now_sec() - t0;
+    world_tile_hashes(local);
+    int bad_load = 0;
+    for (int i = 0; i < WORLD_TILE_W * WORLD_TILE_H; i++) bad_load += local[i] != full[i];
+    bad_ring += ring_mismatches();
+    int bad_state = save_state_digest() != saved;
+    printf("round trip: %u-byte block, %u records; load recomposited %u cells (%u stamps, "
+           "%u new tiles) in %.0f us vs %.0f us for the whole map (host); tiles off: %d "
+           "after the edits, %d after the load; ring/VRAM entries off: %d; state %s\n",
+           block, ss->load_records, ss->load_cells, ss->load_stamped, ss->load_tiles,
+           t_load * 1e6, t_full * 1e6, bad_local, bad_load, bad_ring,
+           bad_state ? "DIFFERS" : "matches");
+
+    // Incremental saves: a few cells and a step of the player each, through
+    // slot compactions, then one reload
+    rng_state = 12345;
+    for (int k = 0; k < saves; k++) {
+        for (int e = 0, ne = 1 + rng_next() % 3; e < ne; e++) {
+            int c = 20 + rng_next() % 160, r = rng_next() % MAP_ROWS;
+            sim_edit_cell(c, r, rng_next() % 5, rng_next() % 5, rng_next() % (MAX_HEIGHT + 1));
+        }
+        player.world_x += INT2FP(1);
+        save_request();
+        save_drain();
+    }
+    u32 want = save_state_digest();
+    u32 comp = ss->compactions, blocks = ss->saves, overflow = ss->overflow;
+    memcpy(save_image, host_sram, sizeof(save_image));
+    save_power_cycle(save_image, 1);
+    bad_state += save_state_digest() != want;
+    printf("incremental: %u saves, %u compactions, %u cells dropped; reload over %u blocks "
+           "(%u cells): state %s\n",
+           blocks, comp, overflow, ss->load_blocks, ss->load_cells,
+           save_state_digest() == want ? "matches" : "DIFFERS");
+
+    // Power loss at every byte of an append, then of a compaction (a fresh
+    // game that did not load saves into the other slot)
+    int num_new, cuts;
+    u32 old = save_state_digest();
+    sim_edit_cell(30, 4, GROUND_ROOF, SIDE_BRICK, 2);
+    int torn = save_torn(old, &num_new, &cuts);
+    printf("torn append: %d cut points, %d load as the new save, %d as neither\n",
+           cuts, num_new, torn);
+    save_power_cycle(save_image, 1);
+    old = save_state_digest();
+    save_power_cycle(save_image, 0);
+    sim_edit_cell(40, 8, GROUND_DIRT, SIDE_STONE, 3);
+    int torn2 = save_torn(old, &num_new, &cuts);
+    printf("torn compaction: %d cut points, %d load as the new save, %d as neither\n",
+           cuts, num_new, torn2);
+    generate_world();
+    return bad_ring || bad_local || bad_load || bad_state || torn || torn2;
+}
+
+//=============================================================================
+// Asset archive: per-asset size and load time, round trips, zone loads
+//=============================================================================
+static int cmd_assets(int reps) {
+    sim_boot();
+    if (!asset_init()) {
+        printf("archive header is bad\n");
+        return 1;
+    }
+    // What each asset must unpack to: the converters' arrays
+    u16 meadow[MT_PALETTE_SIZE];
+    memcpy(meadow, mt_palette, sizeof(meadow));
+    meadow[0] = RGB15(2, 2, 5);
+    struct { int id; const void *want; } checks[] = {
+        { ASSET_FX_TILES, fxTiles }, { ASSET_FX_PAL, fxPal },
+        { ASSET_HERO_PAL, anim_heroPal }, { ASSET_PAL_MEADOW, meadow },
+    };
+    static const char *const comp[] = { "raw", "lz77", "rle" };
+    static u8 scratch[0x4000] __attribute__((aligned(4)));
+    u32 rom = 0, raw = 0;
+    int bad = 0;
+    printf("  id name           comp    ROM    raw  ratio  cycles  lines  host ns\n");
+    for (int id = 0; id < ASSET_COUNT; id++) {
+        const AssetEntry *e = asset_entry(id);
+        double t0 = now_sec();
+        u32 cycles = 0;
+        for (int k = 0; k < reps; k++) cycles = asset_load(id, scratch, ASSET_TO_WRAM);
+        double ns = (now_sec() - t0) * 1e9 / reps;
+        printf("  %2d %-14s %-5s %6u %6u %5.0f%% %7u %6.1f %8.0f\n", id, assetNames[id],
+               comp[e->comp], e->size, e->raw_size, 100.0 * e->size / e->raw_size, cycles,
+               to_lines(cycles), ns);
+        rom += e->size;
+        raw += e->raw_size;
+        for (unsigned c = 0; c < sizeof(checks) / sizeof(checks[0]); c++)
+            if (checks[c].id == id) bad += memcmp(scratch, checks[c].want, e->raw_size) != 0;
+        bad += e->id != id || (e->offset & 3) != 0;
+    }
+    printf("total: %u bytes in ROM for %u unpacked (%.0f%%), archive %u bytes with its index\n",
+           rom, raw, 100.0 * rom / raw, (u32)sizeof(assetArchive));
+
+    // The boot load straight to OBJ VRAM, and the zone palettes on the route
+    start_bench_route();
+    bad += memcmp(&tile_mem[4][OBJ_FX_TILE0], fxTiles, fxTilesLen) != 0;
+    int zones = 0, stale = 0, last = -1;
+    while (replay_mode() == REPLAY_PLAY) {
+        sim_frame();
+        if (asset_zone_loaded != last) {
+            last = asset_zone_loaded;
+            zones++;
+        }
+        // The palette follows at the VBlank after the zone changes
+        stale += memcmp(pal_bg_mem, asset_rom(ASSET_PAL_MEADOW + last),
+                        asset_entry(ASSET_PAL_MEADOW + last)->raw_size) != 0;
+    }
+    bad += stale > zones;
+    const AssetStats *as = &asset_stats;
+    const AssetLoadStats *ls = &asset_load_stats[ASSET_PAL_MEADOW];
+    printf("bench_route: %d zones entered, %u zone loads, %u asset loads (%u bytes); "
+           "palette one frame behind the zone on %d frames; a palette costs %u cycles "
+           "in the VBlank ISR\n",
+           zones, as->zone_loads, as->loads, as->bytes, stale, ls->cycles_peak);
+    printf("round trips: %s\n", bad ? "FAILED" : "ok");
+    return bad;
+}
+
+//=============================================================================
+// Zone transitions: staging cost, dropped frames, the flip's first frame
+//=============================================================================
+// Bench route under the load model until the ruins, then back to the
+// meadow behind `mask`, staging `cols` ring columns per frame (the governor
+// trims it on tight frames); the cut also edits a destination cell mid-staging
+static int zone_warp(int mask, int cols, int edit) {
+    static const char *const names[] = { "cut", "mosaic", "fade" };
+    start_bench_route();
+    stream_stage_cols = cols;
+    load_model = 1;
+    while (replay_mode() == REPLAY_PLAY && player.tile_col < 185)
+        sim_frame();
+    if (mask == WARP_FADE) script_start(SCRIPT_PORTAL);   // through the VM
+    else warp_start(3, 8, mask);
+
+    FrameStats f0 = frame_stats;
+    u32 v0 = vblank_count;
+    u16 shown = REG_BG0CNT & ~BG_MOSAIC;
+    int sub_wx = 0, sub_wy = 0, flip_diff = -1, flip_frames = 0, edited = 0;
+    int bad = 0;
+    do {
+        u32 r0 = frame_stats.renders;
+        sim_frame();
+        if (edit && !edited && stream_stats.stage_cols >= 48) {
+            sim_edit_cell(4, 8, (world_map[8][4].ground + 1) % NUM_GROUND, SIDE_STONE,
+                          world_map[8][4].height);
+            edited = 1;
+        }
+        // The previous submission was committed while this frame waited:
+        // when it brought the new BG0CNT, the screen must show the new set
+        // exactly as the world render sees that frame's camera
+        if ((REG_BG0CNT & ~BG_MOSAIC) != shown) {
+            shown = REG_BG0CNT & ~BG_MOSAIC;
+            flip_frames++;
+            flip_diff = golden_hw_diff(sub_wx, sub_wy);
+            bad += shown != stream_bg0cnt() || stream_set != 1;
+        }
+        if (frame_stats.renders != r0) {
+            sub_wx = FP2INT(camera.x);
+            sub_wy = FP2INT(camera.y);
+        }
+        bad += vblank_count - v0 > 600;
+    } while (!bad && warp_state != WARP_IDLE);
+    load_model = 0;
+    u32 skipped = frame_stats.skipped - f0.skipped, dropped = frame_stats.dropped - f0.dropped;
+    int ring = ring_mismatches();
+    bad += flip_frames != 1 || flip_diff != 0 || ring != 0 || skipped || dropped ||
+           warp_stats.warps != 1;
+    const StreamStats *st = &stream_stats;
+    printf("%-6s %4u %6u %6u %7.1f %7u %7u %5d %5d %s\n", names[mask],
+           warp_stats.steps, warp_stats.stage_frames, st->cycles_peak,
+           to_lines(st->cycles_peak), skipped, dropped, flip_diff, ring, bad ? "FAILED" : "ok");
+    return bad != 0;
+}
+
+static int cmd_zones(int cols) {
+    printf("set 0: CBB %d + SBB %d-%d, set 1: CBB %d + SBB %d-%d, %d tiles each\n",
+           stream_cbb[0], stream_sbb[0], stream_sbb[0] + 3,
+           stream_cbb[1], stream_sbb[1], stream_sbb[1] + 3, TILE_SET_TILES);
+    printf("mask   steps staged  peak  lines/frame skipped dropped  flip  ring\n");
+    int bad = 0;
+    bad += zone_warp(WARP_CUT, cols, 1);
+    bad += zone_warp(WARP_MOSAIC, cols, 0);
+    bad += zone_warp(WARP_FADE, cols, 0);
+    // What one frame would cost to rebuild the shown set instead
+    u32 whole = (u32)num_tiles * STAGE_TILE_CYCLES + 64 * STAGE_COL_CYCLES;
+    printf("staged over %u frames at %d tiles + %d columns each; rebuilding the shown "
+           "set in one frame would take %u cycles (%.0f lines, %.2f frames) behind a "
+           "blank screen\n",
+           warp_stats.stage_frames, stream_stage_tiles, cols, whole, to_lines(whole),
+           (double)whole / CYCLES_PER_FRAME);
+    // find_or_add_tile() stops at one set's worth, so a full dictionary
+    // means tiles were dropped to tile 0
+    printf("dictionary: %d of %d tiles after the edit\n", num_tiles, TILE_SET_TILES);
+    bad += num_tiles >= TILE_SET_TILES;
+    printf("transitions: %s\n", bad ? "FAILED" : "ok");
+    return bad;
+}
+
+static int cmd_govern(void) {
+    // Ungoverned, the fortress is expected to drop frames; governed it must not
+    govern_run(0);
+    int dropped = govern_run(1);
+    printf("fortress at 60 fps: %s\n", dropped ? "FAILED" : "ok");
+    return dropped != 0;
+}
+
+static int cmd_sweep(int jobs, u32 first, int count, long frames) {
+    double t0 = now_sec();
+    for (int j = 0; j < jobs; j++) {
+        pid_t pid = fork();
+        if (pid < 0) { perror("fork"); return 1; }
+        if (pid == 0) {
+            int fails = 0;
+            for (int i = j; i < count; i += jobs)
+                fails += fuzz_seed(first + i, frames, 0);
+            _exit(fails ? 1 : 0);
+        }
+    }
+    int failed_jobs = 0;
+    for (int j = 0; j < jobs; j++) {
+        int status;
+        wait(&status);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed_jobs++;
+    }
+    double t1 = now_sec();
+    printf("sweep: %d seeds x %ld frames on %d jobs in %.2f s (%.0f frames/s), %s\n",
+           count, frames, jobs, t1 - t0, count * (double)frames / (t1 - t0),
+           failed_jobs ? "FAILED" : "ok");
+    return failed_jobs ? 1 : 0;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+        "usage: isogame-host bench  [-n iters]\n"
+        "       isogame-host replay [-o period]\n"
+        "       isogame-host fuzz   [-s seed] [-n frames]\n"
+        "       isogame-host sweep  [-j jobs] [-s seed] [-c count] [-n frames]\n"
+        "       isogame-host golden [update]\n"
+        "       isogame-host ring   [-s seed] [-n steps]\n"
+        "       isogame-host entities [-n iters]\n"
+        "       isogame-host sprites [-n frames]\n"
+        "       isogame-host mux [-n frames]\n"
+        "       isogame-host particles [-n frames]\n"
+        "       isogame-host flow [-n iters]\n"
+        "       isogame-host ai [-n steps]\n"
+        "       isogame-host los [-n frames]\n"
+        "       isogame-host triggers [-n passes]\n"
+        "       isogame-host scripts [-n rounds]\n"
+        "       isogame-host sound [-n frames]\n"
+        "       isogame-host save [-n saves]\n"
+        "       isogame-host assets [-n reps]\n"
+        "       isogame-host zones [-n cols]\n"
+        "       isogame-host govern\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) { usage(); return 2; }
+    const char *cmd = argv[1];
+
+    long n = -1;
+    u32 seed = 1;
+    int count = 64;
+    int stall = 0;
+    int jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (jobs < 1) jobs = 1;
+
+    int opt;
+    optind = 2;
+    while ((opt = getopt(argc, argv, "n:s:c:j:o:")) != -1) {
+        switch (opt) {
+            case 'n': n = atol(optarg); break;
+            case 's': seed = (u32)strtoul(optarg, 0, 0); break;
+            case 'c': count = atoi(optarg); break;
+            case 'j': jobs = atoi(optarg); break;
+            case 'o': stall = atoi(optarg); break;
+            default: usage(); return 2;
+        }
+    }
+
+    if (!strcmp(cmd, "bench"))     return cmd_bench(n > 0 ? (int)n : 20);
+    if (!strcmp(cmd, "replay"))    return cmd_replay(stall);
+    if (!strcmp(cmd, "fuzz"))      return fuzz_seed(seed, n > 0 ? n : 1000000, 1);
+    if (!strcmp(cmd, "sweep"))     return cmd_sweep(jobs, seed, count, n > 0 ? n : 100000);
+    if (!strcmp(cmd, "golden"))    return golden_main(argc > 2 && !strcmp(argv[2], "update"));
+    if (!strcmp(cmd, "ring"))      return ring_main(seed, n > 0 ? n : 20000);
+    if (!strcmp(cmd, "entities"))  return cmd_entities(n > 0 ? (int)n : 100000);
+    if (!strcmp(cmd, "sprites"))   return cmd_sprites(n > 0 ? (int)n : 10000);
+    if (!strcmp(cmd, "mux"))       return cmd_mux(n > 0 ? (int)n : 600);
+    if (!strcmp(cmd, "particles")) return cmd_particles(n > 60 ? (int)n : 3000);
+    if (!strcmp(cmd, "flow"))      return cmd_flow(n > 0 ? (int)n : 2000);
+    if (!strcmp(cmd, "ai"))        return cmd_ai(n > 0 ? (int)n : 3000);
+    if (!strcmp(cmd, "los"))       return cmd_los(n > 0 ? (int)n : 3000);
+    if (!strcmp(cmd, "triggers"))  return cmd_triggers(n > 0 ? (int)n : 2000);
+    if (!strcmp(cmd, "scripts"))   return cmd_scripts(n > 0 ? (int)n : 200);
+    if (!strcmp(cmd, "sound"))     return cmd_sound(n > 0 ? (int)n : 600);
+    if (!strcmp(cmd, "save"))      return cmd_save(n > 0 ? (int)n : 300);
+    if (!strcmp(cmd, "assets"))    return cmd_assets(n > 0 ? (int)n : 1000);
+    if (!strcmp(cmd, "zones"))     return cmd_zones(n > 0 ? (int)n : STAGE_COLS);
+    if (!strcmp(cmd, "govern"))    return cmd_govern();
+    usage();
+    return 2;
+}
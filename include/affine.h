@@ -0,0 +1,43 @@
+// affine.h — Shared OBJ affine matrices
+//
+// OAM holds 32 affine matrices, interleaved with the OBJ entries (the spare
+// fourth halfword of four consecutive entries). Draw code asks for a
+// (rotation, scale) pair per OBJ each frame; equal requests share a matrix,
+// so a burst of particles spinning in step costs one slot. When all 32 are
+// taken affine_get() says so and the caller draws a plain OBJ instead.
+// affine_end() writes the matrices into obj_buffer after sprite_end(), and
+// they reach OAM with the frame's OBJs.
+#ifndef AFFINE_H
+#define AFFINE_H
+
+#include "platform.h"
+
+#define AFFINE_MAX        32
+#define AFFINE_TURN       256     // angle units per full turn
+#define AFFINE_ONE        256     // scale 1.0 (8.8)
+
+typedef struct {
+    u32 requests;       // affine_get() calls in the latest frame
+    u32 used;           // matrices in the latest frame
+    u32 peak;
+    u32 full;           // requests refused (all matrices taken), latest frame
+    u32 full_total;
+} AffineStats;
+
+extern AffineStats affine_stats;
+
+void affine_init(void);
+// Draw: forget last frame's matrices
+void affine_begin(void);
+// Draw: matrix showing an OBJ turned counter-clockwise by `angle` and
+// scaled by `scale` (8.8, > 0), or -1 if all are taken
+int  affine_get(int angle, int scale);
+// After sprite_end(): write the matrices into obj[]; returns the number of
+// obj entries that hold them (to copy to OAM)
+int  affine_end(OBJ_ATTR *obj);
+
+// sin(angle) in .12 fixed point, angle in AFFINE_TURN units
+int  affine_sin(int angle);
+static inline int affine_cos(int angle) { return affine_sin(angle + AFFINE_TURN / 4); }
+
+#endif // AFFINE_H
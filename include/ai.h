@@ -0,0 +1,64 @@
+// ai.h — Time-sliced actor thinking under a per-step cycle budget
+//
+// Actors split into cheap movement, run every logic step by the pool pass,
+// and thinking (state changes, path and sight queries), run only every
+// `interval` steps at a per-slot phase so a crowd's thinks spread evenly.
+// The governor stretches intervals (gov_knobs->ai_think_div). Due thinks
+// are queued during the pass and run after it while the step's cycles,
+// measured with timing_cycles(), stay under ai_budget_cycles (a think may
+// overrun it by its own query cost); the rest wait for the next step and go
+// first there, so an overloaded budget stretches intervals instead of
+// starving anyone.
+#ifndef AI_H
+#define AI_H
+
+#include "platform.h"
+
+#define AI_QUEUE            96      // = MAX_ENTITIES
+#define AI_BUDGET_CYCLES    6000    // per logic step (~5 scanlines)
+
+// Think cost model (ARM7 cycles, estimated) for the host build, whose
+// timers do not run: dispatch and state update, plus what each query costs.
+// AI_THINK_CYCLES is also the least a think is assumed to need.
+#define AI_THINK_CYCLES     150
+#define AI_PATH_CYCLES      40      // one flow-field lookup
+
+typedef struct {
+    u32 due;            // thinks that came due in the latest step
+    u32 thinks;         // thinks run in the latest step
+    u32 deferred;       // thinks left for the next step
+    u32 cycles;         // cycles spent in the latest step (host: cost model)
+    u32 thinks_peak;
+    u32 deferred_peak;
+    u32 cycles_peak;
+    u32 wait_peak;      // most steps a think waited past its due step
+    u32 thinks_total;
+    u32 deferred_total;
+} AiStats;
+
+extern AiStats ai_stats;
+extern int ai_budget_cycles;
+extern u8 ai_countdown[AI_QUEUE];   // steps to each slot's next think, 0 = unphased
+
+void ai_init(void);
+// Steps to slot i's first think: its phase, (step + i) % interval == 0
+int  ai_phase(int i, int interval, u32 step);
+// Pool pass: is slot i's think due this step (every `interval` steps)? A
+// per-slot countdown, so the pass does not divide (the ARM7 has no divider);
+// a changed interval takes effect after the next think
+static inline int ai_due(int i, int interval, u32 step) {
+    if (!ai_countdown[i]) ai_countdown[i] = (u8)ai_phase(i, interval, step);
+    if (--ai_countdown[i]) return 0;
+    ai_countdown[i] = (u8)interval;
+    return 1;
+}
+u32  ai_step(void);                 // logic step counter for ai_due()
+// Pool pass: queue slot i's think for this step
+void ai_request(int i);
+// Slot freed: drop any queued think
+void ai_forget(int i);
+// After the pool pass: run queued thinks (oldest first) within the budget;
+// think() returns its modelled cycles beyond AI_THINK_CYCLES (host build)
+void ai_run(int (*think)(int i));
+
+#endif // AI_H
@@ -0,0 +1,64 @@
+// anim.h — Data-driven sprite animation tables
+//
+// An AnimSet is one converted sprite sheet (tools/convert_sprites.py): 4bpp
+// 32×32 cells stored once per unique direction, plus animations as runs of
+// (cell, duration) frames. Mirrored directions reuse a stored row and are
+// drawn with ATTR1_HFLIP, so symmetric characters store half the cells.
+// Each cell is trimmed to a meta-sprite: only its non-empty tiles are kept,
+// grouped into a few OBJ pieces that sprite_add_meta() expands into OAM.
+#ifndef ANIM_H
+#define ANIM_H
+
+#include "sprite.h"
+
+#define ANIM_HOLD        0xFF    // AnimSeq.loop: stay on the last frame
+
+typedef struct {
+    u8 cell;          // column within the direction's row
+    u8 duration;      // logic steps
+} AnimFrame;
+
+typedef struct {
+    u8 first;         // index into AnimSet.frames
+    u8 count;
+    u8 loop;          // frame to restart from after the last, or ANIM_HOLD
+    u8 pad;
+} AnimSeq;
+
+typedef struct {
+    u16 word;         // first tile of the cell in AnimSet.tiles, in words
+    u8 num_tiles;     // ≤ 16
+    u8 first_piece;   // index into AnimSet.pieces
+    u8 num_pieces;
+    u8 pad;
+} MetaCell;
+
+typedef struct {
+    const u32 *tiles;          // trimmed cells, each piece's tiles in 1D order
+    const u16 *pal;            // 16 colours
+    const MetaCell *cells;     // [rows][cells_per_row]
+    const MetaPiece *pieces;
+    const AnimFrame *frames;
+    const AnimSeq *seqs;
+    u8 num_seqs;
+    u8 cells_per_row;
+    u8 dir_row[4];             // stored row per DIR_*
+    u8 dir_flip;               // bit per DIR_*: draw the row mirrored
+} AnimSet;
+
+// Advance one logic step; *pos and *timer are the caller's per-actor state
+void anim_step(const AnimSet *set, int seq, u8 *pos, u8 *timer);
+
+// Cell for frame `pos` of `seq` facing `dir`; *attr1_flip receives
+// ATTR1_HFLIP or 0
+const MetaCell *anim_cell(const AnimSet *set, int seq, int pos, int dir, u16 *attr1_flip);
+
+static inline const u32 *anim_cell_tiles(const AnimSet *set, const MetaCell *mc) {
+    return &set->tiles[mc->word];
+}
+
+static inline const MetaPiece *anim_cell_pieces(const AnimSet *set, const MetaCell *mc) {
+    return &set->pieces[mc->first_piece];
+}
+
+#endif // ANIM_H
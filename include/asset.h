@@ -0,0 +1,90 @@
+// asset.h — ROM asset archive: indexed in place, unpacked by the BIOS
+//
+// tools/build_archive.py packs runtime-loaded assets into one ROM array
+// (data/archive.c): a header, an index of AssetEntry records and the data.
+// Nothing is copied to find an asset: asset_rom() is the data's address in
+// ROM, which in-place assets (palettes read by setup code) use directly.
+// asset_load() copies a raw asset with DMA3 (by halfwords when its size is
+// not whole words) or unpacks a compressed one with the BIOS
+// (LZ77UnComp*/RLUnComp*, the Vram variants for 16-bit destinations) and
+// times it with timer 1.
+//
+// Each zone lists the assets it needs (assetZoneLoads); asset_update()
+// loads the set when trigger_zone changes. BG palettes are applied by
+// asset_vblank() so colours never change mid-frame.
+#ifndef ASSET_H
+#define ASSET_H
+
+#include "platform.h"
+
+#define ASSET_MAGIC       0x31435241   // "ARC1"
+#define ASSET_NONE        0xFF
+
+enum { ASSET_RAW = 0, ASSET_LZ77, ASSET_RLE };
+enum { ASSET_TO_WRAM = 0, ASSET_TO_VRAM };       // asset_load() destinations
+enum { ASSET_DST_BG_PAL = 0, ASSET_DST_OBJ_TILES }; // zone loads
+
+// Cost model (ARM7 cycles, estimated) when timer 1 is not running: call
+// overhead, then per unpacked byte for DMA3 from ROM, BIOS RLE and LZ77
+#define ASSET_CALL_CYCLES   150
+#define ASSET_RAW_CYCLES_X4 5           // per 4 bytes: 32-bit DMA, ROM 3/1 waits
+#define ASSET_RLE_CYCLES    8
+#define ASSET_LZ77_CYCLES   14
+
+typedef struct {
+    u32 magic;
+    u16 count;
+    u16 pad;
+} AssetHeader;
+
+// Index entry, 16 bytes
+typedef struct {
+    u16 id;
+    u8  comp;           // ASSET_RAW / LZ77 / RLE
+    u8  flags;
+    u32 offset;         // from the archive start, 4-byte aligned
+    u32 size;           // bytes in ROM (BIOS header included)
+    u32 raw_size;       // bytes unpacked
+} AssetEntry;
+
+// Zone load: asset, destination, and its argument (first colour, first tile)
+typedef struct {
+    u8  id;
+    u8  dst;            // ASSET_DST_*
+    u16 arg;
+} AssetLoad;
+
+typedef struct {
+    u32 loads;
+    u32 cycles;         // latest load
+    u32 cycles_peak;
+} AssetLoadStats;
+
+typedef struct {
+    u32 zone_loads;     // zone changes handled
+    u32 loads;          // asset loads, total
+    u32 bytes;          // bytes unpacked, total
+    u32 cycles;         // asset cycles of the latest logic step
+    u32 cycles_peak;
+} AssetStats;
+
+extern AssetStats asset_stats;
+extern AssetLoadStats asset_load_stats[];   // per asset id
+extern int asset_zone_loaded;               // ZONE_* resident, -1 before the first
+
+// Boot, before anything loads assets; 0 if the archive header is bad
+int  asset_init(void);
+const AssetEntry *asset_entry(int id);
+// The asset's bytes in ROM (packed data for compressed assets)
+const void *asset_rom(int id);
+// Copy or unpack to `dst`; returns the cycles taken
+u32  asset_load(int id, void *dst, int to);
+
+// Load a zone's set now (BG palettes wait for the next VBlank)
+void asset_zone(int zone);
+// Once per logic step, after trigger_update()
+void asset_update(void);
+// VBlank ISR: apply a pending BG palette
+void asset_vblank(void);
+
+#endif // ASSET_H
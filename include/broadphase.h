@@ -0,0 +1,55 @@
+// broadphase.h — Column-band spatial hash over the actor pool
+//
+// The strip is 200 columns by 16 rows, so actors are bucketed by column
+// band and height: a bucket holds the actors standing in BP_BAND_COLS
+// columns at one height level, chained through per-slot links. The pool
+// keeps the buckets current as actors spawn, move between bands and
+// despawn (one relink per band crossing, no per-frame rebuild). Queries
+// visit only the buckets a box overlaps, so the pair tests behind a sword
+// hitbox or a contact check grow with the local crowd, not the pool size.
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include "game.h"
+
+#define BP_BAND_COLS   4
+#define BP_BANDS       ((MAP_COLS + BP_BAND_COLS - 1) / BP_BAND_COLS)
+#define BP_HEIGHTS     (MAX_HEIGHT + 1)
+#define BP_NONE        0xFF
+#define BP_NO_BUCKET   0xFFFF
+
+// Type mask for queries: bit per ENT_* type
+#define BP_TYPE(t)     (1u << (t))
+
+typedef struct {
+    u32 queries;        // latest step
+    u32 tests;          // narrow-phase pair tests, latest step
+    u32 hits;
+    u32 naive;          // tests an all-pairs scan would have made, latest step
+    u32 moves;          // band crossings, latest step
+    u32 tests_peak;
+    u32 queries_total;
+    u32 tests_total;
+    u32 naive_total;
+} BroadStats;
+
+extern BroadStats broad_stats;
+
+void broadphase_init(void);
+// Pool hooks: slot i's col/height are set (insert, moved) or about to go
+void broadphase_insert(int i);
+void broadphase_remove(int i);
+void broadphase_moved(int i);
+// End of the logic step: publish the per-step counters
+void broadphase_end_step(void);
+// Debug: live actors missing from the bucket of their col/height
+int  broadphase_verify(void);
+
+// Actors of `types` standing on (col, row) at `height`, except slot `skip`;
+// up to `max` slots go to out[] (may be NULL). Returns the number found.
+int  broadphase_tile(int col, int row, int height, u32 types, int skip, u8 *out, int max);
+// Actors of `types` at `height` within `radius` world pixels (per axis, iso
+// base plane) of (wx, wy)
+int  broadphase_near(int wx, int wy, int height, int radius, u32 types, u8 *out, int max);
+
+#endif // BROADPHASE_H
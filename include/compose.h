@@ -0,0 +1,47 @@
+// compose.h — Boot-time metatile compositor and tile dictionary
+#ifndef COMPOSE_H
+#define COMPOSE_H
+
+#include "game.h"
+
+// Pre-computed world tilemap (WORLD_TILE_W × WORLD_TILE_H tile ids)
+// and the deduplicated 8bpp tile pixels it indexes
+extern u16 world_tilemap[WORLD_TILE_H * WORLD_TILE_W];
+extern u8 tile_dict[MAX_PRECOMP_TILES][64];
+extern int num_tiles;
+
+//=============================================================================
+// Compositor statistics (host benchmarks build with -DCOMPOSE_STATS)
+//=============================================================================
+#ifdef COMPOSE_STATS
+typedef struct {
+    u32 stamps_top;    // stamp_metatile() calls
+    u32 stamps_side;   // stamp_side_face() calls with a non-empty face
+    u32 lookups;       // find_or_add_tile() calls
+    u32 probes;        // hash slots inspected, summed over all lookups
+    u32 probe_max;     // longest single probe sequence
+    u32 dict_full;     // lookups dropped to tile 0 (dictionary or table full)
+} ComposeStats;
+extern ComposeStats compose_stats;
+#define COMPOSE_STAT(stmt)  do { stmt; } while (0)
+#else
+#define COMPOSE_STAT(stmt)  do { } while (0)
+#endif
+
+int  find_or_add_tile(const u8 *pixels);
+void stamp_metatile(int mt_idx, int px, int py);
+void stamp_side_face(int mt_idx, int face, int wx, int top_y, int face_h);
+
+// Composite world_map into world_tilemap/tile_dict (back-to-front)
+void precompute_world(void);
+
+// Tile rectangle [c0, c1) × [r0, r1) of world_tilemap
+typedef struct { int c0, r0, c1, r1; } ComposeRect;
+
+// A cell changed after boot: recomposite the tiles it can cover (any
+// height) from world_map, exactly as precompute_world() would have. New
+// tiles are appended to tile_dict from the old num_tiles; *rect receives
+// the tiles rewritten. Returns the cells restamped.
+int  compose_cell(int col, int row, ComposeRect *rect);
+
+#endif // COMPOSE_H
@@ -0,0 +1,90 @@
+// entity.h — Structure-of-arrays actor pool with camera-band activation
+//
+// Actors (enemies, pickups, later projectiles) live in fixed parallel arrays
+// indexed by slot; free slots are chained through next_free. ROM spawn
+// records sorted by column are turned into actors when the camera's column
+// band reaches them and handed back (re-dormanted) once they fall behind.
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include "game.h"
+
+#define MAX_ENTITIES      96
+#define ENT_NO_SPAWN      0xFF   // slot not created from a ROM spawn record
+#define ENT_NONE_SLOT     0xFF   // free-list terminator
+
+// Bands are measured in map columns from the camera's column
+#define ENT_SPAWN_COLS    24     // spawn records entering this band wake up
+#define ENT_ACTIVE_COLS   24     // actors within this band are updated
+#define ENT_DESPAWN_COLS  32     // actors beyond this band go dormant
+
+#define ENT_WALK_SPEED    (FP_ONE / 2)
+#define ENT_CONTACT_RADIUS 8     // world pixels, per axis, actor vs player
+
+// Guards chase the player along the flow field (flowfield.h) once it is this
+// many steps away, and give up beyond the second
+#define ENT_CHASE_DIST    10
+#define ENT_GIVE_UP_DIST  20
+
+// Think intervals in logic steps (ai.h), stretched by gov_knobs->ai_think_div
+#define ENT_THINK_GUARD   4
+#define ENT_THINK_SLIME   8
+
+// Until actors get their own art they borrow the hero sheet, tinted
+#define ENT_PAL_GUARD     1
+#define ENT_PAL_SLIME     2
+
+enum { ENT_NONE = 0, ENT_GUARD, ENT_SLIME, ENT_PICKUP, NUM_ENT_TYPES };
+enum { ENT_ST_IDLE = 0, ENT_ST_WALK, ENT_ST_CHASE, ENT_ST_HOLD };  // HOLD: on the player's tile
+
+// Broadphase type mask (broadphase.h) of actors that block and hurt
+#define ENT_WALKERS       ((1u << ENT_GUARD) | (1u << ENT_SLIME))
+
+typedef struct {
+    int x[MAX_ENTITIES], y[MAX_ENTITIES];   // 24.8 world position (base plane)
+    u16 col[MAX_ENTITIES];                  // current map tile
+    u8  row[MAX_ENTITIES];
+    u8  height[MAX_ENTITIES];
+    u8  type[MAX_ENTITIES];                 // ENT_*, ENT_NONE = free slot
+    u8  state[MAX_ENTITIES];                // ENT_ST_*
+    u8  dir[MAX_ENTITIES];                  // DIR_*
+    u8  frame[MAX_ENTITIES];
+    u8  anim_timer[MAX_ENTITIES];
+    u8  spawn[MAX_ENTITIES];                // ROM spawn index or ENT_NO_SPAWN
+    u8  next_free[MAX_ENTITIES];
+} EntityPool;
+
+// ROM spawn record; world_spawns[] is sorted by col
+typedef struct {
+    u8 col, row, type;
+} SpawnDef;
+
+typedef struct {
+    u32 live;           // allocated slots
+    u32 active;         // actors updated in the latest pass
+    u32 peak_active;
+    u32 spawned;        // spawn records woken
+    u32 despawned;      // actors sent dormant
+    u32 alloc_failed;   // spawns dropped because the pool was full
+    u32 contacts;       // walkers touching the player, latest step
+    u32 chasing;        // guards chasing, latest step
+} EntityStats;
+
+extern EntityPool ents;
+extern EntityStats entity_stats;
+extern int ent_high_water;          // slots [0, ent_high_water) may be live
+
+extern const SpawnDef world_spawns[];
+extern const int num_world_spawns;
+
+void entity_init(void);
+int  entity_alloc(void);            // slot index, or -1 if the pool is full
+void entity_free(int i);
+int  entity_spawn(int type, int col, int row, int dir);
+
+// Once per logic step, after camera_update()
+void entity_update(void);
+// Render: add visible actors to the sprite builder
+void entity_draw(void);
+
+#endif // ENTITY_H
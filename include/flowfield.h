@@ -0,0 +1,48 @@
+// flowfield.h — Shared height-aware flow field toward the player
+//
+// One breadth-first field over a FLOW_COLS-column window of the strip,
+// centred on the player's tile, tells every chasing actor which way to step.
+// Moves follow the player's own rules: walk to the same height, jump up
+// exactly one level, drop any number of levels. The field is searched
+// backwards from the player, so a cell's direction leads to a neighbour
+// the actor can actually reach.
+//
+// A rebuild starts when the player stands on a new tile and is spread
+// over several logic steps, FLOW_CELLS_PER_STEP cells at a time, into a
+// back buffer; actors keep following the last complete field meanwhile.
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+#include "game.h"
+
+#define FLOW_COLS            48
+#define FLOW_CELLS           (FLOW_COLS * MAP_ROWS)
+#define FLOW_CELLS_PER_STEP  (2 * FLOW_COLS)   // two window rows per step
+#define FLOW_HERE            4                 // flow_dir(): on the target tile
+#define FLOW_NONE            0xFF              // unreachable or outside the field
+#define FLOW_FAR             0xFFFF            // flow_dist() of FLOW_NONE cells
+
+typedef struct {
+    u32 builds;         // fields completed
+    u32 build_steps;    // logic steps the latest field took
+    u32 cells;          // cells expanded in the latest step
+    u32 cells_peak;
+    u32 cells_total;
+    u32 reached;        // reachable cells in the latest field
+    u32 lookups;        // flow_dir()/flow_dist() calls
+    u32 outside;        // lookups outside the current field
+} FlowStats;
+
+extern FlowStats flow_stats;
+
+void flow_init(void);
+// Once per logic step with the player's tile: starts or continues a rebuild
+void flow_update(int col, int row);
+// Build the whole field for (col, row) now (boot, benchmarks)
+void flow_build_now(int col, int row);
+// DIR_* to step from (col, row) toward the target, FLOW_HERE or FLOW_NONE
+int  flow_dir(int col, int row);
+// Steps from (col, row) to the target, or FLOW_FAR
+int  flow_dist(int col, int row);
+
+#endif // FLOWFIELD_H
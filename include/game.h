@@ -2,7 +2,7 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include <tonc.h>
+#include "platform.h"
 
 //=============================================================================
 // Screen
@@ -22,7 +22,9 @@
 //=============================================================================
 // Map — long side-scroller strip
 //=============================================================================
-#define MAP_COLS     200
+#ifndef MAP_COLS
+#define MAP_COLS     200  // overridable for host benchmarks (-DMAP_COLS=n)
+#endif
 #define MAP_ROWS     16
 #define MAX_HEIGHT   4
 
@@ -49,6 +51,13 @@
 #define BG_MAP_H     64
 #define TILE_CBB     0
 #define TILE_SBB     28
+// Second charblock/screenblock set, staged while the first is shown (stream.h).
+// Either set's tiles stop short of the other's screenblocks: CBB 0 holds
+// tiles at 0x0000–0x5FFF below SBB 12–15, CBB 2 at 0x8000–0xDFFF below SBB 28–31.
+#define TILE_CBB_ALT 2
+#define TILE_SBB_ALT 12
+#define TILE_SETS    2
+#define TILE_SET_TILES 384   // 8bpp tiles per set (24 KB)
 
 //=============================================================================
 // World pixel extents (with height stacking)
@@ -59,8 +68,10 @@
 //=============================================================================
 #define WORLD_PX_X0  (-256)
 #define WORLD_PX_Y0  (-64)     // account for max height elevation
-#define WORLD_PX_X1  (3200)
-#define WORLD_PX_Y1  (1800)    // (199+15)*8 + 8 + MAX_HEIGHT*16 + 8 = 1792, round up
+#define WORLD_PX_X1  (MAP_COLS * ISO_HALF_W)  // 3200
+// (199+15)*8 + 8 + MAX_HEIGHT*16 + 8 = 1792, round up to 1800
+#define WORLD_PX_Y1  (((MAP_COLS - 1) + (MAP_ROWS - 1)) * ISO_HALF_H + ISO_HALF_H + \
+                      MAX_HEIGHT * SIDE_HEIGHT + 16)
 
 #define WORLD_TILE_W ((WORLD_PX_X1 - WORLD_PX_X0) / 8)  // 432
 #define WORLD_TILE_H ((WORLD_PX_Y1 - WORLD_PX_Y0) / 8)  // 227
@@ -74,7 +85,11 @@
 //=============================================================================
 // Pre-computed tilemap limits
 //=============================================================================
-#define MAX_PRECOMP_TILES 1024
+// The dictionary is uploaded whole to one BG set, so it may not outgrow one;
+// the compositor bench raises it to measure wider maps
+#ifndef MAX_PRECOMP_TILES
+#define MAX_PRECOMP_TILES TILE_SET_TILES
+#endif
 
 //=============================================================================
 // Fixed-point (24.8)
@@ -95,6 +110,7 @@ enum { DIR_SE = 0, DIR_NE = 1, DIR_NW = 2, DIR_SW = 3 };
 #define PLAYER_SPEED     (FP_ONE * 1)
 #define PLAYER_SPR_W     32
 #define PLAYER_SPR_H     32
+#define PLAYER_ATTACK_STEPS 16   // sword swing cooldown (B)
 
 typedef struct {
     int world_x, world_y;  // fixed-point (isometric base plane)
@@ -0,0 +1,57 @@
+// govern.h — Adaptive frame-budget governor
+//
+// At the end of each frame's logic the governor reads REG_VCOUNT, adds the
+// last measured render cost and works out how many scanlines are left
+// before the frame's deadline: the VBlank commit at line 160. Lines spent
+// waiting to sample input late (present_wait_input()) count as slack on a
+// frame that made its commit, as that wait shrinks when the frame grows.
+// Optional work is scaled through a small table of quality levels: drop
+// quickly when headroom runs out (an overrun as far as it missed by), climb
+// back only after a sustained stretch of slack (hysteresis) and only into a
+// level whose last seen cost fits.
+#ifndef GOVERN_H
+#define GOVERN_H
+
+#include "platform.h"
+
+#define GOV_LEVELS        4     // 0 = full quality … 3 = minimum
+#define GOV_LOW_LINES     24    // headroom below this → degrade
+#define GOV_HIGH_LINES    72    // headroom above this → may recover
+#define GOV_DOWN_FRAMES   2     // consecutive tight frames before degrading
+#define GOV_UP_FRAMES     60    // consecutive slack frames before recovering
+#define GOV_LEVEL_LINES   32    // lines a level is taken to shed (or add)
+
+// Optional-work knobs for one quality level
+typedef struct {
+    u8 prefetch_lines;   // ring lines streamed ahead per frame (stream_prefetch)
+    u8 ai_think_div;     // AI thinks every Nth frame
+    u8 particle_cap;     // live particle limit
+    u8 stage_cols;       // ring columns staged per frame (stream_stage_cols)
+} GovKnobs;
+
+typedef struct {
+    u32 frames;              // frames governed
+    u32 decisions;           // level changes (debug counter)
+    u32 downs, ups;
+    u32 level_frames[GOV_LEVELS];
+    int headroom;            // latest estimate, scanlines before VBlank
+    int headroom_min;
+    int logic_lines;         // latest logic cost, scanlines
+    int render_lines;        // latest render cost, scanlines
+} GovStats;
+
+extern GovStats gov_stats;
+extern const GovKnobs *gov_knobs;    // knobs of the current level
+extern int gov_level;
+
+void gov_init(void);
+void gov_set_enabled(int on);        // off: pin level 0 (for A/B timing)
+
+// Main loop: before the first logic step
+void gov_begin_logic(void);
+// Main loop: after the logic steps; decides this frame's level
+void gov_end_logic(int steps);
+// Main loop: after present_submit(); records the render cost
+void gov_end_render(void);
+
+#endif // GOVERN_H
@@ -0,0 +1,45 @@
+// los.h — Cached line of sight over the heightmap
+//
+// A sight line runs from an actor's eye to the middle of the player's
+// sprite, both tile centres. It walks the tile grid cell by cell (integer
+// DDA, both neighbours at exact corners) with the ray's height interpolated
+// along the way, and stops at the first cell whose top rises above the
+// ray. Results are cached per (source tile, target tile): idle actors ask
+// the same question every think, and a player on a new tile is simply a
+// new key. Editing a map cell must call los_cell_changed(), which drops
+// every cached ray spanning its column.
+#ifndef LOS_H
+#define LOS_H
+
+#include "game.h"
+
+#define LOS_CACHE        256     // direct-mapped entries
+#define LOS_SUB          16      // height sub-steps per level
+#define LOS_EYE          24      // eye above the floor, sub-steps (1.5 levels)
+#define LOS_AIM          16      // target point above the floor, sub-steps
+
+// Cost model (ARM7 cycles, estimated) for the AI budget
+#define LOS_HIT_CYCLES   30
+#define LOS_RAY_CYCLES   60
+#define LOS_CELL_CYCLES  14
+
+typedef struct {
+    u32 queries;
+    u32 hits;           // answered from the cache
+    u32 rays;           // rays cast (misses, plus los_ray() calls)
+    u32 cells;          // cells tested by those rays
+    u32 invalidated;    // cache entries dropped by cell changes
+} LosStats;
+
+extern LosStats los_stats;
+
+void los_init(void);
+// Uncached: 1 if (dc, dr) can be seen from (sc, sr); *cells receives the
+// cells tested (may be NULL)
+int  los_ray(int sc, int sr, int dc, int dr, int *cells);
+// Cached los_ray(); *cycles receives the estimated cost (may be NULL)
+int  los_visible(int sc, int sr, int dc, int dr, int *cycles);
+// A cell's height changed: forget rays that may cross it
+void los_cell_changed(int col, int row);
+
+#endif // LOS_H
@@ -0,0 +1,76 @@
+// oammux.h — HBlank OAM multiplexing past 128 OBJs
+//
+// When a frame needs more OBJs than OAM holds, sprite_end() hands them to
+// the multiplexer instead. The screen is cut into MUX_BAND_LINES bands; an
+// OBJ belongs to the band of its top line, and its OAM entry is written a
+// few lines above that band by the HBlank interrupt, reusing an entry whose
+// previous OBJ has finished. The VBlank commit loads the entries for the
+// top band and arms the interrupt; OAM writes during HBlank need
+// DCNT_OAM_HBL, which costs OBJ render cycles per line (SPRITE_LINE_CYCLES_HBL).
+//
+// Admission (in sprite.c) guarantees the schedule fits: at most 128 entries
+// live on any line, at most MUX_BAND_WRITES rewrites per band. What does
+// not fit is held back like any other budget overflow.
+#ifndef OAMMUX_H
+#define OAMMUX_H
+
+#include "platform.h"
+
+#define MUX_OAM           128
+#define MUX_BAND_LINES    16
+#define MUX_LEAD          6     // a band's writes start this many lines above it
+#define MUX_MARGIN        2     // lines between an entry's last use and reuse,
+                                // and between a band's last write and its top
+#define MUX_PER_HBLANK    8     // entries rewritten per HBlank
+#define MUX_BAND_WRITES   ((MUX_LEAD - MUX_MARGIN) * MUX_PER_HBLANK)
+#define MUX_MAX_WRITES    320
+
+// Interrupt cost (ARM7 cycles): an HBlank is 272 cycles, so dispatch plus
+// MUX_PER_HBLANK writes must stay well inside it. The handler times itself
+// with timing_cycles(); the master ISR's dispatch around it is invisible
+// from inside, so it is an estimate. The host build, whose timers do not
+// run, charges each write instead.
+#define MUX_IRQ_CYCLES    60    // dispatch, estimated
+#define MUX_WRITE_CYCLES  12    // host: per write
+
+typedef struct {
+    u32 frames;         // frames shown multiplexed
+    u32 objs;           // OBJs in the latest multiplexed frame
+    u32 writes;         // HBlank OAM rewrites in the latest shown frame
+    u32 irqs;           // HBlank interrupts taken in the latest shown frame
+    u32 cycles;         // interrupt cycles of the latest shown frame: handlers
+                        // measured, plus MUX_IRQ_CYCLES dispatch each
+    u32 cycles_peak;
+    u32 late;           // writes made after their deadline
+    u32 no_entry;       // OBJs that found no free entry (admission bug)
+} OamMuxStats;
+
+extern OamMuxStats oammux_stats;
+
+void oammux_init(void);
+void oammux_set_enabled(int on);
+int  oammux_enabled(void);
+
+// Line an OBJ whose first visible line is `top` needs its entry from
+static inline int oammux_start_line(int top) {
+    int band_top = top - top % MUX_BAND_LINES;
+    return band_top ? band_top - MUX_LEAD : 0;
+}
+
+// Draw (from sprite_end): forget the previous frame's OBJs
+void oammux_begin(void);
+// Draw: queue one OBJ visible on lines top..bottom, in depth order; returns
+// its index for oammux_entry()
+int  oammux_add(u16 attr0, u16 attr1, u16 attr2, int top, int bottom);
+// Draw: assign entries, write the top band's OAM into obj[0..127] and queue
+// the rest for HBlank. Returns the number of obj entries to copy.
+int  oammux_build(OBJ_ATTR *obj);
+// OAM entry of queued OBJ `i` after oammux_build(), or -1
+int  oammux_entry(int i);
+
+// VBlank ISR: `fresh` when a new frame (and its obj_buffer) was just
+// committed. Restores the top band otherwise and arms the HBlank writes.
+void oammux_vblank(int fresh);
+IWRAM_CODE void oammux_hblank(void);
+
+#endif // OAMMUX_H
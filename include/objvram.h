@@ -0,0 +1,41 @@
+// objvram.h — Per-actor OBJ VRAM slots with streamed animation frames
+//
+// Every sprite owner drawn this frame holds one 16-tile slot in OBJ VRAM.
+// Draw code asks for a slot with the ROM address and tile count of the
+// (trimmed) frame it wants to show; the frame is queued for upload only
+// when it differs from what the slot already holds, and the queue is copied
+// by DMA in the VBlank commit, together with the OAM it belongs to. Slots
+// whose owner was not drawn in a frame are released at its end.
+#ifndef OBJVRAM_H
+#define OBJVRAM_H
+
+#include "platform.h"
+
+#define OBJ_SLOT_TILES    16      // one untrimmed 32×32 4bpp frame
+#define OBJ_SLOTS         48      // tiles 0..767 of OBJ VRAM
+#define OBJ_FX_TILE0      (OBJ_SLOTS * OBJ_SLOT_TILES)  // rest: effects, particles
+#define OBJ_NO_SLOT       0xFF
+
+typedef struct {
+    u32 used;           // slots held in the latest frame
+    u32 peak;
+    u32 uploads;        // frames queued in the latest frame
+    u32 uploads_total;
+    u32 bytes_total;    // bytes copied to OBJ VRAM
+    u32 full;           // requests refused (no free slot)
+} ObjVramStats;
+
+extern ObjVramStats objvram_stats;
+
+void objvram_init(void);
+// Draw: OBJ tile index of `owner`'s slot showing `frame` (`tiles` ≤ 16
+// tiles of 4bpp data in ROM), or -1 if every slot is taken
+int  objvram_frame(int owner, const void *frame, int tiles);
+// Draw, after the last request: release slots nobody asked for
+void objvram_end_frame(void);
+// VBlank commit: copy queued frames
+void objvram_commit(void);
+// Debug: slots (without a queued upload) whose VRAM differs from their frame
+int  objvram_verify(void);
+
+#endif // OBJVRAM_H
@@ -0,0 +1,80 @@
+// particle.h — Pooled particles and effects
+//
+// Particles live in fixed parallel arrays with a free list, like the actor
+// pool: 24.8 world position on the base plane, a 12.4 height above it, integer
+// velocities and gravity, and a lifetime that picks the animation frame and
+// drives rotation and zoom. An effect (slash, sparks, dust, splash) is a
+// burst of particles sharing a depth key and BG priority; each effect is
+// drawn as one OBJ batch (sprite_add_objs()), so the sort and the scanline
+// budget see a handful of sprites rather than hundreds. Rotating and
+// shrinking particles share OAM's 32 matrices through affine.h; particles
+// spawned together turn in step and cost one matrix between them.
+//
+// particle_cap (set by the governor) bounds live particles; the slash is
+// gameplay feedback and ignores it, and draws as an attack (SPRITE_KEPT).
+// Update and draw time themselves with timing_cycles().
+#ifndef PARTICLE_H
+#define PARTICLE_H
+
+#include "game.h"
+
+#define PARTICLE_MAX           256
+#define PARTICLE_NONE          0xFFFF   // free-list terminator
+#define PARTICLE_EFFECTS       64
+#define PARTICLE_KEPT_EFFECTS  8        // effect slots drawn as attacks
+#define PARTICLE_PALBANK       3        // OBJ palette of data/fx.c
+
+// Cost model (ARM7 cycles, estimated) when timers 2+3 do not run (host
+// build): per pool slot scanned, per particle moved, per OBJ drawn
+#define PARTICLE_SLOT_CYCLES   8
+#define PARTICLE_MOVE_CYCLES   30
+#define PARTICLE_OBJ_CYCLES    90
+
+enum { FX_NONE = 0, FX_SLASH, FX_SPARKS, FX_DUST, FX_SPLASH, NUM_FX };
+
+typedef struct {
+    int x[PARTICLE_MAX], y[PARTICLE_MAX];     // 24.8 world position (base plane)
+    s16 z[PARTICLE_MAX];                      // 12.4 pixels above the base
+    s16 vx[PARTICLE_MAX], vy[PARTICLE_MAX];   // 24.8 per step
+    s16 vz[PARTICLE_MAX];                     // 12.4 per step
+    u8  kind[PARTICLE_MAX];                   // FX_*, FX_NONE = free slot
+    u8  effect[PARTICLE_MAX];
+    u8  age[PARTICLE_MAX], life[PARTICLE_MAX];  // logic steps
+    u16 next_free[PARTICLE_MAX];
+    // Effects: a live count of 0 marks a free slot
+    u16 fx_key[PARTICLE_EFFECTS];             // SPRITE_KEY of the spawn cell
+    u8  fx_live[PARTICLE_EFFECTS];
+    u8  fx_prio[PARTICLE_EFFECTS];            // BG priority
+    u8  fx_lift[PARTICLE_EFFECTS];            // base plane height, pixels
+    u8  fx_angle[PARTICLE_EFFECTS];           // AFFINE_TURN units
+} ParticlePool;
+
+typedef struct {
+    u32 live;           // allocated particles
+    u32 peak;
+    u32 spawned;
+    u32 refused;        // particles over particle_cap or the pool
+    u32 effects;        // live effects
+    u32 effects_full;   // effects refused (no effect slot)
+    u32 objs;           // OBJs drawn in the latest frame
+    u32 flat;           // of which drawn without a matrix (all 32 taken)
+    u32 cycles;         // latest step's update plus the frame's draw
+    u32 cycles_peak;
+} ParticleStats;
+
+extern ParticlePool parts;
+extern ParticleStats particle_stats;
+extern int particle_high_water;     // slots [0, particle_high_water) may be live
+extern int particle_cap;            // live particle limit (gov_knobs->particle_cap)
+
+// Boot: empty pool; uploads the effect tiles to OBJ VRAM from OBJ_FX_TILE0
+void particle_init(void);
+// Effect `kind` on cell (col, row) at `height`, facing `dir` (DIR_*);
+// returns the particles spawned
+int  particle_effect(int kind, int col, int row, int height, int dir);
+// Once per logic step
+void particle_update(void);
+// Draw, between sprite_begin() and sprite_end(), after affine_begin()
+void particle_draw(void);
+
+#endif // PARTICLE_H
@@ -0,0 +1,17 @@
+// platform.h — Hardware access layer
+//
+// Engine code talks to the hardware only through the libtonc subset used
+// here: memory maps (tile_mem, se_mem, pal_*_mem, oam_mem, sram_mem), the
+// display/scroll registers, key_poll(), the BIOS VBlank wait and the
+// memcpy16/32 + oam_* helpers. Native builds (no -DGBA) swap in
+// host/host_platform.h, which backs the same names with plain arrays.
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#ifdef GBA
+#include <tonc.h>
+#else
+#include "host_platform.h"
+#endif
+
+#endif // PLATFORM_H
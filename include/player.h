@@ -0,0 +1,21 @@
+// player.h — Player movement, collision, sprite and camera
+#ifndef PLAYER_H
+#define PLAYER_H
+
+#include "game.h"
+
+extern OBJ_ATTR obj_buffer[128];   // shadow OAM
+extern Player player;
+extern Camera camera;
+
+// World bounds for player clamping (fixed-point)
+extern int bound_wx_min, bound_wx_max;
+extern int bound_wy_min, bound_wy_max;
+
+void compute_world_bounds(void);
+void player_init(void);
+void player_update(void);
+void player_draw(void);
+void camera_update(void);
+
+#endif // PLAYER_H
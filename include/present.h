@@ -0,0 +1,54 @@
+// present.h — Late input sampling and atomic VBlank commit
+//
+// The main loop renders into shadow state (obj_buffer, BG0 scroll and
+// control, mosaic and fade) and calls present_submit(); the VBlank ISR then
+// copies it all in one go, so it always comes from the same logic step.
+// Input is sampled as late in the frame as the measured logic+render cost
+// allows.
+#ifndef PRESENT_H
+#define PRESENT_H
+
+#include "platform.h"
+
+#define INPUT_LINE_MARGIN    8    // scanlines of slack before VBlank
+#define LATENCY_TIMEOUT      30   // frames before an edge counts as "no change"
+
+typedef struct {
+    u32 samples;    // completed measurements
+    u32 last;       // frames from key edge to the first commit that moves the
+                    // scroll or changes the player's sprite
+    u32 min, max;
+    u32 total;      // sum over samples (avg = total / samples)
+    u32 timeouts;   // edges that changed nothing within LATENCY_TIMEOUT
+} LatencyStats;
+
+extern LatencyStats latency_stats;
+extern int present_input_line;   // scanline input is sampled at (0 = right after VBlank)
+extern int present_wait_lines;   // lines the latest present_wait_input() slept
+
+void present_init(int measure_latency);
+
+// VBlank ISR: commit the submitted frame (scroll, queued OBJ tiles, OAM,
+// multiplexer schedule)
+void present_commit(void);
+
+// Main loop, before polling keys: when caught up, sleep until
+// present_input_line; either way, start timing the frame's cost
+void present_wait_input(int caught_up);
+// Governor, before a change that grows the frame: expect it to take at
+// least `lines` from input sample to submit, so input is sampled earlier
+void present_expect(int lines);
+// Main loop, after each replay_poll(): start a latency measurement on a
+// key edge
+void present_note_input(void);
+// Main loop, before touching obj_buffer: withdraw any uncommitted frame
+void present_begin(void);
+// Main loop, between present_begin() and present_submit(): BG0CNT and the
+// mosaic/blend registers for the frame (zone transitions, warp.h); they
+// stay as they are until the next call
+void present_display(u16 bg0cnt, u16 mosaic, u16 bldcnt, u16 bldy);
+// Main loop, after drawing: hand the frame (scroll + the first oam_count
+// obj_buffer entries, see sprite_end()) to the next VBlank
+void present_submit(u16 bg0_hofs, u16 bg0_vofs, int oam_count);
+
+#endif // PRESENT_H
@@ -0,0 +1,55 @@
+// replay.h — Deterministic input recording and playback
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "platform.h"
+
+//=============================================================================
+// Input script: RLE runs of key_poll() state
+//=============================================================================
+typedef struct {
+    u16 keys;    // KEY_* bits held during the run
+    u16 frames;  // run length in frames (1..0xFFFF)
+} InputRun;
+
+typedef struct {
+    u32 seed;              // rng_state to install before the first frame
+    int num_runs;
+    const InputRun *runs;
+} ReplayScript;
+
+enum { REPLAY_OFF = 0, REPLAY_RECORD, REPLAY_PLAY };
+
+//=============================================================================
+// SRAM layout: recordings live in the upper half of the 32 KB cart RAM
+//=============================================================================
+#define REPLAY_SRAM_OFS    0x4000
+#define REPLAY_SRAM_SIZE   0x4000
+#define REPLAY_MAGIC       0x314C5052   // "RPL1"
+#define REPLAY_DEFAULT_SEED 0xDEADBEEF
+
+// Built-in benchmark route: walks the whole strip from col 3 to col 198,
+// climbing and falling off all three hills, wading the river and lake,
+// skirting the fortress walls and running along the ruins wall top.
+extern const ReplayScript bench_route;
+
+// Boot-time mode select (call after one key_poll()):
+//   SELECT held  → play bench_route
+//   START held   → play the recording stored in SRAM
+//   L+R held     → record to SRAM
+// Returns the RNG seed the game should use.
+u32 replay_boot(void);
+
+void replay_start_record(u32 seed);
+int  replay_start_sram(void);                  // 0 if no valid recording
+void replay_start_script(const ReplayScript *s);
+void replay_stop(void);
+
+// key_poll() replacement: records or substitutes __key_curr
+void replay_poll(void);
+
+int replay_mode(void);
+u32 replay_seed(void);
+u32 replay_frame(void);     // frames polled since start
+
+#endif // REPLAY_H
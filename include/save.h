@@ -0,0 +1,74 @@
+// save.h — Incremental saves in cart SRAM: checksummed delta log, two slots
+//
+// The lower half of SRAM (the upper half holds replay recordings) is split
+// into two slots. A slot is a header (magic, sequence number, checksum)
+// followed by a log of blocks: a length, a Fletcher-16 checksum and records
+// for the player, the checkpoint, script flags, once-only triggers fired
+// and map cells changed from the generated world. A save appends one block
+// holding only what changed since the previous one; when the active slot
+// is full (or the game did not start from it), the whole state is written
+// as a single block into the other slot instead, with the next sequence.
+//
+// The SRAM bus is 8-bit and slow, so a save is built in EWRAM at once and
+// written out save_step_bytes per logic step. Write order keeps the
+// previous save intact if power is lost at any byte: a block joins the log
+// only when its length overwrites the terminator after the old end, and a
+// compacted slot only when its header is complete. Loading takes the valid
+// slot with the newest sequence, replays its blocks up to the first bad
+// checksum and recomposites just the cells they change (compose_cell()).
+//
+// Code that edits world_map after boot must call save_cell_changed().
+#ifndef SAVE_H
+#define SAVE_H
+
+#include "game.h"
+
+#define SAVE_SRAM_OFS      0x0000
+#define SAVE_SLOT_SIZE     0x2000   // two slots below REPLAY_SRAM_OFS
+#define SAVE_HDR_SIZE      12       // magic, seq, checksum, pad
+#define SAVE_MAGIC         0x31564153   // "SAV1"
+#define SAVE_STEP_BYTES    256      // SRAM bytes written per logic step
+
+// Cost model (ARM7 cycles, estimated): building a block (bitmap scans),
+// and each SRAM byte (8-bit bus, 4 wait states, plus the loop)
+#define SAVE_BUILD_CYCLES  1200
+#define SAVE_BYTE_CYCLES   10
+
+typedef struct {
+    u32 saves;          // blocks committed
+    u32 compactions;    // of which full snapshots into the other slot
+    u32 unchanged;      // requests with nothing to write
+    u32 deferred;       // requests made while a save was being written
+    u32 overflow;       // cells left out of a full slot
+    u32 bytes;          // SRAM bytes written, total
+    u32 steps;          // logic steps that wrote
+    u32 block_peak;     // largest block, bytes
+    u32 cycles;         // latest step
+    u32 cycles_peak;
+    // Latest save_load()
+    u32 load_blocks;
+    u32 load_records;
+    u32 load_cells;     // distinct cells recomposited
+    u32 load_stamped;   // cell stamps they took
+    u32 load_tiles;     // tiles added to the dictionary
+} SaveStats;
+
+extern SaveStats save_stats;
+extern int save_step_bytes;         // SRAM write slice per step
+
+// Boot, after trigger_init()/script_init(): find the newest valid slot
+void save_init(void);
+// Apply that slot onto the freshly generated world; returns the blocks
+// applied (0: no save). The caller re-centres the camera and ring.
+int  save_load(void);
+
+// A world_map cell was edited
+void save_cell_changed(int col, int row);
+// Save the current state (deferred while a save is being written)
+void save_request(void);
+// Once per logic step, after script_update(): autosave on checkpoint
+// entries, then write the next slice
+void save_update(void);
+int  save_busy(void);
+
+#endif // SAVE_H
@@ -0,0 +1,92 @@
+// script.h — Bytecode VM for events and cutscenes
+//
+// Scripts are written in assets/scripts/*.evs, assembled by
+// tools/build_scripts.py into one ROM byte array (data/scripts.c) and run
+// as coroutines: up to SCRIPT_MAX at once, each with a program counter and
+// a few registers. A script runs until it waits — on frames, on the player
+// changing tile or reaching a column, on a key press, a script flag or a
+// zone transition —
+// or until it has used its slice of SCRIPT_SLICE instructions for the
+// step, so even SCRIPT_MAX busy scripts cost a bounded, known share of
+// the frame; script_update() times itself with timing_cycles(). The
+// interpreter runs from IWRAM and script.c is built as ARM code (Makefile),
+// so dispatch takes 32-bit fetches at full speed. Cutscene trigger events
+// (trigger.h) start their scripts.
+//
+// Encoding: one opcode byte, then its operands; u16 operands are little
+// endian, jump targets are byte offsets from the script's start.
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include "game.h"
+
+#define SCRIPT_MAX       8       // concurrent scripts
+#define SCRIPT_SLICE     16      // instructions per script per step
+#define SCRIPT_REGS      4
+#define SCRIPT_NONE      0xFF
+
+// Cost model (ARM7 cycles, estimated) when timers 2+3 do not run (host
+// build): IWRAM dispatch per instruction, plus the wait test of each
+// running script
+#define SCRIPT_OP_CYCLES    24
+#define SCRIPT_WAIT_CYCLES  16
+
+enum {
+    SOP_END = 0,     //                      stop
+    SOP_YIELD,       //                      resume next step
+    SOP_WAIT,        // u16 frames
+    SOP_WAIT_MOVE,   //                      until the player changes tile
+    SOP_WAIT_COL,    // u8 col               until the player reaches col
+    SOP_WAIT_KEY,    // u16 keys             until one of them is pressed
+    SOP_WAIT_FLAG,   // u8 flag              until the flag is set
+    SOP_SET,         // u8 reg, s16 value
+    SOP_ADD,         // u8 reg, s8 value
+    SOP_JMP,         // u16 target
+    SOP_JNZ,         // u8 reg, u16 target   jump if reg != 0
+    SOP_DJNZ,        // u8 reg, u16 target   decrement, jump if != 0
+    SOP_FLAG,        // u8 flag              set a script flag
+    SOP_FX,          // u8 kind, col, row    particle effect (particle.h)
+    SOP_FXP,         // u8 kind, s8 dcol, s8 drow   ... relative to the player
+    SOP_SPAWN,       // u8 type, col, row, dir      actor (entity.h)
+    SOP_RUN,         // u8 script            start another script
+    SOP_WARP,        // u8 col, row, mask    zone transition (warp.h), until arrived
+    NUM_SOPS
+};
+
+typedef struct {
+    u16 pc;             // offset into scriptCode[]
+    u8  id;             // SCRIPT_* or SCRIPT_NONE (free)
+    u8  wait_op;        // SOP_WAIT* being waited on, 0 when runnable
+    u16 wait;           // frames left, key mask, column or flag
+    u16 wait_col;       // SOP_WAIT_MOVE: tile at the start of the wait
+    u8  wait_row;
+    u8  pad;
+    s16 reg[SCRIPT_REGS];
+} Script;
+
+typedef struct {
+    u32 started;
+    u32 finished;
+    u32 dropped;        // starts refused: every slot busy
+    u32 bad_op;         // scripts stopped on an unknown opcode
+    u32 running;        // scripts alive after the latest step
+    u32 running_peak;
+    u32 ops;            // instructions run in the latest step
+    u32 ops_peak;
+    u32 ops_total;
+    u32 sliced;         // scripts cut off by their slice, latest step
+    u32 cycles;         // cycles of the latest step (timers 2+3, or the model)
+    u32 cycles_peak;
+} ScriptStats;
+
+extern ScriptStats script_stats;
+extern Script scripts[SCRIPT_MAX];
+extern u32 script_flags;
+
+void script_init(void);
+// Start script `id`; returns its slot, or -1 if every slot is busy
+int  script_start(int id);
+// Once per logic step, after trigger_update()
+IWRAM_CODE void script_update(void);
+
+#endif // SCRIPT_H
@@ -0,0 +1,115 @@
+// sound.h — Software mixer on DirectSound A, music sequencer and SFX voices
+//
+// Timer 0 clocks DirectSound A at the mix rate and DMA1 feeds its FIFO from
+// a double buffer in IWRAM, restarted every other VBlank. The VBlank ISR
+// (after the frame commit) drains the SFX queue, ticks the music and mixes
+// the next frame's samples into the half that is not playing. Rates are
+// chosen so one frame is a whole number of samples and the DMA stays in
+// step with VBlank.
+//
+// Voices [0, SOUND_MUSIC_VOICES) belong to the music; SFX take the rest of
+// the `sound_channels` configured. A new SFX takes a free voice, else
+// steals the lowest-priority one (the nearest its end among equals) if it
+// is not above its own priority, else it is dropped. Requests from the
+// main loop go through a small queue so the ISR owns every voice.
+//
+// Mixer cycles are measured every frame with timing_cycles() (timers 2+3
+// cascaded); the host build, whose timers do not run, reports the cost
+// model instead.
+#ifndef SOUND_H
+#define SOUND_H
+
+#include "platform.h"
+
+#define SOUND_CHANNELS_MAX   8
+#define SOUND_MUSIC_VOICES   2
+#define SOUND_QUEUE          8      // SFX requests per frame
+#define SOUND_SPF_MAX        528    // samples per frame at the top rate
+#define SOUND_VOL_MAX        32
+#define SOUND_MIX_SHIFT      5      // one full-volume voice fills the s8 range
+#define SOUND_FRAC           12     // voice position: 20.12 fixed point
+#define SOUND_NO_LOOP        0xFFFFFFFF
+#define SOUND_NONE           0xFF
+
+#define SOUND_DEFAULT_CHANNELS  6
+#define SOUND_DEFAULT_RATE      SOUND_RATE_13K
+
+#define SOUND_NOTE_LO        36     // lowest note of soundNotePitch[] (C2)
+#define SOUND_NOTE_BASE      60     // note a sample's `rate` refers to (C4)
+#define SOUND_NOTE_OFF       1      // song cells: 0 holds, 1 releases
+
+// Cost model (ARM7 cycles, estimated): per frame, per output sample
+// (clear, clip, store) and per sample of each active voice (IWRAM loop)
+#define SOUND_FRAME_CYCLES   600
+#define SOUND_OUT_CYCLES     6
+#define SOUND_VOICE_CYCLES   11
+
+// Mix rates: whole samples per 280896-cycle frame
+enum {
+    SOUND_RATE_10K = 0,     // 10512 Hz, 176 samples per frame
+    SOUND_RATE_13K,         // 13379 Hz, 224
+    SOUND_RATE_18K,         // 18157 Hz, 304
+    SOUND_RATE_21K,         // 21024 Hz, 352
+    SOUND_RATE_26K,         // 26758 Hz, 448
+    SOUND_RATE_31K,         // 31536 Hz, 528
+    NUM_SOUND_RATES
+};
+
+// ROM sample: 8-bit signed PCM
+typedef struct {
+    const s8 *data;
+    u32 length;             // samples
+    u32 loop_start;         // SOUND_NO_LOOP for one-shots
+    u16 rate;               // Hz; for instruments, at SOUND_NOTE_BASE
+    u8  prio;               // SFX priority, higher wins
+    u8  vol;                // 0..SOUND_VOL_MAX
+} SoundSample;
+
+// ROM song: `tracks` note bytes per row, one per music voice
+typedef struct {
+    const u8 *rows;
+    u16 num_rows;
+    u16 loop_row;
+    u8  ticks;              // frames per row
+    u8  tracks;             // ≤ SOUND_MUSIC_VOICES
+    u8  inst[SOUND_MUSIC_VOICES];   // sample per track
+    u8  vol[SOUND_MUSIC_VOICES];
+} SoundSong;
+
+typedef struct {
+    u32 frames;             // frames mixed
+    u32 cycles;             // mixer cycles of the latest frame
+    u32 cycles_peak;
+    u32 cycles_total;
+    u32 voices;             // voices playing in the latest frame
+    u32 voices_peak;
+    u32 sfx_played;
+    u32 sfx_stolen;         // played by taking a busy voice
+    u32 sfx_dropped;        // every voice busy with higher priority
+    u32 sfx_merged;         // same SFX twice in one frame
+    u32 queue_full;
+    u32 clipped;            // output samples clipped, total
+} SoundStats;
+
+extern SoundStats sound_stats;
+extern int sound_channels;          // voices mixed, music included
+extern int sound_rate;              // SOUND_RATE_*
+
+void sound_init(int channels, int rate);
+// Change voices or rate: stops the output, resets every voice and restarts
+void sound_config(int channels, int rate);
+int  sound_rate_hz(int rate);
+int  sound_samples_per_frame(int rate);
+
+// Main loop: queue an SFX (data/sounds.h); 0 if the queue is full
+int  sound_sfx(int id);
+// Main loop: start a song from its first row, or SOUND_NONE to stop
+void sound_music(int song);
+
+// VBlank ISR, first: switch buffer halves, rewinding the FIFO DMA before it
+// fetches past the end of the buffer
+IWRAM_CODE void sound_rewind(void);
+// VBlank ISR, last: mix the next frame into the half not playing
+IWRAM_CODE void sound_vblank(void);
+
+#endif // SOUND_H
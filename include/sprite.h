@@ -0,0 +1,102 @@
+// sprite.h — Depth-sorted shadow OAM builder
+//
+// Draw code adds sprites with an owner id and an iso depth key each frame;
+// sprite_end() orders them front-to-back (lower OAM index wins overlaps)
+// and writes obj_buffer in one pass. The previous frame's order seeds the
+// sort, so a mostly static scene costs an almost free insertion sort.
+// A meta-sprite is one sorted sprite made of several OBJ pieces, expanded
+// into consecutive OAM entries when obj_buffer is written; an OBJ batch
+// (particles) is the same with ready-made entries.
+//
+// The hardware only has SPRITE_LINE_CYCLES of OBJ rendering per scanline
+// and silently drops whatever OAM entries come last on a line that runs
+// out. sprite_end() therefore charges each sprite's width to a 160-line
+// histogram first: the player and attacks always go in, everyone else is
+// admitted round-robin, and a sprite that would overflow a line (or OAM)
+// is held back for this frame. The next frame starts with the first one
+// held back, so a crowd flickers evenly instead of the same actors
+// vanishing.
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include "game.h"
+
+#define SPRITE_MAX        240     // sprites per frame (ids are u8, 0xFF is none)
+#define SPRITE_OAM        128     // hardware OAM entries
+#define SPRITE_NO_ID      0xFF
+#define SPRITE_ID_PLAYER  0
+#define SPRITE_ID_ENTITY  1       // + entity slot
+#define SPRITE_ID_FX      0x80    // + effect slot, up to 0xBF
+#define SPRITE_ID_ATTACK  0xE0    // + attack slot, up to 0xFE
+
+// Never held back by the scanline budget
+#define SPRITE_KEPT(id)   ((id) == SPRITE_ID_PLAYER || (id) >= SPRITE_ID_ATTACK)
+
+// OBJ render cycles per scanline (H-blank interval free off); a regular OBJ
+// costs one cycle per pixel of width on each line it covers, an affine one
+// 10 + 2 per pixel of its (possibly doubled) width
+#define SPRITE_LINE_CYCLES      1210
+#define SPRITE_LINE_CYCLES_HBL  954     // with DCNT_OAM_HBL (multiplexed frames)
+
+// Depth key: iso diagonal, then height. Larger = nearer the camera.
+#define SPRITE_KEY(col, row, h)   ((u16)((((col) + (row)) << 3) | ((h) & 7)))
+
+// One OBJ of a meta-sprite, relative to the sprite's top-left corner
+typedef struct {
+    u8 x, xf;           // x offset, and x offset when drawn with ATTR1_HFLIP
+    u8 y;
+    u8 tile;            // added to the sprite's ATTR2 tile id
+    u16 attr0;          // ATTR0 shape
+    u16 attr1;          // ATTR1 size
+} MetaPiece;
+
+typedef struct {
+    u32 frames;
+    u32 count;          // sprites in the latest frame
+    u32 objs;           // OAM entries in the latest frame
+    u32 shifts;         // insertion-sort moves in the latest frame
+    u32 shifts_max;
+    u32 new_ids;        // sprites not present the frame before
+    u32 dropped;        // sprite_add() calls over SPRITE_MAX
+    u32 obj_overflow;   // meta-sprite pieces that did not fit in OAM
+    u32 line_peak;      // busiest scanline in the latest frame, in cycles
+    u32 culled;         // sprites held back by the line/OAM budget, latest frame
+    u32 culled_total;
+    u32 cull_frames;    // frames that held back at least one sprite
+    u32 kept_over;      // kept sprites that overflowed a line anyway
+    u32 mux_frames;     // frames built for the HBlank multiplexer
+} SpriteStats;
+
+extern SpriteStats sprite_stats;
+extern u16 sprite_lines[SCREEN_H];   // latest frame's OBJ cycles per scanline
+
+void sprite_init(void);          // forget the previous order (cold sort)
+void sprite_begin(void);
+// One sprite per owner id per frame
+void sprite_add(int id, u16 key, u16 attr0, u16 attr1, u16 attr2);
+// Meta-sprite at screen (x, y): attr0/attr1/attr2 carry everything but
+// position, shape and size (ATTR1_HFLIP mirrors the piece layout); each
+// piece's tile is added to attr2
+void sprite_add_meta(int id, u16 key, int x, int y, u16 attr0, u16 attr1, u16 attr2,
+                     const MetaPiece *pieces, int num_pieces);
+// Batch of ready-made OBJs sorted as one sprite; `objs` must stay valid
+// until sprite_end()
+void sprite_add_objs(int id, u16 key, const OBJ_ATTR *objs, int num_objs);
+// Sort, emit obj_buffer and hide what is no longer used. Returns the number
+// of obj_buffer entries that changed meaning since the frame OAM holds (to
+// copy to OAM).
+int  sprite_end(void);
+// VBlank ISR, after copying the submitted frame to OAM (present_commit())
+void sprite_commit(void);
+// obj_buffer index of `id` (its first piece) after the latest sprite_end(),
+// or -1
+int  sprite_slot(int id);
+
+// OBJ size in pixels from its ATTR0 shape and ATTR1 size bits
+void sprite_obj_size(u16 attr0, u16 attr1, int *w, int *h);
+
+// BG priority for a sprite standing on (col, row) at `height`: behind BG0
+// when a taller cell just in front of it covers its feet
+int  sprite_bg_prio(int col, int row, int height, int world_y);
+
+#endif // SPRITE_H
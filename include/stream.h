@@ -0,0 +1,72 @@
+// stream.h — VRAM upload and 64×64 hardware tilemap ring buffer
+//
+// BG0 has two charblock/screenblock sets (game.h). One is shown and
+// streamed as the camera scrolls; for a zone transition the other is
+// staged a slice per frame — the tile dictionary, then the 64 ring columns
+// around the destination — while the game plays on, and stream_flip()
+// makes it the shown set. The caller commits the new BG0CNT with the
+// scroll at VBlank (present_display()), so the swap costs no frame.
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "game.h"
+#include "compose.h"
+
+// World tile col/row of the ring buffer's top-left entry
+extern int loaded_col_min, loaded_row_min;
+
+// Ring lines (cols + rows) streamed per frame beyond what the visible
+// window requires, to re-centre the ring ahead of the camera. Set by the
+// frame-budget governor; 0 = load only what is about to be shown.
+extern int stream_prefetch;
+extern u32 stream_lines;           // lines streamed so far (debug)
+
+// Staging slice per frame and cost model (ARM7 cycles, estimated): a tile
+// is 16 words packed from EWRAM, a ring column about a scanline
+#define STAGE_TILES        24
+#define STAGE_COLS         4
+#define STAGE_TILE_CYCLES  280
+#define STAGE_COL_CYCLES   1232
+
+typedef struct {
+    u32 stages;         // stagings started
+    u32 flips;          // sets swapped in
+    u32 stage_frames;   // frames that staged something
+    u32 stage_tiles;    // tiles copied into hidden sets, total
+    u32 stage_cols;     // ring columns written into hidden sets, total
+    u32 cycles;         // latest stream_stage_step()
+    u32 cycles_peak;
+} StreamStats;
+
+extern const u8 stream_cbb[TILE_SETS], stream_sbb[TILE_SETS];
+extern int stream_set;             // shown set
+extern StreamStats stream_stats;
+extern int stream_stage_tiles;     // tiles per stream_stage_step()
+extern int stream_stage_cols;      // ring columns per stream_stage_step()
+
+// Boot: the whole dictionary into set 0, which becomes the shown set
+void upload_tiles_to_vram(void);
+// Tiles appended to the dictionary since `first` (compose_cell())
+void upload_tiles_from(int first);
+
+// Fill the whole ring centered on camera world pixel (cam_wx, cam_wy)
+void stream_init(int cam_wx, int cam_wy);
+// Stream in the columns/rows the camera has scrolled onto, plus up to
+// stream_prefetch lines towards the camera-centred window
+void update_hw_tilemap(int cam_wx, int cam_wy);
+// Rewrite the ring entries inside a recomposited rectangle; returns them
+int  stream_refresh(const ComposeRect *rect);
+// Start building the hidden set centred on camera world pixel (cam_wx, cam_wy)
+void stream_stage(int cam_wx, int cam_wy);
+// Render side, once per frame: the next slice; returns stream_staged()
+int  stream_stage_step(void);
+int  stream_staged(void);
+// Swap in the staged set (no-op if it is not complete); returns the BG0CNT
+// that shows the current set
+u16  stream_flip(void);
+u16  stream_bg0cnt(void);
+
+void stream_scroll(int cam_wx, int cam_wy, u16 *hofs, u16 *vofs);
+void stream_set_scroll(int cam_wx, int cam_wy);
+
+#endif // STREAM_H
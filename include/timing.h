@@ -0,0 +1,48 @@
+// timing.h — Fixed-timestep frame clock
+//
+// The VBlank ISR counts display frames; the main loop runs one logic step
+// per counted frame and renders only when it is caught up. A slow frame
+// therefore drops a render instead of slowing the game down.
+#ifndef TIMING_H
+#define TIMING_H
+
+#include "platform.h"
+
+#define MAX_CATCHUP_STEPS  4   // logic steps per loop iteration before time is dropped
+#define MAX_SKIPPED_RENDERS 3  // consecutive renders skipped before one is forced
+
+typedef struct {
+    u32 steps;         // logic steps run
+    u32 renders;       // frames rendered
+    u32 skipped;       // renders skipped because logic was behind
+    u32 overruns;      // iterations that found more than one step due
+    u32 dropped;       // steps discarded by the catch-up cap
+    u32 last_due;      // steps due at the start of the latest iteration
+} FrameStats;
+
+extern FrameStats frame_stats;
+extern volatile u32 vblank_count;
+
+// Timers 2+3 cascaded: a free-running 32-bit CPU cycle counter, started by
+// timing_init(). Profiled code (sound mixer, HBlank multiplexer, AI think
+// scheduler, script VM) takes differences, so an interrupt timing itself inside
+// another's span disturbs neither. The host build's timers do not run:
+// differences are 0 there and callers fall back to their cost models.
+static inline u32 timing_cycles(void) {
+    u16 hi = REG_TM3D, lo = REG_TM2D;
+    if (REG_TM3D != hi) {           // timer 2 wrapped between the reads
+        hi = REG_TM3D;
+        lo = REG_TM2D;
+    }
+    return (u32)hi << 16 | lo;
+}
+
+void timing_init(void);
+void timing_vblank(void);        // call from the VBlank ISR
+
+// Sleep until at least one step is due; returns steps to run (1..MAX_CATCHUP_STEPS)
+int timing_steps_due(void);
+// After logic: 0 if another VBlank already passed (skip this render)
+int timing_render_due(void);
+
+#endif // TIMING_H
@@ -0,0 +1,75 @@
+// trigger.h — Trigger zones along the strip: column-bucketed ROM index
+//
+// Zone transitions, checkpoints, cutscene markers and hidden pickups are
+// map rectangles (TriggerDef) compiled by tools/build_triggers.py into
+// data/triggers.c: the strip is cut into TRIG_BUCKET_COLS-wide buckets,
+// and each bucket lists, sorted by first column, the triggers overlapping
+// it. A cursor follows the player's bucket, so a step tests only that
+// bucket's few rectangles plus the ones the player is already inside.
+// Enter/exit are edge-detected against that small inside set and reported
+// in a fixed per-step event array; nothing is allocated.
+#ifndef TRIGGER_H
+#define TRIGGER_H
+
+#include "game.h"
+
+#define TRIG_INSIDE_MAX  8       // rectangles the player can be inside at once
+#define TRIG_EVENTS_MAX  8       // events reported per step
+
+enum { TRIG_ZONE = 0, TRIG_CHECKPOINT, TRIG_CUTSCENE, TRIG_PICKUP, NUM_TRIG_KINDS };
+
+// TriggerDef.flags
+#define TRIG_ONCE        0x01    // fires on the first entry only
+
+// TRIG_ZONE args: the strip's regions, west to east
+enum {
+    ZONE_MEADOW = 0, ZONE_RIVER, ZONE_HILLS, ZONE_FIELDS, ZONE_LAKE,
+    ZONE_HIGHLANDS, ZONE_FORTRESS, ZONE_RUINS, NUM_ZONES
+};
+
+// ROM record: inclusive tile rectangle
+typedef struct {
+    u8 col_lo, col_hi;
+    u8 row_lo, row_hi;
+    u8 kind;            // TRIG_*
+    u8 arg;             // zone, checkpoint or cutscene number
+    u8 flags;           // TRIG_ONCE
+    u8 pad;
+} TriggerDef;
+
+enum { TRIG_ENTER = 0, TRIG_EXIT };
+
+typedef struct {
+    u8 id;              // index into trigDefs[]
+    u8 edge;            // TRIG_ENTER / TRIG_EXIT
+} TriggerEvent;
+
+typedef struct {
+    u32 updates;        // steps the player changed tile
+    u32 tests;          // rectangle tests, total
+    u32 naive;          // tests a full scan would have made
+    u32 events;
+    u32 dropped;        // events or inside entries past the fixed arrays
+    u32 bucket_peak;    // longest bucket list met
+} TriggerStats;
+
+extern TriggerStats trigger_stats;
+
+// Events of the latest step
+extern TriggerEvent trigger_events[TRIG_EVENTS_MAX];
+extern int trigger_num_events;
+
+// Current region (ZONE_*) and the last checkpoint touched
+extern int trigger_zone;
+extern int trigger_checkpoint_col, trigger_checkpoint_row;
+
+void trigger_init(void);
+// Once per logic step, after player_update()
+void trigger_update(int col, int row);
+// Entered at least once (saves keep the TRIG_ONCE ones)
+int  trigger_fired(int id);
+void trigger_mark_fired(int id);
+// Nonzero if the inside set differs from a scan of every trigger
+int  trigger_verify(int col, int row);
+
+#endif // TRIGGER_H
@@ -0,0 +1,41 @@
+// warp.h — Zone transitions: staged BG set, one-register flip at VBlank
+//
+// warp_start() sends the player to another part of the world without a
+// black screen. The destination view is staged into the hidden BG set a
+// slice per frame (stream.h) while the game carries on; then the screen is
+// masked — a BG mosaic, a fade to black through the blend unit, or nothing
+// for a hard cut — the player and camera move, and the staged set is shown
+// by the BG0CNT committed with the next frame's scroll (present_display()).
+// The mask then opens on the new zone. No frame does more than a staging
+// slice, so a transition drops none.
+#ifndef WARP_H
+#define WARP_H
+
+#include "game.h"
+
+#define WARP_MASK_FRAMES  12     // logic steps to close the mask, and to open it
+
+enum { WARP_CUT = 0, WARP_MOSAIC, WARP_FADE };                    // masks
+enum { WARP_IDLE = 0, WARP_STAGING, WARP_CLOSING, WARP_OPENING };  // warp_state
+
+typedef struct {
+    u32 warps;          // transitions completed
+    u32 refused;        // requests made during a transition
+    u32 steps;          // latest transition: logic steps from request to open
+    u32 stage_frames;   // latest transition: rendered frames that staged
+} WarpStats;
+
+extern WarpStats warp_stats;
+extern int warp_state;
+
+void warp_init(void);
+// Send the player to cell (col, row) behind `mask` (WARP_*); 0 if a
+// transition is already under way
+int  warp_start(int col, int row, int mask);
+// Once per logic step, after script_update()
+void warp_update(void);
+// Render side, before update_hw_tilemap(): the next staging slice, and the
+// frame's BG0CNT and mask registers
+void warp_render(void);
+
+#endif // WARP_H
@@ -0,0 +1,15 @@
+// world.h — World map and procedural generation
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "game.h"
+
+extern MapCell world_map[MAP_ROWS][MAP_COLS];
+
+// xorshift32; generate_world() reseeds it per feature
+extern u32 rng_state;
+u32 rng_next(void);
+
+void generate_world(void);
+
+#endif // WORLD_H
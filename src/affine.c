@@ -0,0 +1,87 @@
+// affine.c — Shared OBJ affine matrices
+#include "affine.h"
+#include <string.h>
+
+#define HASH_SIZE   64      // power of two, at least 2 * AFFINE_MAX
+
+AffineStats affine_stats;
+
+static int num_used;
+static u8  mat_angle[AFFINE_MAX];
+static u16 mat_scale[AFFINE_MAX];
+
+// This frame's requests: key + 1 (0 = empty) -> matrix, open addressing
+static u32 hash_key[HASH_SIZE];
+static u8  hash_mat[HASH_SIZE];
+
+// Quarter wave, sin(i * 90° / 64) in .12
+static const s16 sin_lut[65] = {
+    0, 101, 201, 301, 401, 501, 601, 700, 799, 897, 995, 1092, 1189,
+    1285, 1380, 1474, 1567, 1660, 1751, 1842, 1931, 2019, 2106, 2191, 2276, 2359,
+    2440, 2520, 2598, 2675, 2751, 2824, 2896, 2967, 3035, 3102, 3166, 3229, 3290,
+    3349, 3406, 3461, 3513, 3564, 3612, 3659, 3703, 3745, 3784, 3822, 3857, 3889,
+    3920, 3948, 3973, 3996, 4017, 4036, 4052, 4065, 4076, 4085, 4091, 4095, 4096,
+};
+
+int affine_sin(int angle) {
+    angle &= AFFINE_TURN - 1;
+    int q = angle & 63;
+    switch (angle >> 6) {
+        case 0:  return sin_lut[q];
+        case 1:  return sin_lut[64 - q];
+        case 2:  return -sin_lut[q];
+        default: return -sin_lut[64 - q];
+    }
+}
+
+void affine_init(void) {
+    memset(&affine_stats, 0, sizeof(affine_stats));
+    num_used = 0;
+}
+
+void affine_begin(void) {
+    num_used = 0;
+    memset(hash_key, 0, sizeof(hash_key));
+    affine_stats.requests = 0;
+    affine_stats.full = 0;
+}
+
+int affine_get(int angle, int scale) {
+    affine_stats.requests++;
+    angle &= AFFINE_TURN - 1;
+    u32 key = ((u32)angle << 16 | (u16)scale) + 1;
+    u32 h = (key * 0x9E3779B1u) >> 26;
+    while (hash_key[h]) {
+        if (hash_key[h] == key) return hash_mat[h];
+        h = (h + 1) & (HASH_SIZE - 1);
+    }
+    if (num_used == AFFINE_MAX) {
+        affine_stats.full++;
+        affine_stats.full_total++;
+        return -1;
+    }
+    int m = num_used++;
+    mat_angle[m] = (u8)angle;
+    mat_scale[m] = (u16)scale;
+    hash_key[h] = key;
+    hash_mat[h] = (u8)m;
+    return m;
+}
+
+int affine_end(OBJ_ATTR *obj) {
+    // The OAM matrix maps screen to texture: the inverse of turn-and-scale
+    for (int m = 0; m < num_used; m++) {
+        int inv = (AFFINE_ONE * AFFINE_ONE) / mat_scale[m];
+        int s = affine_sin(mat_angle[m]) * inv >> 12;
+        int c = affine_cos(mat_angle[m]) * inv >> 12;
+        OBJ_ATTR *o = &obj[m * 4];
+        o[0].fill = (s16)c;         // pa
+        o[1].fill = (s16)-s;        // pb
+        o[2].fill = (s16)s;         // pc
+        o[3].fill = (s16)c;         // pd
+    }
+    AffineStats *as = &affine_stats;
+    as->used = num_used;
+    if ((u32)num_used > as->peak) as->peak = num_used;
+    return num_used * 4;
+}
@@ -0,0 +1,112 @@
+// ai.c — Time-sliced actor thinking under a per-step cycle budget
+#include "ai.h"
+#include "timing.h"
+#include <string.h>
+
+AiStats ai_stats;
+int ai_budget_cycles = AI_BUDGET_CYCLES;
+u8 ai_countdown[AI_QUEUE];
+
+static u32 step;
+// Carried-over thinks first, then new ones. An entry is live while its
+// generation matches its slot's; ai_forget() bumps the slot's, so a freed
+// and reused slot's old entry is dropped at the next compaction. Live
+// entries are at most one per slot; the spare half holds stale ones until
+// ai_run() or a full queue compacts them away.
+static u8  queue[2 * AI_QUEUE];
+static u8  queue_gen[2 * AI_QUEUE];
+static int queued;
+static u8  in_queue[AI_QUEUE];
+static u8  gen[AI_QUEUE];
+static u32 due_step[AI_QUEUE];
+static u32 due_now;
+
+void ai_init(void) {
+    memset(&ai_stats, 0, sizeof(ai_stats));
+    memset(in_queue, 0, sizeof(in_queue));
+    memset(gen, 0, sizeof(gen));
+    memset(ai_countdown, 0, sizeof(ai_countdown));
+    queued = 0;
+    step = 0;
+    due_now = 0;
+}
+
+u32 ai_step(void) {
+    return step;
+}
+
+// Once per filled slot, not per step
+int ai_phase(int i, int interval, u32 step) {
+    int r = (step + i) % interval;
+    return r ? interval - r + 1 : 1;
+}
+
+static inline int live(int k) {
+    int i = queue[k];
+    return in_queue[i] && queue_gen[k] == gen[i];
+}
+
+static void compact(void) {
+    int left = 0;
+    for (int k = 0; k < queued; k++) {
+        if (!live(k)) continue;
+        queue[left] = queue[k];
+        queue_gen[left] = queue_gen[k];
+        left++;
+    }
+    queued = left;
+}
+
+void ai_request(int i) {
+    due_now++;
+    if (in_queue[i]) return;        // still waiting from an earlier step
+    if (queued == 2 * AI_QUEUE) compact();
+    in_queue[i] = 1;
+    due_step[i] = step;
+    queue[queued] = (u8)i;
+    queue_gen[queued] = gen[i];
+    queued++;
+}
+
+void ai_forget(int i) {
+    in_queue[i] = 0;
+    ai_countdown[i] = 0;            // the next occupant takes its own phase
+    gen[i]++;                       // its queue entry is dropped
+}
+
+void ai_run(int (*think)(int i)) {
+    int spent = 0, ran = 0, left = 0;
+    u32 wait_peak = ai_stats.wait_peak;
+    for (int k = 0; k < queued; k++) {
+        int i = queue[k];
+        if (!live(k)) continue;
+        if (spent + AI_THINK_CYCLES > ai_budget_cycles) {
+            queue[left] = (u8)i;    // keeps its place at the front
+            queue_gen[left] = queue_gen[k];
+            left++;
+            continue;
+        }
+        in_queue[i] = 0;
+        u32 t0 = timing_cycles();
+        int model = AI_THINK_CYCLES + think(i);
+        u32 cycles = timing_cycles() - t0;
+        spent += cycles ? (int)cycles : model;      // host build: the model
+        ran++;
+        if (step - due_step[i] > wait_peak) wait_peak = step - due_step[i];
+    }
+    queued = left;
+
+    AiStats *as = &ai_stats;
+    as->due = due_now;
+    as->thinks = ran;
+    as->deferred = left;
+    as->cycles = spent;
+    if ((u32)ran > as->thinks_peak) as->thinks_peak = ran;
+    if ((u32)left > as->deferred_peak) as->deferred_peak = left;
+    if ((u32)spent > as->cycles_peak) as->cycles_peak = spent;
+    as->wait_peak = wait_peak;
+    as->thinks_total += ran;
+    as->deferred_total += left;
+    due_now = 0;
+    step++;
+}
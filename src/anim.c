@@ -0,0 +1,20 @@
+// anim.c — Data-driven sprite animation tables
+#include "anim.h"
+
+void anim_step(const AnimSet *set, int seq, u8 *pos, u8 *timer) {
+    const AnimSeq *s = &set->seqs[seq];
+    if (++*timer < set->frames[s->first + *pos].duration)
+        return;
+    *timer = 0;
+    if (*pos + 1 < s->count)
+        (*pos)++;
+    else if (s->loop != ANIM_HOLD)
+        *pos = s->loop;
+}
+
+const MetaCell *anim_cell(const AnimSet *set, int seq, int pos, int dir, u16 *attr1_flip) {
+    const AnimSeq *s = &set->seqs[seq];
+    int cell = set->dir_row[dir] * set->cells_per_row + set->frames[s->first + pos].cell;
+    *attr1_flip = (set->dir_flip >> dir) & 1 ? ATTR1_HFLIP : 0;
+    return &set->cells[cell];
+}
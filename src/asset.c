@@ -0,0 +1,106 @@
+// asset.c — ROM asset archive: indexed in place, unpacked by the BIOS
+#include "asset.h"
+#include "trigger.h"
+#include "../data/archive.h"
+#include <string.h>
+
+AssetStats asset_stats;
+AssetLoadStats asset_load_stats[ASSET_COUNT];
+int asset_zone_loaded = -1;
+
+// The index follows the 8-byte header
+static const AssetEntry *const entries = (const AssetEntry *)&assetArchive[2];
+static volatile int pal_id = ASSET_NONE;     // BG palette for the next VBlank
+static volatile int pal_first;
+static u32 step_cycles;
+
+int asset_init(void) {
+    const AssetHeader *h = (const AssetHeader *)assetArchive;
+    memset(&asset_stats, 0, sizeof(asset_stats));
+    memset(asset_load_stats, 0, sizeof(asset_load_stats));
+    asset_zone_loaded = -1;
+    pal_id = ASSET_NONE;
+    // Free-running at 64 cycles per tick: loads take differences, so one
+    // in the VBlank ISR does not disturb one it interrupted
+    REG_TM1CNT = 0;
+    REG_TM1D = 0;
+    REG_TM1CNT = TM_ENABLE | TM_FREQ_64;
+    return h->magic == ASSET_MAGIC && h->count == ASSET_COUNT;
+}
+
+const AssetEntry *asset_entry(int id) {
+    return &entries[id];
+}
+
+const void *asset_rom(int id) {
+    return (const u8 *)assetArchive + entries[id].offset;
+}
+
+u32 asset_load(int id, void *dst, int to) {
+    const AssetEntry *e = &entries[id];
+    const void *src = asset_rom(id);
+    u16 t0 = REG_TM1D;
+    switch (e->comp) {
+    case ASSET_RAW:
+        // DMA3 copies whole words; an odd-halfword size (a 51-colour
+        // palette) goes by halfwords so its last entry is not dropped
+        if (e->raw_size & 3) memcpy16(dst, src, (e->raw_size + 1) / 2);
+        else                 dma3_cpy(dst, src, e->raw_size);
+        break;
+    case ASSET_LZ77:
+        if (to == ASSET_TO_VRAM) LZ77UnCompVram(src, dst);
+        else                     LZ77UnCompWram(src, dst);
+        break;
+    case ASSET_RLE:
+        if (to == ASSET_TO_VRAM) RLUnCompVram(src, dst);
+        else                     RLUnCompWram(src, dst);
+        break;
+    }
+    u32 cycles = (u32)(u16)(REG_TM1D - t0) * 64;
+    if (!cycles) {      // host build: the timers do not run
+        static const u8 per_byte[] = { 0, ASSET_LZ77_CYCLES, ASSET_RLE_CYCLES };
+        cycles = ASSET_CALL_CYCLES + (e->comp == ASSET_RAW ?
+                 (e->raw_size + 3) / 4 * ASSET_RAW_CYCLES_X4 : e->raw_size * per_byte[e->comp]);
+    }
+    AssetLoadStats *ls = &asset_load_stats[id];
+    ls->loads++;
+    ls->cycles = cycles;
+    if (cycles > ls->cycles_peak) ls->cycles_peak = cycles;
+    asset_stats.loads++;
+    asset_stats.bytes += e->raw_size;
+    return cycles;
+}
+
+//=============================================================================
+// Zones
+//=============================================================================
+void asset_zone(int zone) {
+    for (int k = assetZoneStart[zone]; k < assetZoneStart[zone + 1]; k++) {
+        const AssetLoad *l = &assetZoneLoads[k];
+        switch (l->dst) {
+        case ASSET_DST_BG_PAL:
+            pal_first = l->arg;
+            pal_id = l->id;
+            break;
+        case ASSET_DST_OBJ_TILES:
+            step_cycles += asset_load(l->id, &tile_mem[4][l->arg], ASSET_TO_VRAM);
+            break;
+        }
+    }
+    asset_zone_loaded = zone;
+    asset_stats.zone_loads++;
+}
+
+void asset_update(void) {
+    if (trigger_zone != asset_zone_loaded) asset_zone(trigger_zone);
+    asset_stats.cycles = step_cycles;
+    if (step_cycles > asset_stats.cycles_peak) asset_stats.cycles_peak = step_cycles;
+    step_cycles = 0;
+}
+
+void asset_vblank(void) {
+    int id = pal_id;
+    if (id == ASSET_NONE) return;
+    pal_id = ASSET_NONE;
+    asset_load(id, &pal_bg_mem[pal_first], ASSET_TO_VRAM);
+}
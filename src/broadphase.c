@@ -0,0 +1,135 @@
+// broadphase.c — Column-band spatial hash over the actor pool
+#include "broadphase.h"
+#include "entity.h"
+#include <string.h>
+
+BroadStats broad_stats;
+
+static u8  bucket_head[BP_BANDS * BP_HEIGHTS];
+static u8  link_next[MAX_ENTITIES], link_prev[MAX_ENTITIES];
+static u16 slot_bucket[MAX_ENTITIES];
+
+// Running counters, published per step
+static u32 queries, tests, hits, naive, moves;
+
+static inline int bucket_of(int col, int height) {
+    return (col / BP_BAND_COLS) * BP_HEIGHTS + height;
+}
+
+void broadphase_init(void) {
+    memset(&broad_stats, 0, sizeof(broad_stats));
+    memset(bucket_head, BP_NONE, sizeof(bucket_head));
+    for (int i = 0; i < MAX_ENTITIES; i++) slot_bucket[i] = BP_NO_BUCKET;
+    queries = tests = hits = naive = moves = 0;
+}
+
+static void link(int i, int b) {
+    int h = bucket_head[b];
+    link_prev[i] = BP_NONE;
+    link_next[i] = (u8)h;
+    if (h != BP_NONE) link_prev[h] = (u8)i;
+    bucket_head[b] = (u8)i;
+    slot_bucket[i] = (u16)b;
+}
+
+static void unlink(int i) {
+    int b = slot_bucket[i];
+    int p = link_prev[i], n = link_next[i];
+    if (p != BP_NONE) link_next[p] = (u8)n;
+    else              bucket_head[b] = (u8)n;
+    if (n != BP_NONE) link_prev[n] = (u8)p;
+    slot_bucket[i] = BP_NO_BUCKET;
+}
+
+void broadphase_insert(int i) {
+    link(i, bucket_of(ents.col[i], ents.height[i]));
+}
+
+void broadphase_remove(int i) {
+    if (slot_bucket[i] != BP_NO_BUCKET) unlink(i);
+}
+
+void broadphase_moved(int i) {
+    int b = bucket_of(ents.col[i], ents.height[i]);
+    if (b == slot_bucket[i]) return;
+    unlink(i);
+    link(i, b);
+    moves++;
+}
+
+void broadphase_end_step(void) {
+    BroadStats *bs = &broad_stats;
+    bs->queries = queries;
+    bs->tests = tests;
+    bs->hits = hits;
+    bs->naive = naive;
+    bs->moves = moves;
+    if (tests > bs->tests_peak) bs->tests_peak = tests;
+    bs->queries_total += queries;
+    bs->tests_total += tests;
+    bs->naive_total += naive;
+    queries = tests = hits = naive = moves = 0;
+}
+
+int broadphase_verify(void) {
+    int bad = 0;
+    for (int i = 0; i < MAX_ENTITIES; i++) {
+        if (ents.type[i] == ENT_NONE) continue;
+        int b = bucket_of(ents.col[i], ents.height[i]), found = 0;
+        for (int j = bucket_head[b]; j != BP_NONE && !found; j = link_next[j])
+            found = j == i;
+        bad += !found;
+    }
+    return bad;
+}
+
+//=============================================================================
+// Queries
+//=============================================================================
+// Bands covering columns [col0, col1], clamped to the map
+static void band_range(int col0, int col1, int *b0, int *b1) {
+    if (col0 < 0) col0 = 0;
+    if (col1 >= MAP_COLS) col1 = MAP_COLS - 1;
+    *b0 = col0 / BP_BAND_COLS;
+    *b1 = col1 / BP_BAND_COLS;
+}
+
+int broadphase_tile(int col, int row, int height, u32 types, int skip, u8 *out, int max) {
+    queries++;
+    naive += entity_stats.live;
+    if (col < 0 || col >= MAP_COLS || height < 0 || height >= BP_HEIGHTS) return 0;
+    int found = 0;
+    for (int i = bucket_head[bucket_of(col, height)]; i != BP_NONE; i = link_next[i]) {
+        tests++;
+        if (i == skip || ents.col[i] != col || ents.row[i] != row) continue;
+        if (!(types & BP_TYPE(ents.type[i]))) continue;
+        if (out && found < max) out[found] = (u8)i;
+        found++;
+    }
+    hits += found;
+    return found;
+}
+
+int broadphase_near(int wx, int wy, int height, int radius, u32 types, u8 *out, int max) {
+    queries++;
+    naive += entity_stats.live;
+    if (height < 0 || height >= BP_HEIGHTS) return 0;
+    // Column grows with both wx and wy: the box's corners bound its bands
+    int c0, r0, c1, r1, b0, b1;
+    world_to_tile(wx - radius, wy - radius, &c0, &r0);
+    world_to_tile(wx + radius, wy + radius, &c1, &r1);
+    band_range(c0 - 1, c1 + 1, &b0, &b1);
+    int found = 0;
+    for (int b = b0; b <= b1; b++) {
+        for (int i = bucket_head[b * BP_HEIGHTS + height]; i != BP_NONE; i = link_next[i]) {
+            tests++;
+            if (!(types & BP_TYPE(ents.type[i]))) continue;
+            int dx = FP2INT(ents.x[i]) - wx, dy = FP2INT(ents.y[i]) - wy;
+            if (dx < -radius || dx > radius || dy < -radius || dy > radius) continue;
+            if (out && found < max) out[found] = (u8)i;
+            found++;
+        }
+    }
+    hits += found;
+    return found;
+}
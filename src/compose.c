@@ -0,0 +1,323 @@
+// compose.c — Boot-time metatile compositor and tile dictionary
+#include "compose.h"
+#include "world.h"
+#include "../data/metatiles.h"
+#include <string.h>
+
+//=============================================================================
+// EWRAM: pre-computed world tilemap + tile pixel dictionary
+//=============================================================================
+EWRAM_BSS u16 world_tilemap[WORLD_TILE_H * WORLD_TILE_W];
+EWRAM_BSS u8 tile_dict[MAX_PRECOMP_TILES][64];  // 8bpp pixel data per tile
+int num_tiles;
+
+// Tiles the stamps may write: the whole world, or compose_cell()'s rectangle
+static int clip_c0, clip_r0;
+static int clip_c1 = WORLD_TILE_W, clip_r1 = WORLD_TILE_H;
+
+#ifdef COMPOSE_STATS
+ComposeStats compose_stats;
+
+static void note_probe(int len) {
+    compose_stats.probes += len;
+    if ((u32)len > compose_stats.probe_max) compose_stats.probe_max = len;
+}
+#endif
+
+//=============================================================================
+// Tile dedup with simple hash for speed
+//=============================================================================
+#define HASH_SIZE 2048
+#define HASH_MASK (HASH_SIZE - 1)
+static u16 hash_table[HASH_SIZE];  // tile index + 1, or 0 = empty
+static u16 hash_keys[HASH_SIZE];   // hash of tile data
+
+static u32 tile_hash(const u8 *data) {
+    u32 h = 0x811C9DC5;
+    const u32 *p = (const u32 *)data;
+    for (int i = 0; i < 16; i++) {
+        h ^= p[i];
+        h *= 0x01000193;
+    }
+    return h;
+}
+
+int find_or_add_tile(const u8 *pixels) {
+    u32 h = tile_hash(pixels);
+    u32 slot = h & HASH_MASK;
+    COMPOSE_STAT(compose_stats.lookups++);
+
+    // Linear probe
+    for (int i = 0; i < HASH_SIZE; i++) {
+        u32 s = (slot + i) & HASH_MASK;
+        if (hash_table[s] == 0) {
+            // Empty slot - add new tile
+            COMPOSE_STAT(note_probe(i + 1));
+            if (num_tiles >= MAX_PRECOMP_TILES) {
+                COMPOSE_STAT(compose_stats.dict_full++);
+                return 0;
+            }
+            int id = num_tiles++;
+            memcpy(tile_dict[id], pixels, 64);
+            hash_table[s] = id + 1;
+            hash_keys[s] = (u16)(h >> 16);
+            return id;
+        }
+        int tid = hash_table[s] - 1;
+        if (hash_keys[s] == (u16)(h >> 16)) {
+            // Possible match - verify
+            if (memcmp(tile_dict[tid], pixels, 64) == 0) {
+                COMPOSE_STAT(note_probe(i + 1));
+                return tid;
+            }
+        }
+    }
+    COMPOSE_STAT(note_probe(HASH_SIZE); compose_stats.dict_full++);
+    return 0;  // hash table full
+}
+
+//=============================================================================
+// Metatile stamping: composite a 4x2 metatile at world pixel (px, py)
+// Handles transparency (pixel index 0 = don't overwrite)
+//=============================================================================
+void stamp_metatile(int mt_idx, int px, int py) {
+    const u16 *mt_tiles = mt_metatile_tiles[mt_idx];
+    COMPOSE_STAT(compose_stats.stamps_top++);
+
+    for (int ty = 0; ty < 2; ty++) {
+        for (int tx = 0; tx < 4; tx++) {
+            int src_tile = mt_tiles[ty * 4 + tx];
+            const u8 *src = mt_tile_pixels[src_tile];
+
+            // World tile coords
+            int wtc = (px + tx * 8 - WORLD_PX_X0) / 8;
+            int wtr = (py + ty * 8 - WORLD_PX_Y0) / 8;
+
+            if (wtc < clip_c0 || wtc >= clip_c1 || wtr < clip_r0 || wtr >= clip_r1)
+                continue;
+
+            // Check if source tile is all transparent
+            int has_opaque = 0;
+            for (int i = 0; i < 64; i++) {
+                if (src[i] != 0) { has_opaque = 1; break; }
+            }
+            if (!has_opaque) continue;
+
+            // Get current tile pixels at this position
+            int cur_idx = world_tilemap[wtr * WORLD_TILE_W + wtc];
+            u8 composite[64];
+            memcpy(composite, tile_dict[cur_idx], 64);
+
+            // Composite: overwrite non-transparent pixels
+            for (int i = 0; i < 64; i++) {
+                if (src[i] != 0) composite[i] = src[i];
+            }
+
+            // Dedup and store
+            int new_idx = find_or_add_tile(composite);
+            world_tilemap[wtr * WORLD_TILE_W + wtc] = (u16)new_idx;
+        }
+    }
+}
+
+//=============================================================================
+// Isometric side face: stamp a parallelogram-shaped face into world tilemap.
+// face=0 → left face (slopes down-right following diamond left edge)
+// face=1 → right face (slopes down-left following diamond right edge)
+//
+// Left face parallelogram (world coords, relative to diamond center wx,wy):
+//   A=(wx-16, top_y+8)  B=(wx, top_y+16)  C=(wx, top_y+16+fh)  D=(wx-16, top_y+8+fh)
+//   where top_y = base_y - h*SIDE_HEIGHT, fh = h*SIDE_HEIGHT
+//
+// Right face parallelogram:
+//   E=(wx, top_y+16)  F=(wx+16, top_y+8)  G=(wx+16, top_y+8+fh)  H=(wx, top_y+16+fh)
+//=============================================================================
+void stamp_side_face(int mt_idx, int face, int wx, int top_y, int face_h) {
+    // Proper isometric parallelogram side face.
+    // LEFT face: top edge from (wx-16, top_y+8) to (wx, top_y+16) — slope 8/16 = 1:2
+    //   At local x (0..15), the top of the face is at ly = lx/2
+    //   Bottom edge parallel: ly = lx/2 + face_h
+    //   Bounding box: (wx-16, top_y+8), 16 x (face_h + 8)
+    // RIGHT face: top edge from (wx, top_y+16) to (wx+16, top_y+8) — slope -1:2
+    //   At local x (0..15), the top of the face is at ly = 8 - (lx+1)/2
+    //   Bottom edge parallel: ly = 8 - (lx+1)/2 + face_h
+    //   Bounding box: (wx, top_y+8), 16 x (face_h + 8)
+    if (face_h <= 0) return;
+    COMPOSE_STAT(compose_stats.stamps_side++);
+
+    int face_px, face_py, face_w;
+    face_w = 16;
+    face_py = top_y + 8;
+    int total_h = face_h + 8;
+
+    if (face == 0) {
+        face_px = wx - 16;
+    } else {
+        face_px = wx;
+    }
+
+    int tc_min = (face_px - WORLD_PX_X0) / 8;
+    int tc_max = (face_px + face_w - 1 - WORLD_PX_X0) / 8;
+    int tr_min = (face_py - WORLD_PX_Y0) / 8;
+    int tr_max = (face_py + total_h - 1 - WORLD_PX_Y0) / 8;
+
+    for (int tr = tr_min; tr <= tr_max; tr++) {
+        if (tr < clip_r0 || tr >= clip_r1) continue;
+        for (int tc = tc_min; tc <= tc_max; tc++) {
+            if (tc < clip_c0 || tc >= clip_c1) continue;
+
+            int cur_idx = world_tilemap[tr * WORLD_TILE_W + tc];
+            u8 composite[64];
+            memcpy(composite, tile_dict[cur_idx], 64);
+            int changed = 0;
+
+            for (int py = 0; py < 8; py++) {
+                int wy = tr * 8 + WORLD_PX_Y0 + py;
+                int ly = wy - face_py;
+                if (ly < 0 || ly >= total_h) continue;
+
+                for (int px_off = 0; px_off < 8; px_off++) {
+                    int wx2 = tc * 8 + WORLD_PX_X0 + px_off;
+                    int lx = wx2 - face_px;
+                    if (lx < 0 || lx >= face_w) continue;
+
+                    // Check parallelogram bounds
+                    int top_edge;
+                    if (face == 0) {
+                        // Left face: top edge at ly = lx/2
+                        top_edge = lx / 2;
+                    } else {
+                        // Right face: top edge at ly = (16 - lx) / 2
+                        // At lx=0: top=8, at lx=15: top=0
+                        top_edge = (16 - lx) / 2;
+                    }
+
+                    if (ly < top_edge || ly >= top_edge + face_h) continue;
+
+                    // Texture coordinate: ty wraps within 16px for tiling
+                    int ty = (ly - top_edge) % 16;
+                    int tx = (face == 0) ? lx : (lx + 16);
+
+                    int mt_tx = tx / 8;
+                    int mt_ty = ty / 8;
+                    int tile_id = mt_metatile_tiles[mt_idx][mt_ty * 4 + mt_tx];
+                    int pixel = mt_tile_pixels[tile_id][(ty & 7) * 8 + (tx & 7)];
+
+                    if (pixel != 0) {
+                        composite[py * 8 + px_off] = (u8)pixel;
+                        changed = 1;
+                    }
+                }
+            }
+
+            if (changed) {
+                int new_idx = find_or_add_tile(composite);
+                world_tilemap[tr * WORLD_TILE_W + tc] = (u16)new_idx;
+            }
+        }
+    }
+}
+
+//=============================================================================
+// One map cell: side faces, then the top diamond
+//=============================================================================
+static void stamp_cell(int c, int r) {
+    // Ground metatile indices
+    static const int ground_mt[] = {
+        MT_GROUND_GRASS, MT_GROUND_STONE, MT_GROUND_DIRT,
+        MT_GROUND_WATER, MT_GROUND_ROOF
+    };
+    // Side metatile indices (used as texture source for parallelogram faces)
+    static const int side_mt[] = {
+        MT_SIDE_GRASS_EDGE, MT_SIDE_STONE_WALL, MT_SIDE_DIRT_WALL,
+        MT_SIDE_BRICK_WALL, MT_SIDE_ROOF_EDGE
+    };
+
+    MapCell *cell = &world_map[r][c];
+    int wx = (c - r) * ISO_HALF_W;
+    int base_y = (c + r) * ISO_HALF_H;
+    int h = cell->height;
+
+    int top_y = base_y - h * SIDE_HEIGHT;
+
+    // Draw parallelogram side faces (left and right)
+    if (h > 0) {
+        int face_h = h * SIDE_HEIGHT;
+        stamp_side_face(side_mt[cell->side], 0, wx, top_y, face_h);  // left
+        stamp_side_face(side_mt[cell->side], 1, wx, top_y, face_h);  // right
+    }
+
+    // Draw top face diamond
+    int px = wx - ISO_HALF_W;
+    stamp_metatile(ground_mt[cell->ground], px, top_y);
+}
+
+//=============================================================================
+// Boot: build world tilemap using metatile compositing
+//=============================================================================
+void precompute_world(void) {
+    num_tiles = 0;
+#ifdef COMPOSE_STATS
+    memset(&compose_stats, 0, sizeof(compose_stats));
+#endif
+    memset(world_tilemap, 0, sizeof(world_tilemap));
+    memset(hash_table, 0, sizeof(hash_table));
+    memset(tile_dict[0], 0, 64);  // tile 0 = transparent
+    num_tiles = 1;
+
+    // Render back-to-front: by (col+row) ascending
+    for (int diag = 0; diag < MAP_COLS + MAP_ROWS - 1; diag++) {
+        int r_min = diag - (MAP_COLS - 1);
+        if (r_min < 0) r_min = 0;
+        int r_max = diag;
+        if (r_max >= MAP_ROWS) r_max = MAP_ROWS - 1;
+
+        for (int r = r_min; r <= r_max; r++) {
+            int c = diag - r;
+            if (c < 0 || c >= MAP_COLS) continue;
+
+            stamp_cell(c, r);
+        }
+    }
+}
+
+//=============================================================================
+// Runtime: recomposite the tiles a changed cell can touch
+//=============================================================================
+int compose_cell(int col, int row, ComposeRect *rect) {
+    // Every height the cell may have had: 32 px wide, from MAX_HEIGHT
+    // above the base to the bottom of the diamond
+    int wx = (col - row) * ISO_HALF_W;
+    int base_y = (col + row) * ISO_HALF_H;
+    clip_c0 = (wx - ISO_HALF_W - WORLD_PX_X0) / 8;
+    clip_c1 = (wx + ISO_HALF_W - WORLD_PX_X0) / 8;
+    clip_r0 = (base_y - MAX_HEIGHT * SIDE_HEIGHT - WORLD_PX_Y0) / 8;
+    clip_r1 = (base_y + ISO_TILE_H - WORLD_PX_Y0) / 8;
+    for (int tr = clip_r0; tr < clip_r1; tr++)
+        for (int tc = clip_c0; tc < clip_c1; tc++)
+            world_tilemap[tr * WORLD_TILE_W + tc] = 0;
+
+    // Same back-to-front order as the boot pass, restricted to the cells
+    // within one diamond across whose faces or tops can reach the
+    // rectangle; the clip keeps their stamps inside it
+    int d0 = col - row, s0 = col + row;
+    int stamped = 0;
+    for (int diag = s0 - 2 * MAX_HEIGHT - 2; diag <= s0 + 2 * MAX_HEIGHT + 2; diag++) {
+        for (int r = 0; r < MAP_ROWS; r++) {
+            int c = diag - r;
+            if (c < 0 || c >= MAP_COLS) continue;
+            int d = c - r - d0;
+            if (d < -1 || d > 1) continue;
+            stamp_cell(c, r);
+            stamped++;
+        }
+    }
+    rect->c0 = clip_c0;
+    rect->r0 = clip_r0;
+    rect->c1 = clip_c1;
+    rect->r1 = clip_r1;
+    clip_c0 = clip_r0 = 0;
+    clip_c1 = WORLD_TILE_W;
+    clip_r1 = WORLD_TILE_H;
+    return stamped;
+}
@@ -0,0 +1,324 @@
+// entity.c — Structure-of-arrays actor pool with camera-band activation
+#include "entity.h"
+#include "broadphase.h"
+#include "flowfield.h"
+#include "ai.h"
+#include "los.h"
+#include "govern.h"
+#include "world.h"
+#include "player.h"
+#include "sprite.h"
+#include "objvram.h"
+#include "../data/anim_hero.h"
+#include <string.h>
+
+EntityPool ents;           // IWRAM: walked every logic step
+EntityStats entity_stats;
+int ent_high_water;
+
+static int free_head;
+static u32 wander_rng;             // private: replays must not see AI dice
+
+// Spawn records inside the band are [spawn_lo, spawn_hi)
+static int spawn_lo, spawn_hi;
+static u32 spawn_live[8];          // bit per record: actor currently out
+
+#define SPAWN_IS_LIVE(k)   (spawn_live[(k) >> 5] & (1u << ((k) & 31)))
+#define SPAWN_SET_LIVE(k)  (spawn_live[(k) >> 5] |= 1u << ((k) & 31))
+#define SPAWN_CLR_LIVE(k)  (spawn_live[(k) >> 5] &= ~(1u << ((k) & 31)))
+
+// World-pixel step per DIR_* (SE, NE, NW, SW), in units of half a tile edge
+static const s8 dir_dx[4] = {  2,  2, -2, -2 };
+static const s8 dir_dy[4] = {  1, -1, -1,  1 };
+
+//=============================================================================
+// Pool
+//=============================================================================
+void entity_init(void) {
+    memset(&ents, 0, sizeof(ents));
+    memset(&entity_stats, 0, sizeof(entity_stats));
+    memset(spawn_live, 0, sizeof(spawn_live));
+    for (int i = 0; i < MAX_ENTITIES; i++)
+        ents.next_free[i] = (i + 1 < MAX_ENTITIES) ? i + 1 : ENT_NONE_SLOT;
+    free_head = 0;
+    ent_high_water = 0;
+    spawn_lo = spawn_hi = 0;
+    broadphase_init();
+    flow_init();
+    ai_init();
+    los_init();
+    wander_rng = 1;
+}
+
+int entity_alloc(void) {
+    if (free_head == ENT_NONE_SLOT) return -1;
+    int i = free_head;
+    free_head = ents.next_free[i];
+    if (i >= ent_high_water) ent_high_water = i + 1;
+    entity_stats.live++;
+    return i;
+}
+
+void entity_free(int i) {
+    if (ents.spawn[i] != ENT_NO_SPAWN) SPAWN_CLR_LIVE(ents.spawn[i]);
+    broadphase_remove(i);
+    ai_forget(i);
+    ents.type[i] = ENT_NONE;
+    ents.next_free[i] = (u8)free_head;
+    free_head = i;
+    entity_stats.live--;
+    // Keep the update pass short when the top slots empty out
+    while (ent_high_water > 0 && ents.type[ent_high_water - 1] == ENT_NONE)
+        ent_high_water--;
+}
+
+int entity_spawn(int type, int col, int row, int dir) {
+    int i = entity_alloc();
+    if (i < 0) {
+        entity_stats.alloc_failed++;
+        return -1;
+    }
+    int wx, wy;
+    iso_tile_to_world(col, row, &wx, &wy);
+    ents.x[i] = INT2FP(wx);
+    ents.y[i] = INT2FP(wy);
+    ents.col[i] = col;
+    ents.row[i] = row;
+    ents.height[i] = world_map[row][col].height;
+    ents.type[i] = type;
+    ents.state[i] = (type == ENT_PICKUP) ? ENT_ST_IDLE : ENT_ST_WALK;
+    ents.dir[i] = dir;
+    ents.frame[i] = 0;
+    ents.anim_timer[i] = 0;
+    ents.spawn[i] = ENT_NO_SPAWN;
+    broadphase_insert(i);
+    return i;
+}
+
+//=============================================================================
+// Spawn band: ROM records wake as the camera's column band reaches them
+//=============================================================================
+static void wake_spawn(int k) {
+    if (SPAWN_IS_LIVE(k)) return;
+    const SpawnDef *s = &world_spawns[k];
+    // Guards patrol along columns, slimes along rows
+    int dir = (s->type == ENT_SLIME) ? DIR_SW : DIR_SE;
+    int i = entity_spawn(s->type, s->col, s->row, dir);
+    if (i < 0) return;
+    ents.spawn[i] = (u8)k;
+    SPAWN_SET_LIVE(k);
+    entity_stats.spawned++;
+}
+
+static void update_spawn_band(int cam_col) {
+    int lo = cam_col - ENT_SPAWN_COLS, hi = cam_col + ENT_SPAWN_COLS;
+    int n = num_world_spawns;
+
+    // Drop records that left the band (their actors despawn on their own)
+    while (spawn_lo < spawn_hi && world_spawns[spawn_lo].col < lo) spawn_lo++;
+    while (spawn_hi > spawn_lo && world_spawns[spawn_hi - 1].col > hi) spawn_hi--;
+    if (spawn_lo == spawn_hi) {
+        // Empty band (boot, or a jump): re-anchor at `lo` without waking
+        while (spawn_lo < n && world_spawns[spawn_lo].col < lo) spawn_lo++;
+        while (spawn_lo > 0 && world_spawns[spawn_lo - 1].col >= lo) spawn_lo--;
+        spawn_hi = spawn_lo;
+    }
+    // Wake records the band just reached, on either side
+    while (spawn_hi < n && world_spawns[spawn_hi].col <= hi) wake_spawn(spawn_hi++);
+    while (spawn_lo > 0 && world_spawns[spawn_lo - 1].col >= lo) wake_spawn(--spawn_lo);
+}
+
+//=============================================================================
+// Per-type behaviour
+//=============================================================================
+static void update_walker(int i) {
+    int d = ents.dir[i];
+    int nx = ents.x[i] + ((dir_dx[d] * ENT_WALK_SPEED) >> 1);
+    int ny = ents.y[i] + ((dir_dy[d] * ENT_WALK_SPEED) >> 1);
+    int col, row;
+    world_to_tile(FP2INT(nx), FP2INT(ny), &col, &row);
+
+    // Walkers never climb or drop: turn round at any height change or the map
+    // edge, or before stepping onto a tile another walker stands on
+    MapCell *cell = get_map_cell(world_map, col, row);
+    int entering = col != ents.col[i] || row != ents.row[i];
+    if (!cell || cell->height != ents.height[i] ||
+        (entering && broadphase_tile(col, row, ents.height[i], ENT_WALKERS, i, 0, 0))) {
+        ents.dir[i] = d ^ 2;
+        return;
+    }
+    ents.x[i] = nx;
+    ents.y[i] = ny;
+    ents.col[i] = col;
+    ents.row[i] = row;
+    if (entering) broadphase_moved(i);
+
+    anim_step(&anim_hero, HERO_ANIM_PATROL, &ents.frame[i], &ents.anim_timer[i]);
+}
+
+// Chase: one step in the direction the last think read from the flow
+// field. Heights follow the player's rules (the field only points where a
+// jump or drop is legal); a walker in the way makes the chaser wait rather
+// than turn.
+static void update_chaser(int i) {
+    int d = ents.dir[i];
+    int nx = ents.x[i] + ((dir_dx[d] * ENT_WALK_SPEED) >> 1);
+    int ny = ents.y[i] + ((dir_dy[d] * ENT_WALK_SPEED) >> 1);
+    int col, row;
+    world_to_tile(FP2INT(nx), FP2INT(ny), &col, &row);
+    if (col != ents.col[i] || row != ents.row[i]) {
+        MapCell *cell = get_map_cell(world_map, col, row);
+        if (!cell || cell->height > ents.height[i] + 1 ||
+            broadphase_tile(col, row, cell->height, ENT_WALKERS, i, 0, 0))
+            return;
+        ents.col[i] = col;
+        ents.row[i] = row;
+        ents.height[i] = cell->height;
+        broadphase_moved(i);
+    }
+    ents.x[i] = nx;
+    ents.y[i] = ny;
+    anim_step(&anim_hero, HERO_ANIM_PATROL, &ents.frame[i], &ents.anim_timer[i]);
+}
+
+static void update_guard(int i) {
+    switch (ents.state[i]) {
+        case ENT_ST_CHASE: update_chaser(i); entity_stats.chasing++; break;
+        case ENT_ST_HOLD:  entity_stats.chasing++; break;
+        default:           update_walker(i); break;
+    }
+}
+
+//=============================================================================
+// Thinking (ai.h): decisions and queries, time-sliced
+//=============================================================================
+// Start the chase when the player is near by path and in sight, drop it by
+// flow distance; while chasing, take the field's direction for the tile we
+// stand on
+static int think_guard(int i) {
+    int dist = flow_dist(ents.col[i], ents.row[i]);
+    int st = ents.state[i];
+    if (st == ENT_ST_WALK) {
+        if (dist > ENT_CHASE_DIST) return AI_PATH_CYCLES;
+        int cycles;
+        if (!los_visible(ents.col[i], ents.row[i], player.tile_col, player.tile_row, &cycles))
+            return AI_PATH_CYCLES + cycles;
+    }
+    if (dist > ENT_GIVE_UP_DIST) {
+        ents.state[i] = ENT_ST_WALK;
+        return AI_PATH_CYCLES;
+    }
+    int d = flow_dir(ents.col[i], ents.row[i]);
+    if (d == FLOW_HERE) {
+        ents.state[i] = ENT_ST_HOLD;
+    } else {
+        ents.state[i] = ENT_ST_CHASE;
+        ents.dir[i] = d;
+    }
+    return 2 * AI_PATH_CYCLES;
+}
+
+// Wander: now and then a slime turns onto the other axis
+static int think_slime(int i) {
+    wander_rng ^= wander_rng << 13;
+    wander_rng ^= wander_rng >> 17;
+    wander_rng ^= wander_rng << 5;
+    if ((wander_rng & 3) == 0) ents.dir[i] ^= 1 + ((wander_rng >> 2) & 2);
+    return 0;
+}
+
+static int think(int i) {
+    switch (ents.type[i]) {
+        case ENT_GUARD: return think_guard(i);
+        case ENT_SLIME: return think_slime(i);
+        default:        return 0;
+    }
+}
+
+static void update_pickup(int i) {
+    // Bob: two frames, swapped every 16 steps
+    if (++ents.anim_timer[i] >= 16) {
+        ents.anim_timer[i] = 0;
+        ents.frame[i] ^= 1;
+    }
+}
+
+//=============================================================================
+// Update: one linear pass over the live prefix of the pool
+//=============================================================================
+void entity_update(void) {
+    int cam_col, cam_row;
+    world_to_tile(FP2INT(camera.x), FP2INT(camera.y), &cam_col, &cam_row);
+    update_spawn_band(cam_col);
+    flow_update(player.tile_col, player.tile_row);
+
+    u32 active = 0;
+    u32 step = ai_step();
+    int div = gov_knobs->ai_think_div;
+    entity_stats.chasing = 0;
+    for (int i = 0; i < ent_high_water; i++) {
+        int type = ents.type[i];
+        if (type == ENT_NONE) continue;
+        int dc = ents.col[i] - cam_col;
+        if (dc < 0) dc = -dc;
+        if (dc > ENT_DESPAWN_COLS) {
+            entity_free(i);
+            entity_stats.despawned++;
+            continue;
+        }
+        if (dc > ENT_ACTIVE_COLS) continue;   // frozen until the camera returns
+
+        active++;
+        if (type == ENT_PICKUP) {
+            update_pickup(i);
+            continue;
+        }
+        int interval = (type == ENT_GUARD ? ENT_THINK_GUARD : ENT_THINK_SLIME) * div;
+        if (ai_due(i, interval, step)) ai_request(i);
+        if (type == ENT_GUARD) update_guard(i);
+        else                   update_walker(i);
+    }
+    ai_run(think);
+    entity_stats.active = active;
+    if (active > entity_stats.peak_active) entity_stats.peak_active = active;
+
+    // Enemy contact with the player (no damage model yet: counted only)
+    entity_stats.contacts = broadphase_near(FP2INT(player.world_x), FP2INT(player.world_y),
+                                            player.height, ENT_CONTACT_RADIUS, ENT_WALKERS,
+                                            0, 0);
+    broadphase_end_step();
+}
+
+//=============================================================================
+// Draw
+//=============================================================================
+void entity_draw(void) {
+    int cam_x = FP2INT(camera.x), cam_y = FP2INT(camera.y);
+    for (int i = 0; i < ent_high_water; i++) {
+        int type = ents.type[i];
+        // Pickups have no OBJ art yet
+        if (type != ENT_GUARD && type != ENT_SLIME) continue;
+
+        int wy = FP2INT(ents.y[i]);
+        int sx, sy;
+        world_to_screen(FP2INT(ents.x[i]), wy, cam_x, cam_y, &sx, &sy);
+        sx -= PLAYER_SPR_W / 2;
+        sy -= ents.height[i] * SIDE_HEIGHT + PLAYER_SPR_H / 2;
+        if (sx <= -PLAYER_SPR_W || sx >= SCREEN_W || sy <= -PLAYER_SPR_H || sy >= SCREEN_H)
+            continue;
+
+        u16 flip;
+        const MetaCell *cell = anim_cell(&anim_hero, HERO_ANIM_PATROL, ents.frame[i],
+                                         ents.dir[i], &flip);
+        int tile_id = objvram_frame(SPRITE_ID_ENTITY + i, anim_cell_tiles(&anim_hero, cell),
+                                    cell->num_tiles);
+        if (tile_id < 0) continue;
+        int pal = (type == ENT_GUARD) ? ENT_PAL_GUARD : ENT_PAL_SLIME;
+        int prio = sprite_bg_prio(ents.col[i], ents.row[i], ents.height[i], wy);
+        sprite_add_meta(SPRITE_ID_ENTITY + i,
+                        SPRITE_KEY(ents.col[i], ents.row[i], ents.height[i]),
+                        sx, sy, ATTR0_4BPP, flip,
+                        ATTR2_ID(tile_id) | ATTR2_PRIO(prio) | ATTR2_PALBANK(pal),
+                        anim_cell_pieces(&anim_hero, cell), cell->num_pieces);
+    }
+}
@@ -0,0 +1,138 @@
+// flowfield.c — Shared height-aware flow field toward the player
+#include "flowfield.h"
+#include "world.h"
+#include <string.h>
+
+FlowStats flow_stats;
+
+typedef struct {
+    u16 dist[FLOW_CELLS];       // [row * FLOW_COLS + col - col0]
+    u8  dir[FLOW_CELLS];
+    int col0;                   // first map column of the window
+    int target_col, target_row;
+    int valid;
+} FlowField;
+
+static FlowField fields[2] EWRAM_BSS;
+static FlowField *front = &fields[0], *back = &fields[1];
+
+// Build in progress into `back`
+static int building;
+static u32 build_start;
+static u32 step_count;
+static u16 queue[FLOW_CELLS] EWRAM_BSS;
+static int q_head, q_tail;
+
+// Tile step per DIR_* (SE, NE, NW, SW), as in player.c's facing_tile()
+static const s8 dir_dc[4] = { 1, 0, -1, 0 };
+static const s8 dir_dr[4] = { 0, -1, 0, 1 };
+
+void flow_init(void) {
+    memset(&flow_stats, 0, sizeof(flow_stats));
+    fields[0].valid = fields[1].valid = 0;
+    front = &fields[0];
+    back = &fields[1];
+    building = 0;
+    step_count = 0;
+}
+
+static void build_start_at(int col, int row) {
+    int col0 = col - FLOW_COLS / 2;
+    if (col0 > MAP_COLS - FLOW_COLS) col0 = MAP_COLS - FLOW_COLS;
+    if (col0 < 0) col0 = 0;
+    FlowField *f = back;
+    f->col0 = col0;
+    f->target_col = col;
+    f->target_row = row;
+    f->valid = 0;
+    memset(f->dist, 0xFF, sizeof(f->dist));
+    memset(f->dir, FLOW_NONE, sizeof(f->dir));
+    int t = row * FLOW_COLS + (col - col0);
+    f->dist[t] = 0;
+    f->dir[t] = FLOW_HERE;
+    queue[0] = (u16)t;
+    q_head = 0;
+    q_tail = 1;
+    building = 1;
+    build_start = step_count;
+}
+
+// Expand up to `budget` cells; returns the number expanded
+static int build_expand(int budget) {
+    FlowField *f = back;
+    int n = 0;
+    while (n < budget && q_head < q_tail) {
+        int b = queue[q_head++];
+        int br = b / FLOW_COLS, bc = b % FLOW_COLS;
+        int hb = world_map[br][f->col0 + bc].height;
+        u16 next = f->dist[b] + 1;
+        // Neighbour a reaches b by stepping in direction d (b = a + step(d))
+        for (int d = 0; d < 4; d++) {
+            int ac = bc - dir_dc[d], ar = br - dir_dr[d];
+            if (ac < 0 || ac >= FLOW_COLS || ar < 0 || ar >= MAP_ROWS) continue;
+            int a = ar * FLOW_COLS + ac;
+            if (f->dist[a] != FLOW_FAR) continue;
+            // Same height, one up (jump) or any drop (fall)
+            if (hb > world_map[ar][f->col0 + ac].height + 1) continue;
+            f->dist[a] = next;
+            f->dir[a] = (u8)d;
+            queue[q_tail++] = (u16)a;
+        }
+        n++;
+    }
+    return n;
+}
+
+static void build_finish(void) {
+    FlowField *t = front;
+    back->valid = 1;
+    front = back;
+    back = t;
+    building = 0;
+    flow_stats.builds++;
+    flow_stats.build_steps = step_count - build_start + 1;
+    flow_stats.reached = q_tail;
+}
+
+void flow_update(int col, int row) {
+    FlowStats *fs = &flow_stats;
+    step_count++;
+    if (!building) {
+        if (front->valid && front->target_col == col && front->target_row == row) {
+            fs->cells = 0;
+            return;
+        }
+        build_start_at(col, row);
+    }
+    int n = build_expand(FLOW_CELLS_PER_STEP);
+    fs->cells = n;
+    fs->cells_total += n;
+    if (n > (int)fs->cells_peak) fs->cells_peak = n;
+    if (q_head == q_tail) build_finish();
+}
+
+void flow_build_now(int col, int row) {
+    build_start_at(col, row);
+    flow_stats.cells_total += build_expand(FLOW_CELLS);
+    build_finish();
+}
+
+static int field_index(int col, int row) {
+    flow_stats.lookups++;
+    int c = col - front->col0;
+    if (!front->valid || c < 0 || c >= FLOW_COLS || row < 0 || row >= MAP_ROWS) {
+        flow_stats.outside++;
+        return -1;
+    }
+    return row * FLOW_COLS + c;
+}
+
+int flow_dir(int col, int row) {
+    int k = field_index(col, row);
+    return k < 0 ? FLOW_NONE : front->dir[k];
+}
+
+int flow_dist(int col, int row) {
+    int k = field_index(col, row);
+    return k < 0 ? FLOW_FAR : front->dist[k];
+}
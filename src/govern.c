@@ -0,0 +1,120 @@
+// govern.c — Adaptive frame-budget governor
+#include "govern.h"
+#include "stream.h"
+#include "particle.h"
+#include "present.h"
+#include <string.h>
+
+#define FRAME_LINES  228
+#define VDRAW_LINES  160
+
+static const GovKnobs gov_table[GOV_LEVELS] = {
+    //  prefetch  ai_div  particles  stage cols
+    {   8,        1,      48,        STAGE_COLS },
+    {   4,        2,      32,        STAGE_COLS / 2 },
+    {   2,        3,      16,        1 },
+    {   0,        4,       8,        1 },
+};
+
+GovStats gov_stats;
+const GovKnobs *gov_knobs = &gov_table[0];
+int gov_level;
+
+static int enabled = 1;
+static int start_line;
+static int render_start;
+static int tight_run, slack_run;
+static int level_lines[GOV_LEVELS];     // latest frame cost at each level (0 = unseen)
+
+static int lines_since(int line) {
+    int d = REG_VCOUNT - line;
+    return d < 0 ? d + FRAME_LINES : d;
+}
+
+static void set_level(int level) {
+    gov_level = level;
+    gov_knobs = &gov_table[level];
+    stream_prefetch = gov_knobs->prefetch_lines;
+    particle_cap = gov_knobs->particle_cap;
+    stream_stage_cols = gov_knobs->stage_cols;
+}
+
+// Lines from the start of VBlank (the previous commit) to `line`
+static int since_vblank(int line) {
+    int d = line - VDRAW_LINES;
+    return d < 0 ? d + FRAME_LINES : d;
+}
+
+void gov_init(void) {
+    memset(&gov_stats, 0, sizeof(gov_stats));
+    gov_stats.headroom_min = FRAME_LINES;
+    tight_run = slack_run = 0;
+    memset(level_lines, 0, sizeof(level_lines));
+    set_level(0);
+}
+
+void gov_set_enabled(int on) {
+    enabled = on;
+    if (!on) set_level(0);
+}
+
+void gov_begin_logic(void) {
+    start_line = REG_VCOUNT;
+}
+
+void gov_end_logic(int steps) {
+    GovStats *gs = &gov_stats;
+    gs->logic_lines = lines_since(start_line);
+    int cost = gs->logic_lines + gs->render_lines;
+    if (steps == 1) level_lines[gov_level] = cost;
+    // Render ends this far past the latest VBlank; the next commit is one
+    // frame after it. A catch-up iteration already missed its frame, and
+    // its line count wraps. Lines slept for late input are slack only on a
+    // frame that makes its commit: the next one can wake that much earlier.
+    int finish = since_vblank(start_line) + cost;
+    int late = FRAME_LINES - finish;
+    int headroom = steps > 1 ? -1 : late < 0 ? late : late + present_wait_lines;
+    gs->headroom = headroom;
+    if (headroom < gs->headroom_min) gs->headroom_min = headroom;
+    gs->frames++;
+    render_start = REG_VCOUNT;
+
+    if (enabled) {
+        if (headroom < GOV_LOW_LINES) {
+            slack_run = 0;
+            // An overrun degrades at once, as many levels as it missed by;
+            // a merely tight frame has to repeat
+            if ((headroom < 0 || ++tight_run >= GOV_DOWN_FRAMES) &&
+                gov_level < GOV_LEVELS - 1) {
+                int to = gov_level + 1;
+                if (headroom < 0) to += -headroom / GOV_LEVEL_LINES;
+                set_level(to < GOV_LEVELS ? to : GOV_LEVELS - 1);
+                gs->downs++;
+                gs->decisions++;
+                tight_run = 0;
+            }
+        } else if (headroom > GOV_HIGH_LINES) {
+            tight_run = 0;
+            // Recover only into a level that, as last seen, still leaves
+            // GOV_LOW_LINES, and wake for input early enough for its cost
+            if (++slack_run >= GOV_UP_FRAMES && gov_level > 0) {
+                int above = level_lines[gov_level - 1];
+                int grow = above ? above - cost : GOV_LEVEL_LINES;
+                if (headroom - grow >= GOV_LOW_LINES) {
+                    set_level(gov_level - 1);
+                    present_expect(cost + grow);
+                    gs->ups++;
+                    gs->decisions++;
+                }
+                slack_run = 0;
+            }
+        } else {
+            tight_run = slack_run = 0;
+        }
+    }
+    gs->level_frames[gov_level]++;
+}
+
+void gov_end_render(void) {
+    gov_stats.render_lines = lines_since(render_start);
+}
@@ -0,0 +1,105 @@
+// los.c — Cached line of sight over the heightmap
+#include "los.h"
+#include "world.h"
+#include <string.h>
+
+LosStats los_stats;
+
+typedef struct {
+    u32 key;            // packed tiles + 1, 0 = empty
+    u8  visible;
+    u8  col_lo, col_hi; // columns the ray spans
+    u8  pad;
+} LosEntry;
+
+static LosEntry cache[LOS_CACHE] EWRAM_BSS;
+
+void los_init(void) {
+    memset(&los_stats, 0, sizeof(los_stats));
+    memset(cache, 0, sizeof(cache));
+}
+
+static inline int cell_top(int col, int row) {
+    return world_map[row][col].height * LOS_SUB;
+}
+
+// The ray's height over the i-th half step of 2n is eye + (aim - eye) * i / 2n;
+// cell k (1..n-1) spans half steps 2k-1..2k+1 and blocks when its top is above
+// the lower end of that stretch.
+static inline int blocks(int top, int eye, int aim, int k, int n) {
+    int lo = aim < eye ? 2 * k + 1 : 2 * k - 1;
+    return top * 2 * n > eye * 2 * n + (aim - eye) * lo;
+}
+
+int los_ray(int sc, int sr, int dc, int dr, int *cells) {
+    los_stats.rays++;
+    int eye = cell_top(sc, sr) + LOS_EYE, aim = cell_top(dc, dr) + LOS_AIM;
+    int dx = dc > sc ? dc - sc : sc - dc, dy = dr > sr ? dr - sr : sr - dr;
+    int ix = dc > sc ? 1 : -1, iy = dr > sr ? 1 : -1;
+    int n = dx + dy;
+    int c = sc, r = sr, tested = 0, visible = 1;
+    // err > 0: next crossing is a column edge; < 0: a row edge; 0: a corner
+    int err = dx - dy;
+    dx *= 2;
+    dy *= 2;
+    for (int k = 1; k < n; k++) {
+        if (err > 0) {
+            c += ix;
+            err -= dy;
+        } else if (err < 0) {
+            r += iy;
+            err += dx;
+        } else {
+            // Exact corner: the ray grazes both side cells; it is blocked
+            // only if both are, then steps diagonally (two cells)
+            tested += 2;
+            if (blocks(cell_top(c + ix, r), eye, aim, k, n) &&
+                blocks(cell_top(c, r + iy), eye, aim, k, n)) {
+                visible = 0;
+                break;
+            }
+            c += ix;
+            r += iy;
+            err += dx - dy;
+            if (++k >= n) break;
+        }
+        tested++;
+        if (blocks(cell_top(c, r), eye, aim, k, n)) {
+            visible = 0;
+            break;
+        }
+    }
+    los_stats.cells += tested;
+    if (cells) *cells = tested;
+    return visible;
+}
+
+int los_visible(int sc, int sr, int dc, int dr, int *cycles) {
+    los_stats.queries++;
+    u32 key = ((u32)sc << 20 | (u32)sr << 16 | (u32)dc << 4 | (u32)dr) + 1;
+    LosEntry *e = &cache[(key * 0x9E3779B1u) >> 24];
+    if (e->key == key) {
+        los_stats.hits++;
+        if (cycles) *cycles = LOS_HIT_CYCLES;
+        return e->visible;
+    }
+    int tested;
+    int v = los_ray(sc, sr, dc, dr, &tested);
+    e->key = key;
+    e->visible = (u8)v;
+    e->col_lo = (u8)(sc < dc ? sc : dc);
+    e->col_hi = (u8)(sc < dc ? dc : sc);
+    if (cycles) *cycles = LOS_HIT_CYCLES + LOS_RAY_CYCLES + tested * LOS_CELL_CYCLES;
+    return v;
+}
+
+void los_cell_changed(int col, int row) {
+    (void)row;                  // rays are only bounded by column
+    for (int k = 0; k < LOS_CACHE; k++) {
+        LosEntry *e = &cache[k];
+        if (e->key && col >= e->col_lo && col <= e->col_hi) {
+            e->key = 0;
+            los_stats.invalidated++;
+        }
+    }
+}
@@ -1,819 +1,63 @@
 // main.c — v0.3: Collision, jump, fall, occlusion
 #include "game.h"
+#include "world.h"
+#include "compose.h"
+#include "stream.h"
+#include "player.h"
+#include "replay.h"
+#include "timing.h"
+#include "present.h"
+#include "govern.h"
+#include "entity.h"
+#include "sprite.h"
+#include "objvram.h"
+#include "oammux.h"
+#include "affine.h"
+#include "particle.h"
+#include "trigger.h"
+#include "script.h"
+#include "sound.h"
+#include "save.h"
+#include "asset.h"
+#include "warp.h"
 #include "../data/metatiles.h"
-#include "../data/hero_walk.h"
-#include <string.h>
-
-//=============================================================================
-// Globals
-//=============================================================================
-static OBJ_ATTR obj_buffer[128];
-static Player player;
-static Camera camera;
-
-static MapCell world_map[MAP_ROWS][MAP_COLS];
-
-#define HERO_TILES_PER_FRAME  16
-#define HERO_WALK_FRAMES      6
-#define HERO_ANIM_SPEED       4
-
-//=============================================================================
-// EWRAM: pre-computed world tilemap + tile pixel dictionary
-//=============================================================================
-EWRAM_BSS static u16 world_tilemap[WORLD_TILE_H * WORLD_TILE_W];
-EWRAM_BSS static u8 tile_dict[MAX_PRECOMP_TILES][64];  // 8bpp pixel data per tile
-static int num_tiles;
-
-// Ring buffer tracking
-static int loaded_col_min, loaded_row_min;
-
-// World bounds for player clamping (fixed-point)
-static int bound_wx_min, bound_wx_max;
-static int bound_wy_min, bound_wy_max;
-
-//=============================================================================
-// RNG
-//=============================================================================
-static u32 rng_state = 0xDEADBEEF;
-static u32 rng_next(void) {
-    rng_state ^= rng_state << 13;
-    rng_state ^= rng_state >> 17;
-    rng_state ^= rng_state << 5;
-    return rng_state;
-}
-
-//=============================================================================
-// World generation with height
-//=============================================================================
-static void generate_world(void) {
-    // Default: flat grass at height 1
-    for (int r = 0; r < MAP_ROWS; r++) {
-        for (int c = 0; c < MAP_COLS; c++) {
-            world_map[r][c].ground = GROUND_GRASS;
-            world_map[r][c].side = SIDE_GRASS;
-            world_map[r][c].height = 1;
-        }
-    }
-
-    // === ROAD: stone path through center ===
-    for (int c = 0; c < MAP_COLS; c++) {
-        int road_center = 7 + ((c * 3 + c / 7) % 4) - 1;
-        for (int r = 0; r < MAP_ROWS; r++) {
-            int dist = r - road_center;
-            if (dist < 0) dist = -dist;
-            if (dist <= 1) {
-                world_map[r][c].ground = GROUND_STONE;
-                world_map[r][c].side = SIDE_STONE;
-            }
-        }
-    }
-
-    // === HILLS: rolling terrain (height 2-3) ===
-    // Hill cluster 1: cols 10-25, rows 0-5
-    for (int c = 10; c <= 25; c++) {
-        for (int r = 0; r <= 5; r++) {
-            int dc = c - 17, dr = r - 2;
-            int d2 = dc * dc + dr * dr * 2;
-            if (d2 < 20) {
-                world_map[r][c].height = (d2 < 8) ? 3 : 2;
-            }
-        }
-    }
-
-    // Hill cluster 2: cols 55-70, rows 0-6
-    for (int c = 55; c <= 70; c++) {
-        for (int r = 0; r <= 6; r++) {
-            int dc = c - 62, dr = r - 3;
-            int d2 = dc * dc + dr * dr * 2;
-            if (d2 < 30) {
-                world_map[r][c].height = (d2 < 10) ? 3 : 2;
-            }
-        }
-    }
-
-    // Hill cluster 3: cols 120-135, rows 10-15
-    for (int c = 120; c <= 135; c++) {
-        for (int r = 10; r <= 15; r++) {
-            int dc = c - 127, dr = r - 12;
-            int d2 = dc * dc + dr * dr * 2;
-            if (d2 < 25) {
-                world_map[r][c].height = (d2 < 8) ? 3 : 2;
-            }
-        }
-    }
-
-    // === RIVER VALLEY: cols 40-55, height 0 with water ===
-    for (int c = 38; c <= 57; c++) {
-        int river_center = 4 + ((c - 38) * 6) / 20;
-        for (int r = 0; r < MAP_ROWS; r++) {
-            int dist = r - river_center;
-            if (dist < 0) dist = -dist;
-            if (dist <= 2) {
-                world_map[r][c].height = 0;
-                world_map[r][c].ground = GROUND_WATER;
-                world_map[r][c].side = SIDE_DIRT;
-            } else if (dist == 3) {
-                world_map[r][c].ground = GROUND_DIRT;
-                world_map[r][c].side = SIDE_DIRT;
-            }
-        }
-    }
-
-    // === LAKE: cols 100-115, rows 8-14, height 0 ===
-    for (int c = 100; c <= 115; c++) {
-        for (int r = 8; r <= 14; r++) {
-            int dc = c - 107, dr = r - 11;
-            int d2 = dc * dc + dr * dr * 3;
-            if (d2 <= 35) {
-                world_map[r][c].height = 0;
-                world_map[r][c].ground = GROUND_WATER;
-                world_map[r][c].side = SIDE_DIRT;
-            }
-        }
-    }
-
-    // === FORTRESS: cols 150-170, rows 3-12, brick walls + roof ===
-    for (int c = 150; c <= 170; c++) {
-        for (int r = 3; r <= 12; r++) {
-            int on_wall = 0;
-            // Outer walls
-            if (r == 3 || r == 12) on_wall = 1;
-            if (c == 150 || c == 170) on_wall = 1;
-
-            if (on_wall) {
-                world_map[r][c].ground = GROUND_ROOF;
-                world_map[r][c].side = SIDE_BRICK;
-                world_map[r][c].height = 4;
-            } else if (c >= 152 && c <= 168 && r >= 5 && r <= 10) {
-                // Inner courtyard floor - stone at height 2
-                world_map[r][c].ground = GROUND_STONE;
-                world_map[r][c].side = SIDE_STONE;
-                world_map[r][c].height = 2;
-            }
-
-            // Corner towers (even higher)
-            if ((c >= 149 && c <= 151 && (r >= 2 && r <= 4)) ||
-                (c >= 169 && c <= 171 && (r >= 2 && r <= 4)) ||
-                (c >= 149 && c <= 151 && (r >= 11 && r <= 13)) ||
-                (c >= 169 && c <= 171 && (r >= 11 && r <= 13))) {
-                world_map[r][c].ground = GROUND_ROOF;
-                world_map[r][c].side = SIDE_BRICK;
-                world_map[r][c].height = 4;
-            }
-
-            // Main hall inside fortress
-            if (c >= 155 && c <= 165 && r >= 6 && r <= 9) {
-                world_map[r][c].ground = GROUND_ROOF;
-                world_map[r][c].side = SIDE_BRICK;
-                world_map[r][c].height = 3;
-            }
-        }
-    }
-
-    // === DIRT PATCHES: cols 80-95 ===
-    for (int c = 80; c <= 95; c++) {
-        for (int r = 0; r < MAP_ROWS; r++) {
-            rng_state = (u32)(c * 31 + r * 97 + 12345);
-            rng_next();
-            if ((rng_next() % 100) < 50 && world_map[r][c].ground == GROUND_GRASS) {
-                world_map[r][c].ground = GROUND_DIRT;
-                world_map[r][c].side = SIDE_DIRT;
-            }
-        }
-    }
-
-    // === STONE RUINS: cols 175-195 ===
-    for (int c = 175; c <= 195; c++) {
-        for (int r = 0; r < MAP_ROWS; r++) {
-            if (r == 3 || r == 12) {
-                world_map[r][c].ground = GROUND_STONE;
-                world_map[r][c].side = SIDE_STONE;
-                world_map[r][c].height = 2;
-            }
-            if ((c == 175 || c == 195) && r >= 3 && r <= 12) {
-                world_map[r][c].ground = GROUND_STONE;
-                world_map[r][c].side = SIDE_STONE;
-                world_map[r][c].height = 2;
-            }
-            if (c >= 180 && c <= 190 && r >= 5 && r <= 10) {
-                world_map[r][c].ground = GROUND_STONE;
-                world_map[r][c].side = SIDE_STONE;
-                world_map[r][c].height = 3;
-            }
-        }
-    }
-
-    // === Small pond near start ===
-    for (int c = 5; c <= 10; c++) {
-        for (int r = 1; r <= 4; r++) {
-            int dc = c - 7, dr = r - 2;
-            if (dc * dc + dr * dr <= 4) {
-                world_map[r][c].height = 0;
-                world_map[r][c].ground = GROUND_WATER;
-                world_map[r][c].side = SIDE_DIRT;
-            }
-        }
-    }
-}
+#include "../data/anim_hero.h"
+#include "../data/fx.h"
+#include "../data/sounds.h"
+#include "../data/archive.h"
 
 //=============================================================================
 // Palette setup
 //=============================================================================
 static void setup_palette(void) {
-    // Copy metatile palette to BG palette
-    for (int i = 0; i < MT_PALETTE_SIZE; i++)
-        pal_bg_mem[i] = mt_palette[i];
-    // Index 0 = background color (dark blue-black), not transparent magenta
-    pal_bg_mem[0] = RGB15(2, 2, 5);
-
-    // Hero sprite palette
-    memcpy16(pal_obj_mem, hero_walkPal, hero_walkPalLen / 2);
-}
-
-//=============================================================================
-// Tile dedup with simple hash for speed
-//=============================================================================
-#define HASH_SIZE 2048
-#define HASH_MASK (HASH_SIZE - 1)
-static u16 hash_table[HASH_SIZE];  // tile index + 1, or 0 = empty
-static u16 hash_keys[HASH_SIZE];   // hash of tile data
-
-static u32 tile_hash(const u8 *data) {
-    u32 h = 0x811C9DC5;
-    const u32 *p = (const u32 *)data;
+    // First zone's terrain palette; its index 0 is the backdrop colour
+    // (dark blue-black), not transparent magenta
+    asset_load(ASSET_PAL_MEADOW, pal_bg_mem, ASSET_TO_VRAM);
+
+    // Hero sprite palette, plus tinted copies for actors sharing its sheet:
+    // guards swap red/blue (red armour), slimes swap green/blue
+    const u16 *hero_pal = asset_rom(ASSET_HERO_PAL);
+    memcpy16(pal_obj_mem, hero_pal, 16);
     for (int i = 0; i < 16; i++) {
-        h ^= p[i];
-        h *= 0x01000193;
-    }
-    return h;
-}
-
-static int find_or_add_tile(const u8 *pixels) {
-    u32 h = tile_hash(pixels);
-    u32 slot = h & HASH_MASK;
-
-    // Linear probe
-    for (int i = 0; i < HASH_SIZE; i++) {
-        u32 s = (slot + i) & HASH_MASK;
-        if (hash_table[s] == 0) {
-            // Empty slot - add new tile
-            if (num_tiles >= MAX_PRECOMP_TILES) return 0;
-            int id = num_tiles++;
-            memcpy(tile_dict[id], pixels, 64);
-            hash_table[s] = id + 1;
-            hash_keys[s] = (u16)(h >> 16);
-            return id;
-        }
-        int tid = hash_table[s] - 1;
-        if (hash_keys[s] == (u16)(h >> 16)) {
-            // Possible match - verify
-            if (memcmp(tile_dict[tid], pixels, 64) == 0)
-                return tid;
-        }
-    }
-    return 0;  // hash table full
-}
-
-//=============================================================================
-// Metatile stamping: composite a 4x2 metatile at world pixel (px, py)
-// Handles transparency (pixel index 0 = don't overwrite)
-//=============================================================================
-static void stamp_metatile(int mt_idx, int px, int py) {
-    const u16 *mt_tiles = mt_metatile_tiles[mt_idx];
-
-    for (int ty = 0; ty < 2; ty++) {
-        for (int tx = 0; tx < 4; tx++) {
-            int src_tile = mt_tiles[ty * 4 + tx];
-            const u8 *src = mt_tile_pixels[src_tile];
-
-            // World tile coords
-            int wtc = (px + tx * 8 - WORLD_PX_X0) / 8;
-            int wtr = (py + ty * 8 - WORLD_PX_Y0) / 8;
-
-            if (wtc < 0 || wtc >= WORLD_TILE_W || wtr < 0 || wtr >= WORLD_TILE_H)
-                continue;
-
-            // Check if source tile is all transparent
-            int has_opaque = 0;
-            for (int i = 0; i < 64; i++) {
-                if (src[i] != 0) { has_opaque = 1; break; }
-            }
-            if (!has_opaque) continue;
-
-            // Get current tile pixels at this position
-            int cur_idx = world_tilemap[wtr * WORLD_TILE_W + wtc];
-            u8 composite[64];
-            memcpy(composite, tile_dict[cur_idx], 64);
-
-            // Composite: overwrite non-transparent pixels
-            for (int i = 0; i < 64; i++) {
-                if (src[i] != 0) composite[i] = src[i];
-            }
-
-            // Dedup and store
-            int new_idx = find_or_add_tile(composite);
-            world_tilemap[wtr * WORLD_TILE_W + wtc] = (u16)new_idx;
-        }
-    }
-}
-
-//=============================================================================
-// Isometric side face: stamp a parallelogram-shaped face into world tilemap.
-// face=0 → left face (slopes down-right following diamond left edge)
-// face=1 → right face (slopes down-left following diamond right edge)
-//
-// Left face parallelogram (world coords, relative to diamond center wx,wy):
-//   A=(wx-16, top_y+8)  B=(wx, top_y+16)  C=(wx, top_y+16+fh)  D=(wx-16, top_y+8+fh)
-//   where top_y = base_y - h*SIDE_HEIGHT, fh = h*SIDE_HEIGHT
-//
-// Right face parallelogram:
-//   E=(wx, top_y+16)  F=(wx+16, top_y+8)  G=(wx+16, top_y+8+fh)  H=(wx, top_y+16+fh)
-//=============================================================================
-static void stamp_side_face(int mt_idx, int face, int wx, int top_y, int face_h) {
-    // Proper isometric parallelogram side face.
-    // LEFT face: top edge from (wx-16, top_y+8) to (wx, top_y+16) — slope 8/16 = 1:2
-    //   At local x (0..15), the top of the face is at ly = lx/2
-    //   Bottom edge parallel: ly = lx/2 + face_h
-    //   Bounding box: (wx-16, top_y+8), 16 x (face_h + 8)
-    // RIGHT face: top edge from (wx, top_y+16) to (wx+16, top_y+8) — slope -1:2
-    //   At local x (0..15), the top of the face is at ly = 8 - (lx+1)/2
-    //   Bottom edge parallel: ly = 8 - (lx+1)/2 + face_h
-    //   Bounding box: (wx, top_y+8), 16 x (face_h + 8)
-    if (face_h <= 0) return;
-
-    int face_px, face_py, face_w;
-    face_w = 16;
-    face_py = top_y + 8;
-    int total_h = face_h + 8;
-
-    if (face == 0) {
-        face_px = wx - 16;
-    } else {
-        face_px = wx;
-    }
-
-    int tc_min = (face_px - WORLD_PX_X0) / 8;
-    int tc_max = (face_px + face_w - 1 - WORLD_PX_X0) / 8;
-    int tr_min = (face_py - WORLD_PX_Y0) / 8;
-    int tr_max = (face_py + total_h - 1 - WORLD_PX_Y0) / 8;
-
-    for (int tr = tr_min; tr <= tr_max; tr++) {
-        if (tr < 0 || tr >= WORLD_TILE_H) continue;
-        for (int tc = tc_min; tc <= tc_max; tc++) {
-            if (tc < 0 || tc >= WORLD_TILE_W) continue;
-
-            int cur_idx = world_tilemap[tr * WORLD_TILE_W + tc];
-            u8 composite[64];
-            memcpy(composite, tile_dict[cur_idx], 64);
-            int changed = 0;
-
-            for (int py = 0; py < 8; py++) {
-                int wy = tr * 8 + WORLD_PX_Y0 + py;
-                int ly = wy - face_py;
-                if (ly < 0 || ly >= total_h) continue;
-
-                for (int px_off = 0; px_off < 8; px_off++) {
-                    int wx2 = tc * 8 + WORLD_PX_X0 + px_off;
-                    int lx = wx2 - face_px;
-                    if (lx < 0 || lx >= face_w) continue;
-
-                    // Check parallelogram bounds
-                    int top_edge;
-                    if (face == 0) {
-                        // Left face: top edge at ly = lx/2
-                        top_edge = lx / 2;
-                    } else {
-                        // Right face: top edge at ly = (16 - lx) / 2
-                        // At lx=0: top=8, at lx=15: top=0
-                        top_edge = (16 - lx) / 2;
-                    }
-
-                    if (ly < top_edge || ly >= top_edge + face_h) continue;
-
-                    // Texture coordinate: ty wraps within 16px for tiling
-                    int ty = (ly - top_edge) % 16;
-                    int tx = (face == 0) ? lx : (lx + 16);
-
-                    int mt_tx = tx / 8;
-                    int mt_ty = ty / 8;
-                    int tile_id = mt_metatile_tiles[mt_idx][mt_ty * 4 + mt_tx];
-                    int pixel = mt_tile_pixels[tile_id][(ty & 7) * 8 + (tx & 7)];
-
-                    if (pixel != 0) {
-                        composite[py * 8 + px_off] = (u8)pixel;
-                        changed = 1;
-                    }
-                }
-            }
-
-            if (changed) {
-                int new_idx = find_or_add_tile(composite);
-                world_tilemap[tr * WORLD_TILE_W + tc] = (u16)new_idx;
-            }
-        }
-    }
-}
-
-//=============================================================================
-// Boot: build world tilemap using metatile compositing
-//=============================================================================
-static void precompute_world(void) {
-    num_tiles = 0;
-    memset(world_tilemap, 0, sizeof(world_tilemap));
-    memset(hash_table, 0, sizeof(hash_table));
-    memset(tile_dict[0], 0, 64);  // tile 0 = transparent
-    num_tiles = 1;
-
-    // Ground metatile indices
-    static const int ground_mt[] = {
-        MT_GROUND_GRASS, MT_GROUND_STONE, MT_GROUND_DIRT,
-        MT_GROUND_WATER, MT_GROUND_ROOF
-    };
-    // Side metatile indices (used as texture source for parallelogram faces)
-    static const int side_mt[] = {
-        MT_SIDE_GRASS_EDGE, MT_SIDE_STONE_WALL, MT_SIDE_DIRT_WALL,
-        MT_SIDE_BRICK_WALL, MT_SIDE_ROOF_EDGE
-    };
-
-    // Render back-to-front: by (col+row) ascending
-    for (int diag = 0; diag < MAP_COLS + MAP_ROWS - 1; diag++) {
-        int r_min = diag - (MAP_COLS - 1);
-        if (r_min < 0) r_min = 0;
-        int r_max = diag;
-        if (r_max >= MAP_ROWS) r_max = MAP_ROWS - 1;
-
-        for (int r = r_min; r <= r_max; r++) {
-            int c = diag - r;
-            if (c < 0 || c >= MAP_COLS) continue;
-
-            MapCell *cell = &world_map[r][c];
-            int wx = (c - r) * ISO_HALF_W;
-            int base_y = (c + r) * ISO_HALF_H;
-            int h = cell->height;
-
-            int top_y = base_y - h * SIDE_HEIGHT;
-
-            // Draw parallelogram side faces (left and right)
-            if (h > 0) {
-                int face_h = h * SIDE_HEIGHT;
-                stamp_side_face(side_mt[cell->side], 0, wx, top_y, face_h);  // left
-                stamp_side_face(side_mt[cell->side], 1, wx, top_y, face_h);  // right
-            }
-
-            // Draw top face diamond
-            int px = wx - ISO_HALF_W;
-            stamp_metatile(ground_mt[cell->ground], px, top_y);
-        }
-    }
-}
-
-//=============================================================================
-// Upload tile dictionary to VRAM as 8bpp tiles
-//=============================================================================
-static void upload_tiles_to_vram(void) {
-    // Each 8bpp tile = 64 bytes = 16 words
-    u32 *dst = (u32 *)&tile_mem[TILE_CBB][0];
-    for (int t = 0; t < num_tiles; t++) {
-        const u8 *src = tile_dict[t];
-        u32 *d = &dst[t * 16];
-        for (int i = 0; i < 16; i++) {
-            const u8 *s = &src[i * 4];
-            d[i] = s[0] | (s[1] << 8) | (s[2] << 16) | (s[3] << 24);
-        }
-    }
-}
-
-//=============================================================================
-// Hardware screenblock helpers
-//=============================================================================
-static inline void hw_write_entry(int hc, int hr, u16 tid) {
-    int sb = (hc >> 5) + (hr >> 5) * 2;
-    ((u16 *)se_mem[TILE_SBB + sb])[(hr & 31) * 32 + (hc & 31)] = tid;
-}
-
-static void load_hw_col(int wtc) {
-    int hc = wtc & 63;
-    for (int i = 0; i < 64; i++) {
-        int wtr = loaded_row_min + i;
-        u16 tid = 0;
-        if (wtc >= 0 && wtc < WORLD_TILE_W && wtr >= 0 && wtr < WORLD_TILE_H)
-            tid = world_tilemap[wtr * WORLD_TILE_W + wtc];
-        hw_write_entry(hc, wtr & 63, tid);
-    }
-}
-
-static void load_hw_row(int wtr) {
-    int hr = wtr & 63;
-    for (int i = 0; i < 64; i++) {
-        int wtc = loaded_col_min + i;
-        u16 tid = 0;
-        if (wtc >= 0 && wtc < WORLD_TILE_W && wtr >= 0 && wtr < WORLD_TILE_H)
-            tid = world_tilemap[wtr * WORLD_TILE_W + wtc];
-        hw_write_entry(wtc & 63, hr, tid);
-    }
-}
-
-static void load_hw_full(void) {
-    for (int i = 0; i < 64; i++)
-        load_hw_col(loaded_col_min + i);
-}
-
-//=============================================================================
-// Runtime: update hardware tilemap ring buffer as camera scrolls
-//=============================================================================
-static void update_hw_tilemap(int cam_wx, int cam_wy) {
-    int cam_tc = (cam_wx - WORLD_PX_X0) / 8;
-    int cam_tr = (cam_wy - WORLD_PX_Y0) / 8;
-
-    int desired_col = cam_tc - 32;
-    int desired_row = cam_tr - 32;
-
-    if (desired_col < 0) desired_col = 0;
-    if (desired_col > WORLD_TILE_W - 64) desired_col = WORLD_TILE_W - 64;
-    if (desired_row < 0) desired_row = 0;
-    if (desired_row > WORLD_TILE_H - 64) desired_row = WORLD_TILE_H - 64;
-
-    while (loaded_col_min < desired_col) {
-        load_hw_col(loaded_col_min + 64);
-        loaded_col_min++;
-    }
-    while (loaded_col_min > desired_col) {
-        loaded_col_min--;
-        load_hw_col(loaded_col_min);
-    }
-    while (loaded_row_min < desired_row) {
-        load_hw_row(loaded_row_min + 64);
-        loaded_row_min++;
-    }
-    while (loaded_row_min > desired_row) {
-        loaded_row_min--;
-        load_hw_row(loaded_row_min);
-    }
-}
-
-//=============================================================================
-// Player
-//=============================================================================
-static void compute_world_bounds(void) {
-    int margin = 16;
-    bound_wx_min = INT2FP(WORLD_WX_MIN + margin);
-    bound_wx_max = INT2FP(WORLD_WX_MAX - margin);
-    bound_wy_min = INT2FP(WORLD_WY_MIN + margin);
-    bound_wy_max = INT2FP(WORLD_WY_MAX - margin);
-}
-
-static void player_init(void) {
-    int wx, wy;
-    iso_tile_to_world(3, 8, &wx, &wy);
-    player.world_x = INT2FP(wx);
-    player.world_y = INT2FP(wy);
-    player.facing = DIR_SE;
-    player.frame = 0;
-    player.frame_timer = 0;
-    player.moving = 0;
-    player.tile_col = 3;
-    player.tile_row = 8;
-    player.height = world_map[8][3].height;
-    player.jumping = 0;
-    player.jump_timer = 0;
-    player.jump_visual_dy = 0;
-    player.falling = 0;
-    player.fall_timer = 0;
-    player.fall_visual_dy = 0;
-}
-
-static void player_update(void) {
-    // Update jump animation
-    if (player.jumping) {
-        player.jump_timer++;
-        // Parabolic arc: peaks at JUMP_DURATION/2
-        int half = JUMP_DURATION / 2;
-        int t = player.jump_timer;
-        if (t <= half) {
-            player.jump_visual_dy = -(JUMP_PEAK_H * t / half);
-        } else {
-            player.jump_visual_dy = -(JUMP_PEAK_H * (JUMP_DURATION - t) / half);
-        }
-        if (player.jump_timer >= JUMP_DURATION) {
-            player.jumping = 0;
-            player.jump_timer = 0;
-            player.jump_visual_dy = 0;
-        }
-        // Don't allow movement during jump
-        return;
-    }
-
-    // Update fall animation
-    if (player.falling) {
-        int height_diff = player.fall_start_h - player.fall_target_h;
-        int total_fall_px = height_diff * SIDE_HEIGHT;
-        player.fall_timer++;
-        player.fall_visual_dy = player.fall_timer * FALL_SPEED;
-        if (player.fall_visual_dy >= total_fall_px) {
-            player.fall_visual_dy = 0;
-            player.falling = 0;
-            player.fall_timer = 0;
-            player.height = player.fall_target_h;
-        }
-        // Don't allow movement during fall
-        return;
-    }
-
-    int iso_dx = 0, iso_dy = 0;
-    if (key_is_down(KEY_RIGHT)) { iso_dx += 1; player.facing = DIR_SE; }
-    if (key_is_down(KEY_LEFT))  { iso_dx -= 1; player.facing = DIR_NW; }
-    if (key_is_down(KEY_UP))    { iso_dy -= 1; player.facing = DIR_NE; }
-    if (key_is_down(KEY_DOWN))  { iso_dy += 1; player.facing = DIR_SW; }
-
-    if (iso_dx > 0 && iso_dy < 0) player.facing = DIR_NE;
-    if (iso_dx > 0 && iso_dy > 0) player.facing = DIR_SE;
-    if (iso_dx < 0 && iso_dy < 0) player.facing = DIR_NW;
-    if (iso_dx < 0 && iso_dy > 0) player.facing = DIR_SW;
-
-    // Jump (A button) — check if adjacent tile in facing direction is exactly 1 higher
-    if (key_hit(KEY_A)) {
-        // Determine adjacent tile in facing direction
-        int adj_col = player.tile_col;
-        int adj_row = player.tile_row;
-        switch (player.facing) {
-            case DIR_SE: adj_col++; break;
-            case DIR_NE: adj_row--; break;
-            case DIR_NW: adj_col--; break;
-            case DIR_SW: adj_row++; break;
-        }
-        MapCell *adj = get_map_cell(world_map, adj_col, adj_row);
-        if (adj && adj->height == player.height + 1) {
-            // Start jump: move player to adjacent tile
-            player.jumping = 1;
-            player.jump_timer = 0;
-            player.jump_visual_dy = 0;
-            player.tile_col = adj_col;
-            player.tile_row = adj_row;
-            player.height = adj->height;
-            int wx, wy;
-            iso_tile_to_world(adj_col, adj_row, &wx, &wy);
-            player.world_x = INT2FP(wx);
-            player.world_y = INT2FP(wy);
-        }
-    }
-
-    int dx = iso_dx * 2 - iso_dy * 2;
-    int dy = iso_dx * 1 + iso_dy * 1;
-    int spd = PLAYER_SPEED;
-
-    int new_wx, new_wy;
-    if (iso_dx != 0 && iso_dy != 0) {
-        new_wx = player.world_x + ((dx * spd) >> 1);
-        new_wy = player.world_y + ((dy * spd) >> 1);
-    } else {
-        new_wx = player.world_x + dx * spd;
-        new_wy = player.world_y + dy * spd;
-    }
-
-    // Clamp to world bounds
-    if (new_wx < bound_wx_min) new_wx = bound_wx_min;
-    if (new_wx > bound_wx_max) new_wx = bound_wx_max;
-    if (new_wy < bound_wy_min) new_wy = bound_wy_min;
-    if (new_wy > bound_wy_max) new_wy = bound_wy_max;
-
-    // Check collision at new position
-    if (dx != 0 || dy != 0) {
-        int new_col, new_row;
-        world_to_tile(FP2INT(new_wx), FP2INT(new_wy), &new_col, &new_row);
-
-        // Clamp tile coords
-        if (new_col < 0) new_col = 0;
-        if (new_col >= MAP_COLS) new_col = MAP_COLS - 1;
-        if (new_row < 0) new_row = 0;
-        if (new_row >= MAP_ROWS) new_row = MAP_ROWS - 1;
-
-        MapCell *dest = &world_map[new_row][new_col];
-
-        if (dest->height > player.height) {
-            // Wall collision — block movement
-            // Don't update position
-        } else if (dest->height < player.height) {
-            // Fall — allow movement, start fall animation
-            player.world_x = new_wx;
-            player.world_y = new_wy;
-            int old_tile_col = player.tile_col;
-            int old_tile_row = player.tile_row;
-            player.tile_col = new_col;
-            player.tile_row = new_row;
-
-            // Only trigger fall animation when changing tiles
-            if (new_col != old_tile_col || new_row != old_tile_row) {
-                player.falling = 1;
-                player.fall_timer = 0;
-                player.fall_visual_dy = 0;
-                player.fall_start_h = player.height;
-                player.fall_target_h = dest->height;
-                // height updates when fall completes
-            }
-        } else {
-            // Same height — allow
-            player.world_x = new_wx;
-            player.world_y = new_wy;
-            player.tile_col = new_col;
-            player.tile_row = new_row;
-        }
-    }
-
-    player.moving = (dx != 0 || dy != 0);
-    if (player.moving) {
-        player.frame_timer++;
-        if (player.frame_timer >= HERO_ANIM_SPEED) {
-            player.frame_timer = 0;
-            player.frame = (player.frame + 1) % HERO_WALK_FRAMES;
-        }
-    } else {
-        player.frame = 0;
-        player.frame_timer = 0;
-    }
-}
-
-static void player_draw(void) {
-    int sx, sy;
-    world_to_screen(FP2INT(player.world_x), FP2INT(player.world_y),
-                    FP2INT(camera.x), FP2INT(camera.y), &sx, &sy);
-
-    // Apply height offset: raise sprite by current height * SIDE_HEIGHT
-    int height_for_draw = player.height;
-    int extra_dy = 0;
-
-    if (player.falling) {
-        // During fall, interpolate: start at old height, end at new height
-        height_for_draw = player.fall_start_h;
-        extra_dy = player.fall_visual_dy;  // positive = moving down
-    }
-
-    sy -= height_for_draw * SIDE_HEIGHT;
-    sy += extra_dy;
-    sy += player.jump_visual_dy;  // negative during jump = moves up
-
-    sx -= PLAYER_SPR_W / 2;
-    sy -= PLAYER_SPR_H / 2;
-
-    int dir_row;
-    switch (player.facing) {
-        case DIR_SW: dir_row = 0; break;
-        case DIR_SE: dir_row = 1; break;
-        case DIR_NW: dir_row = 2; break;
-        case DIR_NE: dir_row = 3; break;
-        default:     dir_row = 0; break;
-    }
-    int tile_id = (dir_row * HERO_WALK_FRAMES + player.frame) * HERO_TILES_PER_FRAME;
-
-    // Occlusion: check if any tile in front of player (higher diag index) is taller
-    // Front tiles = tiles with higher (col+row) value and overlapping screen position
-    // Simple approach: check the tile directly "in front" (toward camera, +1 diag)
-    // If that tile's visual top is above the player, put sprite behind BG (prio 2)
-    int prio = 0;  // default: sprite in front of BG
-    int pcol = player.tile_col;
-    int prow = player.tile_row;
-
-    // Check tiles in the row in front (closer to camera = higher col+row)
-    // We check a few tiles at diag+1 and diag+2
-    for (int dd = 1; dd <= 2; dd++) {
-        for (int dr = -1; dr <= 1; dr++) {
-            int fc = pcol + dd - dr;  // keep col+row = diag + dd
-            int fr = prow + dr;
-            // Verify: fc + fr = pcol + prow + dd (should be in front)
-            // fc = pcol + dd - dr, fr = prow + dr → fc+fr = pcol+prow+dd ✓
-            MapCell *front = get_map_cell(world_map, fc, fr);
-            if (front && front->height > player.height) {
-                // This front tile is taller — check if it visually overlaps
-                int fwx, fwy;
-                iso_tile_to_world(fc, fr, &fwx, &fwy);
-                int ftop_y = fwy - front->height * SIDE_HEIGHT;
-                int player_wy = FP2INT(player.world_y) - player.height * SIDE_HEIGHT;
-                if (ftop_y <= player_wy + 8) {
-                    prio = 2;  // behind BG layer (BG is prio 1)
-                }
-            }
-        }
+        u16 c = hero_pal[i];
+        int r = c & 31, g = (c >> 5) & 31, b = (c >> 10) & 31;
+        pal_obj_mem[ENT_PAL_GUARD * 16 + i] = RGB15(b, g, r);
+        pal_obj_mem[ENT_PAL_SLIME * 16 + i] = RGB15(r, b, g);
     }
-
-    obj_buffer[0].attr0 = ATTR0_Y(sy & 0xFF) | ATTR0_SQUARE | ATTR0_4BPP;
-    obj_buffer[0].attr1 = ATTR1_X(sx & 0x1FF) | ATTR1_SIZE_32;
-    obj_buffer[0].attr2 = ATTR2_ID(tile_id) | ATTR2_PRIO(prio) | ATTR2_PALBANK(0);
+    memcpy16(&pal_obj_mem[PARTICLE_PALBANK * 16], asset_rom(ASSET_FX_PAL), 16);
 }
 
 //=============================================================================
-// Camera
+// VBlank: rewind the sound FIFO DMA first (it is fetching the buffer), then
+// commit the submitted frame (and a new zone's palette), count the frame,
+// and mix the next frame's audio last
 //=============================================================================
-static void camera_update(void) {
-    // Camera target includes height offset so the view follows the player vertically
-    int target_y = player.world_y - INT2FP(player.height * SIDE_HEIGHT);
-    camera.x += (player.world_x - camera.x) >> 3;
-    camera.y += (target_y - camera.y) >> 3;
-    if (camera.x < bound_wx_min) camera.x = bound_wx_min;
-    if (camera.x > bound_wx_max) camera.x = bound_wx_max;
-    // Don't clamp camera Y too aggressively — allow it to follow height
-    int cam_y_min = bound_wy_min - INT2FP(MAX_HEIGHT * SIDE_HEIGHT);
-    int cam_y_max = bound_wy_max;
-    if (camera.y < cam_y_min) camera.y = cam_y_min;
-    if (camera.y > cam_y_max) camera.y = cam_y_max;
+static void vblank_isr(void) {
+    sound_rewind();
+    present_commit();
+    asset_vblank();
+    timing_vblank();
+    sound_vblank();
 }
 
 //=============================================================================
@@ -821,23 +65,22 @@ static void camera_update(void) {
 //=============================================================================
 int main(void) {
     irq_init(NULL);
-    irq_add(II_VBLANK, NULL);
+    irq_add(II_VBLANK, vblank_isr);
+    irq_add(II_VCOUNT, NULL);      // late input sampling (present.c)
 
+    asset_init();
     setup_palette();
     generate_world();
     compute_world_bounds();
 
-    // Load hero sprite tiles
-    memcpy32(&tile_mem[4][0], hero_walkTiles, hero_walkTilesLen / 4);
-
     // === BOOT: build world tilemap via metatile compositing ===
     precompute_world();
 
-    // Upload tile dictionary to VRAM
+    // Upload tile dictionary to VRAM (BG set 0)
     upload_tiles_to_vram();
 
     // Set up Mode 0: BG0 (8bpp, 64×64) + OBJ
-    REG_BG0CNT = BG_CBB(TILE_CBB) | BG_SBB(TILE_SBB) | BG_8BPP | BG_SIZE3 | BG_PRIO(1);
+    REG_BG0CNT = stream_bg0cnt();
     REG_DISPCNT = DCNT_MODE0 | DCNT_BG0 | DCNT_OBJ | DCNT_OBJ_1D;
 
     oam_init(obj_buffer, 128);
@@ -848,36 +91,84 @@ int main(void) {
     // Initial hw tilemap load centered on camera
     int cam_wx = FP2INT(camera.x);
     int cam_wy = FP2INT(camera.y);
-    int init_tc = (cam_wx - WORLD_PX_X0) / 8;
-    int init_tr = (cam_wy - WORLD_PX_Y0) / 8;
-    loaded_col_min = init_tc - 32;
-    loaded_row_min = init_tr - 32;
-    if (loaded_col_min < 0) loaded_col_min = 0;
-    if (loaded_col_min > WORLD_TILE_W - 64) loaded_col_min = WORLD_TILE_W - 64;
-    if (loaded_row_min < 0) loaded_row_min = 0;
-    if (loaded_row_min > WORLD_TILE_H - 64) loaded_row_min = WORLD_TILE_H - 64;
-    load_hw_full();
+    stream_init(cam_wx, cam_wy);
+    entity_init();
+    sprite_init();
+    oammux_init();
+    objvram_init();
+    affine_init();
+    particle_init();
+    trigger_init();
+    script_init();
+    warp_init();
+    sound_init(SOUND_DEFAULT_CHANNELS, SOUND_DEFAULT_RATE);
+    sound_music(SONG_FIELD);
+    save_init();
+
+    // Input source: live keypad, SRAM recording, or the benchmark route.
+    // World gen reseeds per feature, so the runtime RNG starts here.
+    // Holding B at boot also turns on input-latency measurement.
+    key_poll();
+    rng_state = replay_boot();
+    // Continue from the save unless replaying or recording: its deltas go
+    // onto the generated world, then the camera and ring follow the player
+    if (replay_mode() == REPLAY_OFF && save_load()) {
+        camera.x = player.world_x;
+        camera.y = player.world_y;
+        stream_init(FP2INT(camera.x), FP2INT(camera.y));
+    }
+    present_init(key_is_down(KEY_B) != 0);
 
     // === MAIN LOOP ===
+    // Fixed timestep: one logic step per VBlank counted by the ISR. When a
+    // frame overruns, the missed steps run back-to-back and the render is
+    // skipped so game speed stays constant. Input is sampled late in the
+    // frame; scroll, BG0CNT and OAM are committed together by the VBlank
+    // ISR, so a zone transition swaps BG sets between two frames. The
+    // governor trims optional work when the frame budget gets tight.
+    timing_init();
+    gov_init();
     while (1) {
-        key_poll();
-        player_update();
-        camera_update();
-
+        int steps = timing_steps_due();
+        present_wait_input(steps == 1);
+        gov_begin_logic();
+        for (int i = 0; i < steps; i++) {
+            replay_poll();
+            present_note_input();
+            player_update();
+            trigger_update(player.tile_col, player.tile_row);
+            asset_update();
+            script_update();
+            warp_update();
+            save_update();
+            camera_update();
+            entity_update();
+            particle_update();
+        }
+        gov_end_logic(steps);
+        if (!timing_render_due())
+            continue;
+
+        present_begin();
         cam_wx = FP2INT(camera.x);
         cam_wy = FP2INT(camera.y);
 
+        warp_render();
         update_hw_tilemap(cam_wx, cam_wy);
+        u16 hofs, vofs;
+        stream_scroll(cam_wx, cam_wy, &hofs, &vofs);
 
-        int scroll_x = cam_wx - WORLD_PX_X0 - SCREEN_W / 2;
-        int scroll_y = cam_wy - WORLD_PX_Y0 - SCREEN_H / 2;
-        REG_BG0HOFS = scroll_x & 0x1FF;
-        REG_BG0VOFS = scroll_y & 0x1FF;
-
+        sprite_begin();
+        affine_begin();
         player_draw();
-
-        VBlankIntrWait();
-        oam_copy(oam_mem, obj_buffer, 2);
+        entity_draw();
+        particle_draw();
+        objvram_end_frame();
+        int oam_count = sprite_end();
+        int aff_count = affine_end(obj_buffer);
+        if (aff_count > oam_count) oam_count = aff_count;
+        present_submit(hofs, vofs, oam_count);
+        gov_end_render();
     }
 
     return 0;
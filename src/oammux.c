@@ -0,0 +1,218 @@
+// oammux.c — HBlank OAM multiplexing past 128 OBJs
+#include "oammux.h"
+#include "timing.h"
+#include <string.h>
+
+#define VDRAW_LINES   160
+#define MUX_MAX_OBJS  (MUX_OAM + MUX_MAX_WRITES)
+#define NO_OBJ        0xFFFF
+
+OamMuxStats oammux_stats;
+
+typedef struct {
+    u8 line;            // first HBlank allowed to write
+    u8 entry;
+    u8 deadline;        // last HBlank that still meets the OBJ's top line
+    u8 pad;
+    u16 attr0, attr1, attr2, pad2;
+} MuxWrite;
+
+// One frame's schedule: OAM at the top of the screen, then HBlank writes
+// in line order. The ISR reads `front`; sprite_end() builds `back`.
+typedef struct {
+    int active;
+    int count;
+    OBJ_ATTR init[MUX_OAM];
+    MuxWrite w[MUX_MAX_WRITES];
+} MuxQueue;
+
+static MuxQueue queues[2];
+static MuxQueue *front = &queues[0], *back = &queues[1];
+static volatile int cursor;
+static u32 frame_writes, frame_irqs;
+static u32 frame_cycles;            // measured handler cycles
+static int enabled;
+
+// OBJs queued for the frame being built, in depth order
+static int num_objs;
+static u16 obj_attr0[MUX_MAX_OBJS], obj_attr1[MUX_MAX_OBJS], obj_attr2[MUX_MAX_OBJS];
+static u8  obj_top[MUX_MAX_OBJS], obj_start[MUX_MAX_OBJS], obj_release[MUX_MAX_OBJS];
+static u8  obj_entry[MUX_MAX_OBJS];
+
+// Build scratch
+static u16 by_start[MUX_MAX_OBJS];
+static u16 start_count[VDRAW_LINES + 1];
+static u16 release_head[VDRAW_LINES], release_next[MUX_MAX_OBJS];
+static u8  free_entries[MUX_OAM];
+
+void oammux_init(void) {
+    memset(&oammux_stats, 0, sizeof(oammux_stats));
+    queues[0].active = queues[1].active = 0;
+    queues[0].count = queues[1].count = 0;
+    front = &queues[0];
+    back = &queues[1];
+    num_objs = 0;
+    enabled = 1;
+    irq_add(II_HBLANK, oammux_hblank);
+    REG_IE &= ~IRQ_HBLANK;
+}
+
+void oammux_set_enabled(int on) {
+    enabled = on;
+}
+
+int oammux_enabled(void) {
+    return enabled;
+}
+
+//=============================================================================
+// Main loop side
+//=============================================================================
+void oammux_begin(void) {
+    num_objs = 0;
+    back->active = 0;
+    back->count = 0;
+}
+
+int oammux_add(u16 attr0, u16 attr1, u16 attr2, int top, int bottom) {
+    if (num_objs == MUX_MAX_OBJS) {
+        oammux_stats.no_entry++;
+        return -1;
+    }
+    int i = num_objs++;
+    int release = bottom + MUX_MARGIN;
+    obj_attr0[i] = attr0;
+    obj_attr1[i] = attr1;
+    obj_attr2[i] = attr2;
+    obj_top[i] = (u8)top;
+    obj_start[i] = (u8)oammux_start_line(top);
+    obj_release[i] = (u8)(release < VDRAW_LINES ? release : VDRAW_LINES - 1);
+    return i;
+}
+
+int oammux_build(OBJ_ATTR *obj) {
+    int n = num_objs;
+
+    // Counting sort by start line; stable, so the top band keeps depth order
+    memset(start_count, 0, sizeof(start_count));
+    for (int i = 0; i < n; i++) start_count[obj_start[i] + 1]++;
+    for (int l = 0; l < VDRAW_LINES; l++) start_count[l + 1] += start_count[l];
+    for (int i = 0; i < n; i++) by_start[start_count[obj_start[i]]++] = (u16)i;
+
+    // Interval colouring: an entry frees up after its OBJ's release line.
+    // Admission kept every line at ≤ MUX_OAM live OBJs, so greedy by start
+    // never runs dry.
+    for (int e = 0; e < MUX_OAM; e++) free_entries[e] = (u8)(MUX_OAM - 1 - e);
+    int num_free = MUX_OAM;
+    for (int l = 0; l < VDRAW_LINES; l++) release_head[l] = NO_OBJ;
+    int released = 0;                    // release lines already handed back
+
+    MuxQueue *q = back;
+    int writes = 0;
+    for (int e = 0; e < MUX_OAM; e++) q->init[e].attr0 = ATTR0_HIDE;
+    for (int k = 0; k < n; k++) {
+        int i = by_start[k];
+        int start = obj_start[i];
+        for (; released < start; released++)
+            for (int r = release_head[released]; r != NO_OBJ; r = release_next[r])
+                free_entries[num_free++] = obj_entry[r];
+        if (num_free == 0 || (start && writes == MUX_MAX_WRITES)) {
+            obj_entry[i] = 0xFF;
+            oammux_stats.no_entry++;
+            continue;
+        }
+        int e = free_entries[--num_free];
+        obj_entry[i] = (u8)e;
+        release_next[i] = release_head[obj_release[i]];
+        release_head[obj_release[i]] = (u16)i;
+        if (start == 0) {
+            q->init[e].attr0 = obj_attr0[i];
+            q->init[e].attr1 = obj_attr1[i];
+            q->init[e].attr2 = obj_attr2[i];
+            continue;
+        }
+        MuxWrite *w = &q->w[writes++];
+        w->line = (u8)start;
+        w->entry = (u8)e;
+        w->deadline = (u8)(obj_top[i] - MUX_MARGIN - 1);
+        w->attr0 = obj_attr0[i];
+        w->attr1 = obj_attr1[i];
+        w->attr2 = obj_attr2[i];
+    }
+    q->count = writes;
+    q->active = 1;
+    memcpy32(obj, q->init, sizeof(q->init) / 4);
+    oammux_stats.objs = n;
+    return MUX_OAM;
+}
+
+int oammux_entry(int i) {
+    if (i < 0 || i >= num_objs || obj_entry[i] == 0xFF) return -1;
+    return obj_entry[i];
+}
+
+//=============================================================================
+// Interrupt side
+//=============================================================================
+void oammux_vblank(int fresh) {
+    OamMuxStats *ms = &oammux_stats;
+    if (front->active) {
+        ms->writes = frame_writes;
+        ms->irqs = frame_irqs;
+        u32 body = frame_cycles;
+        if (!body) body = frame_writes * MUX_WRITE_CYCLES;   // host build
+        ms->cycles = frame_irqs * MUX_IRQ_CYCLES + body;
+        if (ms->cycles > ms->cycles_peak) ms->cycles_peak = ms->cycles;
+    }
+    if (fresh) {
+        // obj_buffer (= the new front's init) was just copied to OAM
+        MuxQueue *t = front;
+        front = back;
+        back = t;
+    } else if (front->active) {
+        // Same frame again: undo last frame's HBlank writes, leaving the
+        // affine matrices (affine.h) in the spare halfwords alone
+        for (int e = 0; e < MUX_OAM; e++) {
+            oam_mem[e].attr0 = front->init[e].attr0;
+            oam_mem[e].attr1 = front->init[e].attr1;
+            oam_mem[e].attr2 = front->init[e].attr2;
+        }
+    }
+    frame_writes = frame_irqs = frame_cycles = 0;
+    cursor = 0;
+    if (front->active && front->count) {
+        ms->frames++;
+        REG_DISPCNT |= DCNT_OAM_HBL;
+        REG_IE |= IRQ_HBLANK;
+    } else {
+        if (front->active) ms->frames++;
+        REG_IE &= ~IRQ_HBLANK;
+        REG_DISPCNT &= ~DCNT_OAM_HBL;
+    }
+}
+
+IWRAM_CODE void oammux_hblank(void) {
+    u32 t0 = timing_cycles();
+    int vc = REG_VCOUNT;
+    frame_irqs++;
+    if (vc >= VDRAW_LINES) {
+        frame_cycles += timing_cycles() - t0;
+        return;
+    }
+    const MuxQueue *q = front;
+    int k = cursor, n = 0;
+    while (k < q->count && n < MUX_PER_HBLANK && q->w[k].line <= vc) {
+        const MuxWrite *w = &q->w[k];
+        if (vc > w->deadline) oammux_stats.late++;
+        OBJ_ATTR *o = &oam_mem[w->entry];
+        o->attr0 = w->attr0;
+        o->attr1 = w->attr1;
+        o->attr2 = w->attr2;
+        k++;
+        n++;
+    }
+    cursor = k;
+    frame_writes += n;
+    if (k == q->count) REG_IE &= ~IRQ_HBLANK;
+    frame_cycles += timing_cycles() - t0;
+}
@@ -0,0 +1,102 @@
+// objvram.c — Per-actor OBJ VRAM slots with streamed animation frames
+#include "objvram.h"
+#include <string.h>
+
+ObjVramStats objvram_stats;
+
+static u8 owner_slot[256];                   // slot per owner id
+static u8 slot_owner[OBJ_SLOTS];             // owner per slot
+static const void *slot_frame[OBJ_SLOTS];    // frame shown (or queued) in the slot
+static u8 slot_tiles[OBJ_SLOTS];             // and its tile count
+static u8 slot_seen[OBJ_SLOTS];              // requested this frame
+static u8 free_slots[OBJ_SLOTS];
+static int num_free;
+
+// Upload queue: one entry per slot, latest frame wins
+static const void *pending[OBJ_SLOTS];
+static u8 pending_list[OBJ_SLOTS];
+static int num_pending;
+static u32 frame_uploads;
+
+void objvram_init(void) {
+    memset(&objvram_stats, 0, sizeof(objvram_stats));
+    memset(owner_slot, OBJ_NO_SLOT, sizeof(owner_slot));
+    memset(slot_seen, 0, sizeof(slot_seen));
+    memset(pending, 0, sizeof(pending));
+    num_pending = 0;
+    frame_uploads = 0;
+    // Hand out low slots first so VRAM use stays compact
+    for (int i = 0; i < OBJ_SLOTS; i++) {
+        free_slots[i] = OBJ_SLOTS - 1 - i;
+        slot_owner[i] = OBJ_NO_SLOT;
+        slot_frame[i] = 0;
+    }
+    num_free = OBJ_SLOTS;
+}
+
+int objvram_frame(int owner, const void *frame, int tiles) {
+    int s = owner_slot[owner];
+    if (s == OBJ_NO_SLOT) {
+        if (num_free == 0) {
+            objvram_stats.full++;
+            return -1;
+        }
+        s = free_slots[--num_free];
+        owner_slot[owner] = s;
+        slot_owner[s] = owner;
+        slot_frame[s] = 0;
+    }
+    slot_seen[s] = 1;
+    if (slot_frame[s] != frame || slot_tiles[s] != tiles) {
+        slot_frame[s] = frame;
+        slot_tiles[s] = (u8)tiles;
+        if (!pending[s]) pending_list[num_pending++] = s;
+        pending[s] = frame;
+        frame_uploads++;
+    }
+    return s * OBJ_SLOT_TILES;
+}
+
+void objvram_end_frame(void) {
+    u32 used = 0;
+    for (int s = 0; s < OBJ_SLOTS; s++) {
+        if (slot_owner[s] == OBJ_NO_SLOT) continue;
+        if (slot_seen[s]) {
+            slot_seen[s] = 0;
+            used++;
+            continue;
+        }
+        // Not drawn: give the slot back. A queued upload may still land in
+        // it; whoever takes the slot next queues its own frame over it.
+        owner_slot[slot_owner[s]] = OBJ_NO_SLOT;
+        slot_owner[s] = OBJ_NO_SLOT;
+        free_slots[num_free++] = s;
+    }
+    ObjVramStats *os = &objvram_stats;
+    os->used = used;
+    if (used > os->peak) os->peak = used;
+    os->uploads = frame_uploads;
+    os->uploads_total += frame_uploads;
+    frame_uploads = 0;
+}
+
+void objvram_commit(void) {
+    for (int k = 0; k < num_pending; k++) {
+        int s = pending_list[k];
+        u32 bytes = slot_tiles[s] * 32;
+        if (bytes)      // a zero-length DMA would copy 64 KB
+            dma3_cpy(&tile_mem[4][s * OBJ_SLOT_TILES], pending[s], bytes);
+        pending[s] = 0;
+        objvram_stats.bytes_total += bytes;
+    }
+    num_pending = 0;
+}
+
+int objvram_verify(void) {
+    int bad = 0;
+    for (int s = 0; s < OBJ_SLOTS; s++) {
+        if (slot_owner[s] == OBJ_NO_SLOT || pending[s] || !slot_frame[s]) continue;
+        bad += memcmp(&tile_mem[4][s * OBJ_SLOT_TILES], slot_frame[s], slot_tiles[s] * 32) != 0;
+    }
+    return bad;
+}
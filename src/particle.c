@@ -0,0 +1,259 @@
+// particle.c — Pooled particles and effects
+#include "particle.h"
+#include "affine.h"
+#include "sprite.h"
+#include "objvram.h"
+#include "player.h"
+#include "world.h"
+#include "asset.h"
+#include "timing.h"
+#include "../data/fx.h"
+#include "../data/archive.h"
+#include <string.h>
+
+ParticlePool parts EWRAM_BSS;
+ParticleStats particle_stats;
+int particle_high_water;
+int particle_cap = PARTICLE_MAX;
+
+static int free_head;
+static u32 update_cycles;       // latest particle_update()
+
+// Private xorshift: effects must not disturb the game RNG (replays)
+static u32 fx_rng = 1;
+static u32 fx_next(void) {
+    fx_rng ^= fx_rng << 13;
+    fx_rng ^= fx_rng >> 17;
+    fx_rng ^= fx_rng << 5;
+    return fx_rng;
+}
+
+// Kind flags
+#define PK_AFFINE   0x01    // turned/zoomed through a shared matrix
+#define PK_DOUBLE   0x02    // affine double-size box (room to zoom and turn)
+#define PK_KEPT     0x04    // ignores particle_cap, drawn as an attack
+#define PK_FACING   0x08    // turned to the spawner's facing
+
+typedef struct {
+    u8  tile, frames, frame_tiles;  // graphics in data/fx.h
+    u8  size;                       // pixels, square
+    u16 attr0, attr1;               // OBJ shape and size
+    u8  flags;                      // PK_*
+    u8  count;                      // particles per effect
+    u8  life, life_rand;            // steps
+    s8  gravity;                    // 12.4 per step
+    s8  spin;                       // AFFINE_TURN units per step
+    s8  zoom;                       // scale change per step, 8.8
+    u8  speed;                      // outward speed, 1/64 px per step
+    u8  rise, rise_rand;            // initial climb, 12.4 per step
+    u8  z0;                         // spawn height, pixels
+} FxKind;
+
+static const FxKind fx_kinds[NUM_FX] = {
+    [FX_SLASH]  = { FX_TILE_SLASH, FX_SLASH_FRAMES, 16, 32, ATTR0_SQUARE, ATTR1_SIZE_32,
+                    PK_AFFINE | PK_DOUBLE | PK_KEPT | PK_FACING,
+                    1, 16, 0, 0, 0, 4, 0, 0, 0, 10 },
+    [FX_SPARKS] = { FX_TILE_SPARK, FX_SPARK_FRAMES, 1, 8, ATTR0_SQUARE, ATTR1_SIZE_8,
+                    PK_AFFINE, 8, 14, 8, 4, 16, -10, 96, 24, 24, 12 },
+    [FX_DUST]   = { FX_TILE_DUST, FX_DUST_FRAMES, 1, 8, ATTR0_SQUARE, ATTR1_SIZE_8,
+                    PK_AFFINE, 6, 24, 8, 0, 0, -6, 32, 4, 4, 0 },
+    [FX_SPLASH] = { FX_TILE_DROP, FX_DROP_FRAMES, 1, 8, ATTR0_SQUARE, ATTR1_SIZE_8,
+                    0, 10, 40, 0, 6, 0, 0, 48, 40, 24, 0 },
+};
+
+//=============================================================================
+// Pool
+//=============================================================================
+void particle_init(void) {
+    memset(&parts, 0, sizeof(parts));
+    memset(&particle_stats, 0, sizeof(particle_stats));
+    for (int i = 0; i < PARTICLE_MAX; i++)
+        parts.next_free[i] = (i + 1 < PARTICLE_MAX) ? i + 1 : PARTICLE_NONE;
+    free_head = 0;
+    particle_high_water = 0;
+    fx_rng = 1;
+    asset_load(ASSET_FX_TILES, &tile_mem[4][OBJ_FX_TILE0], ASSET_TO_VRAM);
+}
+
+static int particle_alloc(void) {
+    if (free_head == PARTICLE_NONE) return -1;
+    int i = free_head;
+    free_head = parts.next_free[i];
+    if (i >= particle_high_water) particle_high_water = i + 1;
+    if (++particle_stats.live > particle_stats.peak) particle_stats.peak = particle_stats.live;
+    return i;
+}
+
+static void particle_free(int i) {
+    int e = parts.effect[i];
+    if (--parts.fx_live[e] == 0) particle_stats.effects--;
+    parts.kind[i] = FX_NONE;
+    parts.next_free[i] = (u16)free_head;
+    free_head = i;
+    particle_stats.live--;
+    while (particle_high_water > 0 && parts.kind[particle_high_water - 1] == FX_NONE)
+        particle_high_water--;
+}
+
+// Kept effects take the low slots, which map onto attack sprite ids
+static int effect_alloc(int kept) {
+    int lo = kept ? 0 : PARTICLE_KEPT_EFFECTS;
+    int hi = kept ? PARTICLE_KEPT_EFFECTS : PARTICLE_EFFECTS;
+    for (int e = lo; e < hi; e++)
+        if (!parts.fx_live[e]) return e;
+    return -1;
+}
+
+int particle_effect(int kind, int col, int row, int height, int dir) {
+    const FxKind *k = &fx_kinds[kind];
+    ParticleStats *ps = &particle_stats;
+    int n = k->count;
+    if (!(k->flags & PK_KEPT)) {
+        int room = particle_cap - (int)ps->live;
+        if (room < 0) room = 0;
+        if (room < n) {
+            ps->refused += n - room;
+            n = room;
+        }
+        if (n == 0) return 0;
+    }
+    int e = effect_alloc(k->flags & PK_KEPT);
+    if (e < 0) {
+        ps->effects_full++;
+        return 0;
+    }
+
+    int wx, wy;
+    iso_tile_to_world(col, row, &wx, &wy);
+    parts.fx_key[e] = SPRITE_KEY(col, row, height);
+    parts.fx_prio[e] = (u8)sprite_bg_prio(col, row, height, wy);
+    parts.fx_lift[e] = (u8)(height * SIDE_HEIGHT);
+    parts.fx_angle[e] = (k->flags & PK_FACING) ? (u8)(dir * (AFFINE_TURN / 4)) : 0;
+
+    // Spread evenly around the spawn point, jittered; world y is half scale
+    int spawned = 0;
+    for (int q = 0; q < n; q++) {
+        int i = particle_alloc();
+        if (i < 0) {
+            ps->refused += n - q;
+            break;
+        }
+        int a = q * AFFINE_TURN / n + (fx_next() & 15);
+        int v = k->speed * 4;
+        parts.x[i] = INT2FP(wx);
+        parts.y[i] = INT2FP(wy);
+        parts.vx[i] = (s16)(affine_cos(a) * v >> 12);
+        parts.vy[i] = (s16)(affine_sin(a) * v >> 13);
+        parts.z[i] = (s16)(k->z0 << 4);
+        parts.vz[i] = (s16)(k->rise + (k->rise_rand ? fx_next() % k->rise_rand : 0));
+        parts.life[i] = (u8)(k->life + (k->life_rand ? fx_next() % k->life_rand : 0));
+        parts.age[i] = 0;
+        parts.kind[i] = (u8)kind;
+        parts.effect[i] = (u8)e;
+        spawned++;
+    }
+    if (spawned) ps->effects++;
+    parts.fx_live[e] = (u8)spawned;
+    ps->spawned += spawned;
+    return spawned;
+}
+
+//=============================================================================
+// Motion
+//=============================================================================
+void particle_update(void) {
+    u32 t0 = timing_cycles();
+    int slots = particle_high_water, moved = 0;
+    for (int i = 0; i < particle_high_water; i++) {
+        int kind = parts.kind[i];
+        if (kind == FX_NONE) continue;
+        moved++;
+        if (++parts.age[i] >= parts.life[i]) {
+            particle_free(i);
+            continue;
+        }
+        parts.x[i] += parts.vx[i];
+        parts.y[i] += parts.vy[i];
+        parts.vz[i] -= fx_kinds[kind].gravity;
+        int z = parts.z[i] + parts.vz[i];
+        if (z < 0) {                    // landed
+            particle_free(i);
+            continue;
+        }
+        parts.z[i] = (s16)z;
+    }
+    update_cycles = timing_cycles() - t0;
+    if (!update_cycles)     // host build: the timers do not run
+        update_cycles = slots * PARTICLE_SLOT_CYCLES + moved * PARTICLE_MOVE_CYCLES;
+}
+
+//=============================================================================
+// Drawing: one OBJ batch per effect
+//=============================================================================
+static OBJ_ATTR batch[PARTICLE_MAX] EWRAM_BSS;
+
+void particle_draw(void) {
+    u32 t0 = timing_cycles();
+    int cam_x = FP2INT(camera.x), cam_y = FP2INT(camera.y);
+    u16 base[PARTICLE_EFFECTS];
+    u8 count[PARTICLE_EFFECTS];
+    int b = 0;
+    for (int e = 0; e < PARTICLE_EFFECTS; e++) {
+        base[e] = (u16)b;
+        count[e] = 0;
+        b += parts.fx_live[e];
+    }
+
+    u32 objs = 0, flat = 0;
+    for (int i = 0; i < particle_high_water; i++) {
+        int kind = parts.kind[i];
+        if (kind == FX_NONE) continue;
+        const FxKind *k = &fx_kinds[kind];
+        int e = parts.effect[i];
+        int sx, sy;
+        world_to_screen(FP2INT(parts.x[i]), FP2INT(parts.y[i]), cam_x, cam_y, &sx, &sy);
+        sy -= parts.fx_lift[e] + (parts.z[i] >> 4);
+        int reach = (k->flags & PK_DOUBLE) ? k->size : k->size / 2;
+        if (sx + reach <= 0 || sx - reach >= SCREEN_W || sy + reach <= 0 || sy - reach >= SCREEN_H)
+            continue;
+
+        int age = parts.age[i];
+        int frame = age * k->frames / parts.life[i];
+        u16 a0 = k->attr0 | ATTR0_4BPP, a1 = k->attr1;
+        int half = k->size / 2;
+        if (k->flags & PK_AFFINE) {
+            // Quantized so particles of one burst share a matrix
+            int angle = (parts.fx_angle[e] + k->spin * age) & 0xF0;
+            int scale = AFFINE_ONE + k->zoom * age;
+            if (scale < AFFINE_ONE / 4) scale = AFFINE_ONE / 4;
+            int m = affine_get(angle, scale & ~15);
+            if (m >= 0) {
+                a0 |= (k->flags & PK_DOUBLE) ? ATTR0_AFF_DBL : ATTR0_AFF;
+                a1 |= ATTR1_AFF_ID(m);
+                half = reach;
+            } else {
+                flat++;
+            }
+        }
+        OBJ_ATTR *o = &batch[base[e] + count[e]++];
+        o->attr0 = a0 | ATTR0_Y((sy - half) & 0xFF);
+        o->attr1 = a1 | ATTR1_X((sx - half) & 0x1FF);
+        o->attr2 = ATTR2_ID(OBJ_FX_TILE0 + k->tile + frame * k->frame_tiles) |
+                   ATTR2_PRIO(parts.fx_prio[e]) | ATTR2_PALBANK(PARTICLE_PALBANK);
+        objs++;
+    }
+
+    for (int e = 0; e < PARTICLE_EFFECTS; e++) {
+        if (!count[e]) continue;
+        int id = e < PARTICLE_KEPT_EFFECTS ? SPRITE_ID_ATTACK + e : SPRITE_ID_FX + e;
+        sprite_add_objs(id, parts.fx_key[e], &batch[base[e]], count[e]);
+    }
+    ParticleStats *ps = &particle_stats;
+    ps->objs = objs;
+    ps->flat = flat;
+    u32 cycles = timing_cycles() - t0;
+    if (!cycles)            // host build: the timers do not run
+        cycles = particle_high_water * PARTICLE_SLOT_CYCLES + objs * PARTICLE_OBJ_CYCLES;
+    ps->cycles = update_cycles + cycles;
+    if (ps->cycles > ps->cycles_peak) ps->cycles_peak = ps->cycles;
+}
@@ -0,0 +1,303 @@
+// player.c — Player movement, collision, sprite and camera
+#include "player.h"
+#include "world.h"
+#include "sprite.h"
+#include "objvram.h"
+#include "entity.h"
+#include "broadphase.h"
+#include "particle.h"
+#include "sound.h"
+#include "../data/anim_hero.h"
+#include "../data/sounds.h"
+
+OBJ_ATTR obj_buffer[128];
+Player player;
+Camera camera;
+
+
+// World bounds for player clamping (fixed-point)
+int bound_wx_min, bound_wx_max;
+int bound_wy_min, bound_wy_max;
+
+// Steps until the sword can swing again (kept out of Player: effects only)
+static u8 attack_cooldown;
+
+//=============================================================================
+// Player
+//=============================================================================
+void compute_world_bounds(void) {
+    int margin = 16;
+    bound_wx_min = INT2FP(WORLD_WX_MIN + margin);
+    bound_wx_max = INT2FP(WORLD_WX_MAX - margin);
+    bound_wy_min = INT2FP(WORLD_WY_MIN + margin);
+    bound_wy_max = INT2FP(WORLD_WY_MAX - margin);
+}
+
+void player_init(void) {
+    int wx, wy;
+    iso_tile_to_world(3, 8, &wx, &wy);
+    player.world_x = INT2FP(wx);
+    player.world_y = INT2FP(wy);
+    player.facing = DIR_SE;
+    player.frame = 0;
+    player.frame_timer = 0;
+    player.moving = 0;
+    player.tile_col = 3;
+    player.tile_row = 8;
+    player.height = world_map[8][3].height;
+    player.jumping = 0;
+    player.jump_timer = 0;
+    player.jump_visual_dy = 0;
+    player.falling = 0;
+    player.fall_timer = 0;
+    player.fall_visual_dy = 0;
+    attack_cooldown = 0;
+}
+
+static void facing_tile(int *col, int *row) {
+    *col = player.tile_col;
+    *row = player.tile_row;
+    switch (player.facing) {
+        case DIR_SE: (*col)++; break;
+        case DIR_NE: (*row)--; break;
+        case DIR_NW: (*col)--; break;
+        case DIR_SW: (*row)++; break;
+    }
+}
+
+// Sword swing (B): a slash over the faced tile; the hitbox is that tile at
+// the player's height, and sparks fly if it catches an enemy or a wall
+static void player_attack(void) {
+    int col, row;
+    facing_tile(&col, &row);
+    MapCell *cell = get_map_cell(world_map, col, row);
+    if (!cell) return;
+    attack_cooldown = PLAYER_ATTACK_STEPS;
+    particle_effect(FX_SLASH, col, row, player.height, player.facing);
+    sound_sfx(SFX_SLASH);
+    if (cell->height > player.height ||
+        broadphase_tile(col, row, player.height, ENT_WALKERS, -1, 0, 0)) {
+        particle_effect(FX_SPARKS, col, row, player.height, player.facing);
+        sound_sfx(SFX_HIT);
+    }
+}
+
+// Landing or wading: splash on water, dust elsewhere
+static void player_touchdown(int landed) {
+    MapCell *cell = &world_map[player.tile_row][player.tile_col];
+    if (cell->ground == GROUND_WATER) {
+        particle_effect(FX_SPLASH, player.tile_col, player.tile_row, player.height, 0);
+        sound_sfx(SFX_SPLASH);
+    } else if (landed) {
+        particle_effect(FX_DUST, player.tile_col, player.tile_row, player.height, 0);
+        sound_sfx(SFX_LAND);
+    }
+}
+
+void player_update(void) {
+    if (attack_cooldown) attack_cooldown--;
+
+    // Update jump animation
+    if (player.jumping) {
+        player.jump_timer++;
+        // Parabolic arc: peaks at JUMP_DURATION/2
+        int half = JUMP_DURATION / 2;
+        int t = player.jump_timer;
+        if (t <= half) {
+            player.jump_visual_dy = -(JUMP_PEAK_H * t / half);
+        } else {
+            player.jump_visual_dy = -(JUMP_PEAK_H * (JUMP_DURATION - t) / half);
+        }
+        if (player.jump_timer >= JUMP_DURATION) {
+            player.jumping = 0;
+            player.jump_timer = 0;
+            player.jump_visual_dy = 0;
+        }
+        // Don't allow movement during jump
+        return;
+    }
+
+    // Update fall animation
+    if (player.falling) {
+        int height_diff = player.fall_start_h - player.fall_target_h;
+        int total_fall_px = height_diff * SIDE_HEIGHT;
+        player.fall_timer++;
+        player.fall_visual_dy = player.fall_timer * FALL_SPEED;
+        if (player.fall_visual_dy >= total_fall_px) {
+            player.fall_visual_dy = 0;
+            player.falling = 0;
+            player.fall_timer = 0;
+            player.height = player.fall_target_h;
+            player_touchdown(1);
+        }
+        // Don't allow movement during fall
+        return;
+    }
+
+    int iso_dx = 0, iso_dy = 0;
+    if (key_is_down(KEY_RIGHT)) { iso_dx += 1; player.facing = DIR_SE; }
+    if (key_is_down(KEY_LEFT))  { iso_dx -= 1; player.facing = DIR_NW; }
+    if (key_is_down(KEY_UP))    { iso_dy -= 1; player.facing = DIR_NE; }
+    if (key_is_down(KEY_DOWN))  { iso_dy += 1; player.facing = DIR_SW; }
+
+    if (iso_dx > 0 && iso_dy < 0) player.facing = DIR_NE;
+    if (iso_dx > 0 && iso_dy > 0) player.facing = DIR_SE;
+    if (iso_dx < 0 && iso_dy < 0) player.facing = DIR_NW;
+    if (iso_dx < 0 && iso_dy > 0) player.facing = DIR_SW;
+
+    // Jump (A button) — check if adjacent tile in facing direction is exactly 1 higher
+    if (key_hit(KEY_A)) {
+        int adj_col, adj_row;
+        facing_tile(&adj_col, &adj_row);
+        MapCell *adj = get_map_cell(world_map, adj_col, adj_row);
+        if (adj && adj->height == player.height + 1) {
+            // Start jump: move player to adjacent tile
+            player.jumping = 1;
+            player.jump_timer = 0;
+            player.jump_visual_dy = 0;
+            sound_sfx(SFX_JUMP);
+            player.tile_col = adj_col;
+            player.tile_row = adj_row;
+            player.height = adj->height;
+            int wx, wy;
+            iso_tile_to_world(adj_col, adj_row, &wx, &wy);
+            player.world_x = INT2FP(wx);
+            player.world_y = INT2FP(wy);
+        }
+    }
+
+    if (key_hit(KEY_B) && !attack_cooldown)
+        player_attack();
+
+    int dx = iso_dx * 2 - iso_dy * 2;
+    int dy = iso_dx * 1 + iso_dy * 1;
+    int spd = PLAYER_SPEED;
+
+    int new_wx, new_wy;
+    if (iso_dx != 0 && iso_dy != 0) {
+        new_wx = player.world_x + ((dx * spd) >> 1);
+        new_wy = player.world_y + ((dy * spd) >> 1);
+    } else {
+        new_wx = player.world_x + dx * spd;
+        new_wy = player.world_y + dy * spd;
+    }
+
+    // Clamp to world bounds
+    if (new_wx < bound_wx_min) new_wx = bound_wx_min;
+    if (new_wx > bound_wx_max) new_wx = bound_wx_max;
+    if (new_wy < bound_wy_min) new_wy = bound_wy_min;
+    if (new_wy > bound_wy_max) new_wy = bound_wy_max;
+
+    // Check collision at new position
+    if (dx != 0 || dy != 0) {
+        int new_col, new_row;
+        world_to_tile(FP2INT(new_wx), FP2INT(new_wy), &new_col, &new_row);
+
+        // Clamp tile coords
+        if (new_col < 0) new_col = 0;
+        if (new_col >= MAP_COLS) new_col = MAP_COLS - 1;
+        if (new_row < 0) new_row = 0;
+        if (new_row >= MAP_ROWS) new_row = MAP_ROWS - 1;
+
+        MapCell *dest = &world_map[new_row][new_col];
+
+        if (dest->height > player.height) {
+            // Wall collision — block movement
+            // Don't update position
+        } else if (dest->height < player.height) {
+            // Fall — allow movement, start fall animation
+            player.world_x = new_wx;
+            player.world_y = new_wy;
+            int old_tile_col = player.tile_col;
+            int old_tile_row = player.tile_row;
+            player.tile_col = new_col;
+            player.tile_row = new_row;
+
+            // Only trigger fall animation when changing tiles
+            if (new_col != old_tile_col || new_row != old_tile_row) {
+                player.falling = 1;
+                player.fall_timer = 0;
+                player.fall_visual_dy = 0;
+                player.fall_start_h = player.height;
+                player.fall_target_h = dest->height;
+                // height updates when fall completes
+            }
+        } else {
+            // Same height — allow
+            int stepped = new_col != player.tile_col || new_row != player.tile_row;
+            player.world_x = new_wx;
+            player.world_y = new_wy;
+            player.tile_col = new_col;
+            player.tile_row = new_row;
+            if (stepped) player_touchdown(0);
+        }
+    }
+
+    player.moving = (dx != 0 || dy != 0);
+    if (player.moving) {
+        u8 pos = player.frame, timer = player.frame_timer;
+        anim_step(&anim_hero, HERO_ANIM_WALK, &pos, &timer);
+        player.frame = pos;
+        player.frame_timer = timer;
+    } else {
+        player.frame = 0;
+        player.frame_timer = 0;
+    }
+}
+
+void player_draw(void) {
+    int sx, sy;
+    world_to_screen(FP2INT(player.world_x), FP2INT(player.world_y),
+                    FP2INT(camera.x), FP2INT(camera.y), &sx, &sy);
+
+    // Apply height offset: raise sprite by current height * SIDE_HEIGHT
+    int height_for_draw = player.height;
+    int extra_dy = 0;
+
+    if (player.falling) {
+        // During fall, interpolate: start at old height, end at new height
+        height_for_draw = player.fall_start_h;
+        extra_dy = player.fall_visual_dy;  // positive = moving down
+    }
+
+    sy -= height_for_draw * SIDE_HEIGHT;
+    sy += extra_dy;
+    sy += player.jump_visual_dy;  // negative during jump = moves up
+
+    sx -= PLAYER_SPR_W / 2;
+    sy -= PLAYER_SPR_H / 2;
+
+    u16 flip;
+    int seq = player.moving ? HERO_ANIM_WALK : HERO_ANIM_IDLE;
+    const MetaCell *cell = anim_cell(&anim_hero, seq, player.frame, player.facing, &flip);
+    int tile_id = objvram_frame(SPRITE_ID_PLAYER, anim_cell_tiles(&anim_hero, cell),
+                                cell->num_tiles);
+    if (tile_id < 0) return;
+
+    // Occlusion: behind BG0 when a taller cell just in front covers the feet
+    int prio = sprite_bg_prio(player.tile_col, player.tile_row, player.height,
+                              FP2INT(player.world_y));
+
+    sprite_add_meta(SPRITE_ID_PLAYER,
+                    SPRITE_KEY(player.tile_col, player.tile_row, height_for_draw),
+                    sx, sy, ATTR0_4BPP, flip,
+                    ATTR2_ID(tile_id) | ATTR2_PRIO(prio) | ATTR2_PALBANK(0),
+                    anim_cell_pieces(&anim_hero, cell), cell->num_pieces);
+}
+
+//=============================================================================
+// Camera
+//=============================================================================
+void camera_update(void) {
+    // Camera target includes height offset so the view follows the player vertically
+    int target_y = player.world_y - INT2FP(player.height * SIDE_HEIGHT);
+    camera.x += (player.world_x - camera.x) >> 3;
+    camera.y += (target_y - camera.y) >> 3;
+    if (camera.x < bound_wx_min) camera.x = bound_wx_min;
+    if (camera.x > bound_wx_max) camera.x = bound_wx_max;
+    // Don't clamp camera Y too aggressively — allow it to follow height
+    int cam_y_min = bound_wy_min - INT2FP(MAX_HEIGHT * SIDE_HEIGHT);
+    int cam_y_max = bound_wy_max;
+    if (camera.y < cam_y_min) camera.y = cam_y_min;
+    if (camera.y > cam_y_max) camera.y = cam_y_max;
+}
@@ -0,0 +1,154 @@
+// present.c — Late input sampling and atomic VBlank commit
+#include "present.h"
+#include "player.h"
+#include "timing.h"
+#include "sprite.h"
+#include "objvram.h"
+#include "oammux.h"
+#include <string.h>
+
+#define FRAME_LINES  228
+#define VDRAW_LINES  160
+
+LatencyStats latency_stats;
+int present_input_line;
+int present_wait_lines;
+
+// Submitted frame, read by the ISR only while `ready` is set
+static volatile int ready;
+static u16 shadow_hofs, shadow_vofs;
+static int shadow_oam_count;
+static u16 shadow_bg0cnt, shadow_mosaic, shadow_bldcnt, shadow_bldy;
+
+// Cost model: scanlines from input sample to submit, max over recent frames
+static int wake_line;
+static int cost_lines;
+
+// Latency measurement
+static int measure;
+static int pending;
+static u32 edge_frame;
+static u32 shown_hash;          // scroll + player OAM entry of the last commit
+static u32 edge_hash;            // shown_hash at the key edge
+
+void present_init(int measure_latency) {
+    memset(&latency_stats, 0, sizeof(latency_stats));
+    latency_stats.min = 0xFFFFFFFF;
+    measure = measure_latency;
+    pending = 0;
+    ready = 0;
+    shadow_bg0cnt = REG_BG0CNT;      // as set up at boot
+    shadow_mosaic = shadow_bldcnt = shadow_bldy = 0;
+    cost_lines = VDRAW_LINES;     // no estimate yet: sample right after VBlank
+    shown_hash = 0;
+    present_input_line = 0;
+    present_wait_lines = 0;
+}
+
+//=============================================================================
+// VBlank side
+//=============================================================================
+// What the player can see react to input: the scroll and the player's own
+// sprite (actors animate on their own, so the rest of OAM is left out)
+static u32 hash_shown(void) {
+    u32 h = (u32)shadow_hofs << 16 | shadow_vofs;
+    int slot = sprite_slot(SPRITE_ID_PLAYER);
+    if (slot >= 0) {
+        const OBJ_ATTR *o = &obj_buffer[slot];
+        h = (h ^ ((u32)o->attr0 << 16 | o->attr1)) * 0x01000193;
+        h = (h ^ o->attr2) * 0x01000193;
+    }
+    return h;
+}
+
+void present_commit(void) {
+    if (!ready) {
+        oammux_vblank(0);     // showing the same frame again
+        return;
+    }
+    REG_BG0HOFS = shadow_hofs;
+    REG_BG0VOFS = shadow_vofs;
+    REG_BG0CNT = shadow_bg0cnt;
+    REG_MOSAIC = shadow_mosaic;
+    REG_BLDCNT = shadow_bldcnt;
+    REG_BLDY = shadow_bldy;
+    objvram_commit();
+    oam_copy(oam_mem, obj_buffer, shadow_oam_count);
+    sprite_commit();
+    oammux_vblank(1);
+    ready = 0;
+
+    if (!measure) return;
+    shown_hash = hash_shown();
+    if (pending) {
+        // This commit becomes visible after VBlank number vblank_count + 1
+        u32 lat = vblank_count + 1 - edge_frame;
+        if (shown_hash != edge_hash) {
+            LatencyStats *ls = &latency_stats;
+            ls->samples++;
+            ls->last = lat;
+            ls->total += lat;
+            if (lat < ls->min) ls->min = lat;
+            if (lat > ls->max) ls->max = lat;
+            pending = 0;
+        } else if (lat > LATENCY_TIMEOUT) {
+            latency_stats.timeouts++;
+            pending = 0;
+        }
+    }
+}
+
+//=============================================================================
+// Main loop side
+//=============================================================================
+void present_wait_input(int caught_up) {
+    int line = VDRAW_LINES - cost_lines - INPUT_LINE_MARGIN;
+    if (line < 0) line = 0;
+    present_input_line = line;
+    int vc = REG_VCOUNT;
+    if (caught_up && line > 0 && (vc < line || vc >= VDRAW_LINES)) {
+        REG_DISPSTAT = (REG_DISPSTAT & 0x00FF) | (line << 8);
+        IntrWait(1, IRQ_VCOUNT);
+    }
+    wake_line = REG_VCOUNT;
+    present_wait_lines = wake_line - vc;
+    if (present_wait_lines < 0) present_wait_lines += FRAME_LINES;
+}
+
+void present_expect(int lines) {
+    if (lines > cost_lines) cost_lines = lines;
+}
+
+void present_note_input(void) {
+    if (!measure || pending) return;
+    if (__key_curr & ~__key_prev) {
+        pending = 1;
+        edge_frame = vblank_count;
+        edge_hash = shown_hash;
+    }
+}
+
+void present_begin(void) {
+    ready = 0;
+}
+
+void present_display(u16 bg0cnt, u16 mosaic, u16 bldcnt, u16 bldy) {
+    shadow_bg0cnt = bg0cnt;
+    shadow_mosaic = mosaic;
+    shadow_bldcnt = bldcnt;
+    shadow_bldy = bldy;
+}
+
+void present_submit(u16 bg0_hofs, u16 bg0_vofs, int oam_count) {
+    // Frame cost in scanlines; decays by 1 line/frame so a single spike
+    // doesn't pin input sampling early forever
+    int cost = REG_VCOUNT - wake_line;
+    if (cost < 0) cost += FRAME_LINES;
+    if (cost > cost_lines) cost_lines = cost;
+    else if (cost_lines > cost) cost_lines--;
+
+    shadow_hofs = bg0_hofs;
+    shadow_vofs = bg0_vofs;
+    shadow_oam_count = oam_count;
+    ready = 1;
+}
@@ -0,0 +1,190 @@
+// replay.c — Deterministic input recording and playback
+//
+// The recorder captures the per-frame key state as RLE runs in SRAM; the
+// player feeds runs back into tonc's key state in place of the keypad, so
+// key_is_down()/key_hit() behave exactly as they did during recording.
+#include "replay.h"
+
+#define REPLAY_HDR_SIZE   12   // magic, seed, num_runs (u32 each)
+#define REPLAY_MAX_RUNS   ((REPLAY_SRAM_SIZE - REPLAY_HDR_SIZE) / 4)
+
+static int mode;
+static u32 seed;
+static u32 frame;
+
+// Playback source: ROM script or SRAM recording
+static const InputRun *script_runs;
+static int num_runs;
+static int run_idx;
+static InputRun cur;
+
+//=============================================================================
+// SRAM access (8-bit bus: byte reads/writes only)
+//=============================================================================
+static void sram_write(int ofs, const void *src, int len) {
+    const u8 *s = (const u8 *)src;
+    vu8 *d = (vu8 *)&sram_mem[REPLAY_SRAM_OFS + ofs];
+    for (int i = 0; i < len; i++) d[i] = s[i];
+}
+
+static void sram_read(int ofs, void *dst, int len) {
+    u8 *d = (u8 *)dst;
+    const vu8 *s = (const vu8 *)&sram_mem[REPLAY_SRAM_OFS + ofs];
+    for (int i = 0; i < len; i++) d[i] = s[i];
+}
+
+static u32 sram_read32(int ofs) {
+    u32 v;
+    sram_read(ofs, &v, 4);
+    return v;
+}
+
+static void sram_write32(int ofs, u32 v) {
+    sram_write(ofs, &v, 4);
+}
+
+static void load_run(int idx) {
+    if (script_runs)
+        cur = script_runs[idx];
+    else
+        sram_read(REPLAY_HDR_SIZE + idx * 4, &cur, 4);
+}
+
+//=============================================================================
+// Mode control
+//=============================================================================
+void replay_start_record(u32 s) {
+    mode = REPLAY_RECORD;
+    seed = s;
+    frame = 0;
+    num_runs = 0;
+    // Header is written up front with zero runs; num_runs is bumped as each
+    // run opens, so a power-off mid-recording still leaves a valid script.
+    sram_write32(0, REPLAY_MAGIC);
+    sram_write32(4, seed);
+    sram_write32(8, 0);
+}
+
+int replay_start_sram(void) {
+    if (sram_read32(0) != REPLAY_MAGIC) return 0;
+    int n = (int)sram_read32(8);
+    if (n <= 0 || n > REPLAY_MAX_RUNS) return 0;
+
+    mode = REPLAY_PLAY;
+    seed = sram_read32(4);
+    frame = 0;
+    script_runs = (const InputRun *)0;
+    num_runs = n;
+    run_idx = 0;
+    load_run(0);
+    return 1;
+}
+
+void replay_start_script(const ReplayScript *s) {
+    mode = REPLAY_PLAY;
+    seed = s->seed;
+    frame = 0;
+    script_runs = s->runs;
+    num_runs = s->num_runs;
+    run_idx = 0;
+    load_run(0);
+}
+
+void replay_stop(void) {
+    mode = REPLAY_OFF;
+}
+
+u32 replay_boot(void) {
+    u32 s = REPLAY_DEFAULT_SEED;
+    if (key_is_down(KEY_SELECT)) {
+        replay_start_script(&bench_route);
+        s = seed;
+    } else if (key_is_down(KEY_START)) {
+        if (replay_start_sram()) s = seed;
+    } else if (key_is_down(KEY_L) && key_is_down(KEY_R)) {
+        replay_start_record(s);
+    }
+    return s;
+}
+
+int replay_mode(void) { return mode; }
+u32 replay_seed(void) { return seed; }
+u32 replay_frame(void) { return frame; }
+
+//=============================================================================
+// Per-frame poll
+//=============================================================================
+void replay_poll(void) {
+    key_poll();
+
+    if (mode == REPLAY_RECORD) {
+        u16 keys = __key_curr;
+        if (num_runs > 0 && cur.keys == keys && cur.frames < 0xFFFF) {
+            cur.frames++;
+        } else {
+            if (num_runs >= REPLAY_MAX_RUNS) { mode = REPLAY_OFF; return; }
+            cur.keys = keys;
+            cur.frames = 1;
+            num_runs++;
+            sram_write32(8, (u32)num_runs);
+        }
+        sram_write(REPLAY_HDR_SIZE + (num_runs - 1) * 4, &cur, 4);
+        frame++;
+    } else if (mode == REPLAY_PLAY) {
+        while (cur.frames == 0) {
+            if (++run_idx >= num_runs) {
+                // Script exhausted: hand control back to the keypad
+                mode = REPLAY_OFF;
+                return;
+            }
+            load_run(run_idx);
+        }
+        __key_curr = cur.keys;
+        cur.frames--;
+        frame++;
+    }
+}
+
+//=============================================================================
+// Built-in benchmark route (generated by walking the waypoints
+// (12,8) (12,3) (70,3) (98,3) (98,11) (118,11) (118,12) (140,12) (140,14)
+// (174,14) (174,12) (198,12) and pressing A whenever blocked by a +1 step)
+//=============================================================================
+static const InputRun bench_route_runs[] = {
+    { KEY_RIGHT,          68 },  // start (3,8) → col 12
+    { KEY_UP,             37 },  // up to row 3
+    { KEY_RIGHT,           8 },
+    { KEY_RIGHT | KEY_A,   1 },  // hill 1: jump to h2
+    { KEY_RIGHT,          27 },
+    { KEY_RIGHT | KEY_A,   1 },  // jump to h3, fall off east side
+    { KEY_RIGHT,         269 },  // falls into river at col 38
+    { KEY_RIGHT | KEY_A,   1 },  // climb out of river
+    { KEY_RIGHT,         107 },
+    { KEY_RIGHT | KEY_A,   1 },  // hill 2: jump to h2
+    { KEY_RIGHT,          27 },
+    { KEY_RIGHT | KEY_A,   1 },  // jump to h3, fall off east side
+    { KEY_RIGHT,         335 },  // dirt patches → col 98
+    { KEY_DOWN,           60 },  // down to row 11
+    { KEY_RIGHT,         126 },  // falls into lake at col 102
+    { KEY_RIGHT | KEY_A,   1 },  // climb out of lake
+    { KEY_RIGHT,          51 },
+    { KEY_DOWN,            4 },  // row 12
+    { KEY_RIGHT,          40 },
+    { KEY_RIGHT | KEY_A,   1 },  // hill 3: jump to h2
+    { KEY_RIGHT,          27 },
+    { KEY_RIGHT | KEY_A,   1 },  // jump to h3, fall off east side
+    { KEY_RIGHT,         143 },
+    { KEY_DOWN,           12 },  // row 14, below the fortress towers
+    { KEY_RIGHT,         272 },  // along the fortress south wall → col 174
+    { KEY_UP,              9 },  // row 12
+    { KEY_RIGHT,           8 },
+    { KEY_RIGHT | KEY_A,   1 },  // onto the ruins wall (h2)
+    { KEY_RIGHT,         201 },  // along the wall top, fall off at col 196
+    { 0,                  60 },  // settle
+};
+
+const ReplayScript bench_route = {
+    REPLAY_DEFAULT_SEED,
+    sizeof(bench_route_runs) / sizeof(bench_route_runs[0]),
+    bench_route_runs,
+};
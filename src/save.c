@@ -0,0 +1,412 @@
+// save.c — Incremental saves in cart SRAM: checksummed delta log, two slots
+#include "save.h"
+#include "world.h"
+#include "player.h"
+#include "compose.h"
+#include "stream.h"
+#include "los.h"
+#include "trigger.h"
+#include "script.h"
+#include "../data/triggers.h"
+#include <string.h>
+
+SaveStats save_stats;
+int save_step_bytes = SAVE_STEP_BYTES;
+
+// Records: a tag byte, then little-endian fields
+enum {
+    SREC_PLAYER = 1,    // col, row, height, facing, world_x:4, world_y:4
+    SREC_CHECKPOINT,    // col, row
+    SREC_FLAGS,         // script_flags:4
+    SREC_FIRED,         // trigger id
+    SREC_CELL,          // col, row, ground | side << 4, height
+};
+
+#define BLOCK_HDR      4                    // length:2, checksum:2
+#define BLOCK_END      0xFFFF               // terminator (erased SRAM)
+#define PAYLOAD_MAX    (SAVE_SLOT_SIZE - SAVE_HDR_SIZE - BLOCK_HDR - 2)
+#define CELL_WORDS     ((MAP_ROWS * MAP_COLS + 31) / 32)
+
+static const u8 rec_size[] = { 0, 13, 3, 5, 2, 5 };
+
+#define BIT_TEST(a, k)   ((a)[(k) >> 5] & (1u << ((k) & 31)))
+#define BIT_SET(a, k)    ((a)[(k) >> 5] |= 1u << ((k) & 31))
+
+// Slot the log lives in (-1: none), its sequence and the log's end
+static int active = -1;
+static u32 active_seq;
+static int log_end;
+static int synced;                  // the log holds exactly the shadows below
+
+// State as of the last save
+static struct {
+    u8 col, row, height, facing;
+    int wx, wy;
+} sh_player;
+static int sh_cp_col, sh_cp_row;
+static u32 sh_flags;
+static u32 sh_fired[(TRIG_COUNT + 31) / 32];
+static u32 cell_dirty[CELL_WORDS];  // changed since the last save
+static u32 cell_delta[CELL_WORDS];  // changed since world generation
+
+// Write job: up to three SRAM spans, in order; the last one commits
+typedef struct {
+    int ofs;
+    const u8 *src;
+    int len;
+} Span;
+
+static EWRAM_BSS u8 job_buf[BLOCK_HDR + PAYLOAD_MAX + 2];
+static u8 job_hdr[SAVE_HDR_SIZE];
+static const u8 zero_hdr[SAVE_HDR_SIZE];
+static Span spans[3];
+static int num_spans, span, span_pos;
+static int job_compact, job_len;
+static int pending;
+static int build_cycles;            // this step's block builds
+
+//=============================================================================
+// SRAM access (8-bit bus: byte reads/writes only)
+//=============================================================================
+static void sram_write(int ofs, const u8 *src, int len) {
+    vu8 *d = (vu8 *)&sram_mem[SAVE_SRAM_OFS + ofs];
+    for (int i = 0; i < len; i++) d[i] = src[i];
+}
+
+static void sram_read(int ofs, u8 *dst, int len) {
+    const vu8 *s = (const vu8 *)&sram_mem[SAVE_SRAM_OFS + ofs];
+    for (int i = 0; i < len; i++) dst[i] = s[i];
+}
+
+static inline int get16(const u8 *p) { return p[0] | p[1] << 8; }
+static inline u32 get32(const u8 *p) { return p[0] | p[1] << 8 | p[2] << 16 | (u32)p[3] << 24; }
+static inline void put16(u8 *p, int v) { p[0] = (u8)v; p[1] = (u8)(v >> 8); }
+static inline void put32(u8 *p, u32 v) { put16(p, (int)(v & 0xFFFF)); put16(p + 2, (int)(v >> 16)); }
+
+// Fletcher-16, continued from `sum` (start with 0)
+static u16 fletcher16(u16 sum, const u8 *d, int n) {
+    u32 a = sum & 0xFF, b = sum >> 8;
+    for (int i = 0; i < n; i++) {
+        a += d[i];
+        if (a >= 255) a -= 255;
+        b += a;
+        if (b >= 255) b -= 255;
+    }
+    return (u16)(b << 8 | a);
+}
+
+// Over the length field and the payload
+static u16 block_sum(const u8 *block, int len) {
+    return fletcher16(fletcher16(0, block, 2), block + BLOCK_HDR, len);
+}
+
+//=============================================================================
+// Slots
+//=============================================================================
+// Sequence number of a valid slot header, else 0
+static u32 slot_seq(int slot) {
+    u8 h[SAVE_HDR_SIZE];
+    sram_read(slot * SAVE_SLOT_SIZE, h, SAVE_HDR_SIZE);
+    if (get32(h) != SAVE_MAGIC || get16(h + 8) != fletcher16(0, h, 8)) return 0;
+    return get32(h + 4);
+}
+
+static void apply_record(const u8 *p);
+
+// Walk a slot's log, optionally applying it; returns the offset of its end
+static int scan_slot(int slot, int apply) {
+    int base = slot * SAVE_SLOT_SIZE;
+    int pos = SAVE_HDR_SIZE;
+    while (pos + BLOCK_HDR <= SAVE_SLOT_SIZE - 2) {
+        u8 *b = job_buf;
+        sram_read(base + pos, b, BLOCK_HDR);
+        int len = get16(b);
+        if (len == 0 || len == BLOCK_END || len > SAVE_SLOT_SIZE - 2 - pos - BLOCK_HDR) break;
+        sram_read(base + pos + BLOCK_HDR, b + BLOCK_HDR, len);
+        if (get16(b + 2) != block_sum(b, len)) break;
+        if (apply) {
+            save_stats.load_blocks++;
+            const u8 *end = b + BLOCK_HDR + len;
+            for (const u8 *p = b + BLOCK_HDR; p < end; p += rec_size[*p]) {
+                if (*p == 0 || *p > SREC_CELL || p + rec_size[*p] > end) break;
+                apply_record(p);
+                save_stats.load_records++;
+            }
+        }
+        pos += BLOCK_HDR + len;
+    }
+    return pos;
+}
+
+//=============================================================================
+// Setup
+//=============================================================================
+static void take_shadows(void) {
+    sh_player.col = (u8)player.tile_col;
+    sh_player.row = (u8)player.tile_row;
+    sh_player.height = (u8)player.height;
+    sh_player.facing = (u8)player.facing;
+    sh_player.wx = player.world_x;
+    sh_player.wy = player.world_y;
+    sh_cp_col = trigger_checkpoint_col;
+    sh_cp_row = trigger_checkpoint_row;
+    sh_flags = script_flags;
+    for (int id = 0; id < TRIG_COUNT; id++)
+        if ((trigDefs[id].flags & TRIG_ONCE) && trigger_fired(id)) BIT_SET(sh_fired, id);
+}
+
+void save_init(void) {
+    memset(&save_stats, 0, sizeof(save_stats));
+    memset(cell_dirty, 0, sizeof(cell_dirty));
+    memset(cell_delta, 0, sizeof(cell_delta));
+    memset(sh_fired, 0, sizeof(sh_fired));
+    num_spans = 0;
+    pending = 0;
+    synced = 0;
+    active = -1;
+    active_seq = 0;
+    for (int s = 0; s < 2; s++) {
+        u32 seq = slot_seq(s);
+        if (seq && (active < 0 || (s32)(seq - active_seq) > 0)) {
+            active = s;
+            active_seq = seq;
+        }
+    }
+    log_end = active >= 0 ? scan_slot(active, 0) : 0;
+}
+
+//=============================================================================
+// Load
+//=============================================================================
+static void apply_record(const u8 *p) {
+    switch (p[0]) {
+    case SREC_PLAYER:
+        player.tile_col = p[1];
+        player.tile_row = p[2];
+        player.height = p[3];
+        player.facing = p[4] & 3;
+        player.world_x = (int)get32(p + 5);
+        player.world_y = (int)get32(p + 9);
+        break;
+    case SREC_CHECKPOINT:
+        trigger_checkpoint_col = p[1];
+        trigger_checkpoint_row = p[2];
+        break;
+    case SREC_FLAGS:
+        script_flags = get32(p + 1);
+        break;
+    case SREC_FIRED:
+        if (p[1] < TRIG_COUNT) trigger_mark_fired(p[1]);
+        break;
+    case SREC_CELL: {
+        int c = p[1], r = p[2];
+        if (c >= MAP_COLS || r >= MAP_ROWS) break;
+        MapCell *cell = &world_map[r][c];
+        cell->ground = p[3] & 15;
+        cell->side = p[3] >> 4;
+        cell->height = p[4] > MAX_HEIGHT ? MAX_HEIGHT : p[4];
+        BIT_SET(cell_delta, r * MAP_COLS + c);
+        break;
+    }
+    }
+}
+
+int save_load(void) {
+    SaveStats *ss = &save_stats;
+    ss->load_blocks = ss->load_records = 0;
+    ss->load_cells = ss->load_stamped = ss->load_tiles = 0;
+    if (active < 0) return 0;
+    scan_slot(active, 1);
+    if (!ss->load_blocks) return 0;
+
+    player.jumping = player.falling = 0;
+    player.jump_visual_dy = player.fall_visual_dy = 0;
+    player.moving = 0;
+
+    // Cells last: each recomposited once, whatever the log did to it
+    int first = num_tiles;
+    for (int w = 0; w < CELL_WORDS; w++) {
+        for (u32 bits = cell_delta[w]; bits; bits &= bits - 1) {
+            int k = w * 32 + __builtin_ctz(bits);
+            int c = k % MAP_COLS, r = k / MAP_COLS;
+            ComposeRect rect;
+            los_cell_changed(c, r);
+            ss->load_stamped += compose_cell(c, r, &rect);
+            stream_refresh(&rect);
+            ss->load_cells++;
+        }
+    }
+    ss->load_tiles = num_tiles - first;
+    upload_tiles_from(first);
+
+    take_shadows();
+    synced = 1;
+    return ss->load_blocks;
+}
+
+//=============================================================================
+// Save
+//=============================================================================
+void save_cell_changed(int col, int row) {
+    int k = row * MAP_COLS + col;
+    BIT_SET(cell_dirty, k);
+    BIT_SET(cell_delta, k);
+}
+
+// Records for what differs from the shadows (everything if `full`) into
+// job_buf's payload, updating the shadows; returns the payload length
+static int build(int full) {
+    u8 *p0 = job_buf + BLOCK_HDR, *p = p0;
+    if (full || player.tile_col != sh_player.col || player.tile_row != sh_player.row ||
+        player.height != sh_player.height || player.facing != sh_player.facing ||
+        player.world_x != sh_player.wx || player.world_y != sh_player.wy) {
+        p[0] = SREC_PLAYER;
+        p[1] = (u8)player.tile_col;
+        p[2] = (u8)player.tile_row;
+        p[3] = (u8)player.height;
+        p[4] = (u8)player.facing;
+        put32(p + 5, (u32)player.world_x);
+        put32(p + 9, (u32)player.world_y);
+        p += 13;
+    }
+    if (full || trigger_checkpoint_col != sh_cp_col || trigger_checkpoint_row != sh_cp_row) {
+        p[0] = SREC_CHECKPOINT;
+        p[1] = (u8)trigger_checkpoint_col;
+        p[2] = (u8)trigger_checkpoint_row;
+        p += 3;
+    }
+    if (full || script_flags != sh_flags) {
+        p[0] = SREC_FLAGS;
+        put32(p + 1, script_flags);
+        p += 5;
+    }
+    for (int id = 0; id < TRIG_COUNT; id++) {
+        if (!(trigDefs[id].flags & TRIG_ONCE) || !trigger_fired(id)) continue;
+        if (!full && BIT_TEST(sh_fired, id)) continue;
+        p[0] = SREC_FIRED;
+        p[1] = (u8)id;
+        p += 2;
+    }
+    take_shadows();
+
+    const u32 *bitmap = full ? cell_delta : cell_dirty;
+    for (int w = 0; w < CELL_WORDS; w++) {
+        for (u32 bits = bitmap[w]; bits; bits &= bits - 1) {
+            if (p + 5 > p0 + PAYLOAD_MAX) {
+                save_stats.overflow++;
+                continue;
+            }
+            int k = w * 32 + __builtin_ctz(bits);
+            const MapCell *cell = &world_map[k / MAP_COLS][k % MAP_COLS];
+            p[0] = SREC_CELL;
+            p[1] = (u8)(k % MAP_COLS);
+            p[2] = (u8)(k / MAP_COLS);
+            p[3] = (u8)(cell->ground | cell->side << 4);
+            p[4] = cell->height;
+            p += 5;
+        }
+    }
+    memset(cell_dirty, 0, sizeof(cell_dirty));
+    return (int)(p - p0);
+}
+
+// Build the block and queue its spans
+static void start_job(void) {
+    build_cycles += SAVE_BUILD_CYCLES;
+    int len = synced ? build(0) : 0;
+    if (synced && !len) {
+        save_stats.unchanged++;
+        return;
+    }
+    job_compact = !synced || log_end + BLOCK_HDR + len + 2 > SAVE_SLOT_SIZE;
+    if (job_compact) len = build(1);
+
+    put16(job_buf, len);
+    put16(job_buf + 2, block_sum(job_buf, len));
+    put16(job_buf + BLOCK_HDR + len, BLOCK_END);
+    job_len = len;
+    if (job_compact) {
+        // Invalidate the other slot, write the block, then its header
+        int base = (active < 0 ? 0 : active ^ 1) * SAVE_SLOT_SIZE;
+        put32(job_hdr, SAVE_MAGIC);
+        put32(job_hdr + 4, active_seq + 1);
+        put16(job_hdr + 8, fletcher16(0, job_hdr, 8));
+        put16(job_hdr + 10, 0);
+        spans[0] = (Span){ base, zero_hdr, SAVE_HDR_SIZE };
+        spans[1] = (Span){ base + SAVE_HDR_SIZE, job_buf, BLOCK_HDR + len + 2 };
+        spans[2] = (Span){ base, job_hdr, SAVE_HDR_SIZE };
+        num_spans = 3;
+    } else {
+        // Checksum, payload and a new terminator; the length last
+        int at = active * SAVE_SLOT_SIZE + log_end;
+        spans[0] = (Span){ at + 2, job_buf + 2, 2 + len + 2 };
+        spans[1] = (Span){ at, job_buf, 2 };
+        num_spans = 2;
+    }
+    span = span_pos = 0;
+}
+
+static void finish_job(void) {
+    SaveStats *ss = &save_stats;
+    if (job_compact) {
+        active = active < 0 ? 0 : active ^ 1;
+        active_seq++;
+        log_end = SAVE_HDR_SIZE;
+        synced = 1;
+        ss->compactions++;
+    }
+    log_end += BLOCK_HDR + job_len;
+    ss->saves++;
+    if ((u32)job_len + BLOCK_HDR > ss->block_peak) ss->block_peak = job_len + BLOCK_HDR;
+    num_spans = 0;
+}
+
+void save_request(void) {
+    if (num_spans) {
+        save_stats.deferred++;
+        pending = 1;
+        return;
+    }
+    start_job();
+}
+
+int save_busy(void) {
+    return num_spans != 0 || pending;
+}
+
+void save_update(void) {
+    SaveStats *ss = &save_stats;
+    for (int k = 0; k < trigger_num_events; k++) {
+        const TriggerEvent *e = &trigger_events[k];
+        if (e->edge == TRIG_ENTER && trigDefs[e->id].kind == TRIG_CHECKPOINT)
+            save_request();
+    }
+    if (!num_spans && pending) {
+        pending = 0;
+        start_job();
+    }
+
+    // One slice, across span boundaries
+    int budget = save_step_bytes;
+    int written = 0;
+    while (num_spans && budget > 0) {
+        Span *sp = &spans[span];
+        int n = sp->len - span_pos;
+        if (n > budget) n = budget;
+        sram_write(sp->ofs + span_pos, sp->src + span_pos, n);
+        span_pos += n;
+        budget -= n;
+        written += n;
+        if (span_pos == sp->len) {
+            span_pos = 0;
+            if (++span == num_spans) finish_job();
+        }
+    }
+    if (written) {
+        ss->steps++;
+        ss->bytes += written;
+    }
+    ss->cycles = build_cycles + written * SAVE_BYTE_CYCLES;
+    build_cycles = 0;
+    if (ss->cycles > ss->cycles_peak) ss->cycles_peak = ss->cycles;
+}
@@ -0,0 +1,197 @@
+// script.c — Bytecode VM for events and cutscenes
+#include "script.h"
+#include "trigger.h"
+#include "player.h"
+#include "world.h"
+#include "entity.h"
+#include "particle.h"
+#include "warp.h"
+#include "timing.h"
+#include "../data/scripts.h"
+#include "../data/triggers.h"
+#include <string.h>
+
+ScriptStats script_stats;
+Script scripts[SCRIPT_MAX];
+u32 script_flags;
+
+void script_init(void) {
+    memset(&script_stats, 0, sizeof(script_stats));
+    for (int s = 0; s < SCRIPT_MAX; s++) scripts[s].id = SCRIPT_NONE;
+    script_flags = 0;
+    if (SCRIPT_BOOT != SCRIPT_NONE) script_start(SCRIPT_BOOT);
+}
+
+int script_start(int id) {
+    for (int s = 0; s < SCRIPT_MAX; s++) {
+        Script *sc = &scripts[s];
+        if (sc->id != SCRIPT_NONE) continue;
+        memset(sc, 0, sizeof(*sc));
+        sc->id = (u8)id;
+        sc->pc = scriptStart[id];
+        script_stats.started++;
+        return s;
+    }
+    script_stats.dropped++;
+    return -1;
+}
+
+//=============================================================================
+// Interpreter
+//=============================================================================
+static inline int clamp_col(int c) { return c < 0 ? 0 : c >= MAP_COLS ? MAP_COLS - 1 : c; }
+static inline int clamp_row(int r) { return r < 0 ? 0 : r >= MAP_ROWS ? MAP_ROWS - 1 : r; }
+
+// Nonzero once the script's wait is over
+static inline int wait_done(Script *sc) {
+    switch (sc->wait_op) {
+    case SOP_WAIT:      return --sc->wait == 0;
+    case SOP_WAIT_MOVE: return player.tile_col != sc->wait_col || player.tile_row != sc->wait_row;
+    case SOP_WAIT_COL:  return player.tile_col >= sc->wait;
+    case SOP_WAIT_KEY:  return key_hit(sc->wait) != 0;
+    case SOP_WAIT_FLAG: return (script_flags >> sc->wait) & 1;
+    case SOP_WARP:      return warp_state == WARP_IDLE;
+    }
+    return 1;
+}
+
+// Run one script for up to SCRIPT_SLICE instructions; returns those used
+static IWRAM_CODE int run(Script *sc) {
+    const u8 *base = &scriptCode[scriptStart[sc->id]];
+    const u8 *p = &scriptCode[sc->pc];
+    int ops = 0;
+    while (ops < SCRIPT_SLICE) {
+        int op = *p++;
+        ops++;
+        switch (op) {
+        case SOP_END:
+            sc->id = SCRIPT_NONE;
+            script_stats.finished++;
+            return ops;
+        case SOP_YIELD:
+            sc->pc = (u16)(p - scriptCode);
+            return ops;
+        case SOP_WAIT:
+            sc->wait = p[0] | p[1] << 8;
+            p += 2;
+            if (!sc->wait) break;
+            sc->wait_op = SOP_WAIT;
+            sc->pc = (u16)(p - scriptCode);
+            return ops;
+        case SOP_WAIT_MOVE:
+            sc->wait_op = SOP_WAIT_MOVE;
+            sc->wait_col = (u16)player.tile_col;
+            sc->wait_row = (u8)player.tile_row;
+            sc->pc = (u16)(p - scriptCode);
+            return ops;
+        case SOP_WAIT_COL:
+        case SOP_WAIT_FLAG:
+            sc->wait_op = (u8)op;
+            sc->wait = *p++;
+            sc->pc = (u16)(p - scriptCode);
+            return ops;
+        case SOP_WAIT_KEY:
+            sc->wait_op = SOP_WAIT_KEY;
+            sc->wait = p[0] | p[1] << 8;
+            sc->pc = (u16)(p + 2 - scriptCode);
+            return ops;
+        case SOP_SET:
+            sc->reg[p[0] & (SCRIPT_REGS - 1)] = (s16)(p[1] | p[2] << 8);
+            p += 3;
+            break;
+        case SOP_ADD:
+            sc->reg[p[0] & (SCRIPT_REGS - 1)] += (s8)p[1];
+            p += 2;
+            break;
+        case SOP_JMP:
+            p = base + (p[0] | p[1] << 8);
+            break;
+        case SOP_JNZ:
+            p = sc->reg[p[0] & (SCRIPT_REGS - 1)] ? base + (p[1] | p[2] << 8) : p + 3;
+            break;
+        case SOP_DJNZ:
+            p = --sc->reg[p[0] & (SCRIPT_REGS - 1)] ? base + (p[1] | p[2] << 8) : p + 3;
+            break;
+        case SOP_FLAG:
+            script_flags |= 1u << (p[0] & 31);
+            p++;
+            break;
+        case SOP_FX: {
+            int c = clamp_col(p[1]), r = clamp_row(p[2]);
+            particle_effect(p[0], c, r, world_map[r][c].height, 0);
+            p += 3;
+            break;
+        }
+        case SOP_FXP: {
+            int c = clamp_col(player.tile_col + (s8)p[1]);
+            int r = clamp_row(player.tile_row + (s8)p[2]);
+            particle_effect(p[0], c, r, player.height, player.facing);
+            p += 3;
+            break;
+        }
+        case SOP_SPAWN:
+            entity_spawn(p[0], clamp_col(p[1]), clamp_row(p[2]), p[3] & 3);
+            p += 4;
+            break;
+        case SOP_RUN:
+            script_start(*p++);
+            break;
+        case SOP_WARP:
+            p += 3;
+            if (!warp_start(clamp_col(p[-3]), clamp_row(p[-2]), p[-1])) break;
+            sc->wait_op = SOP_WARP;
+            sc->pc = (u16)(p - scriptCode);
+            return ops;
+        default:
+            sc->id = SCRIPT_NONE;
+            script_stats.bad_op++;
+            return ops;
+        }
+    }
+    sc->pc = (u16)(p - scriptCode);
+    script_stats.sliced++;
+    return ops;
+}
+
+IWRAM_CODE void script_update(void) {
+    ScriptStats *ss = &script_stats;
+    u32 t0 = timing_cycles();
+
+    // Cutscene triggers entered this step
+    for (int k = 0; k < trigger_num_events; k++) {
+        const TriggerEvent *e = &trigger_events[k];
+        const TriggerDef *t = &trigDefs[e->id];
+        if (e->edge == TRIG_ENTER && t->kind == TRIG_CUTSCENE &&
+            t->arg < SCRIPT_CUTSCENES && scriptCutscene[t->arg] != SCRIPT_NONE)
+            script_start(scriptCutscene[t->arg]);
+    }
+
+    // Scripts started during the pass (SOP_RUN) get their first slice now
+    // if their slot comes later, else next step
+    int ops = 0, waits = 0, running = 0;
+    ss->sliced = 0;
+    for (int s = 0; s < SCRIPT_MAX; s++) {
+        Script *sc = &scripts[s];
+        if (sc->id == SCRIPT_NONE) continue;
+        if (sc->wait_op) {
+            waits++;
+            if (!wait_done(sc)) {
+                running++;
+                continue;
+            }
+            sc->wait_op = 0;
+        }
+        ops += run(sc);
+        running += sc->id != SCRIPT_NONE;
+    }
+    ss->ops = ops;
+    ss->ops_total += ops;
+    if ((u32)ops > ss->ops_peak) ss->ops_peak = ops;
+    ss->running = running;
+    if ((u32)running > ss->running_peak) ss->running_peak = running;
+    u32 cycles = timing_cycles() - t0;
+    if (!cycles)        // host build: the timers do not run
+        cycles = ops * SCRIPT_OP_CYCLES + waits * SCRIPT_WAIT_CYCLES;
+    ss->cycles = cycles;
+    if (cycles > ss->cycles_peak) ss->cycles_peak = cycles;
+}
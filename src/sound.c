@@ -0,0 +1,256 @@
+// sound.c — Software mixer on DirectSound A, music sequencer and SFX voices
+#include "sound.h"
+#include "timing.h"
+#include "../data/sounds.h"
+#include <string.h>
+
+SoundStats sound_stats;
+int sound_channels;
+int sound_rate;
+
+typedef struct {
+    u16 hz;
+    u16 spf;            // samples per frame
+    u16 timer;          // CPU cycles per sample (timer 0 period)
+} MixRate;
+
+static const MixRate rates[NUM_SOUND_RATES] = {
+    { 10512, 176, 1596 }, { 13379, 224, 1254 }, { 18157, 304, 924 },
+    { 21024, 352,  798 }, { 26758, 448,  627 }, { 31536, 528, 532 },
+};
+
+typedef struct {
+    const s8 *data;
+    u32 pos, inc;       // SOUND_FRAC fixed point
+    u32 end;            // length, fixed point
+    u32 loop;           // loop length, fixed point; 0 for one-shots
+    u8  active;
+    u8  vol;
+    u8  prio;
+    u8  id;
+} Voice;
+
+// IWRAM (.bss): the DMA reads the buffer, the mixer walks voices and acc
+static Voice voices[SOUND_CHANNELS_MAX];
+static s8  mix_buf[2 * SOUND_SPF_MAX] __attribute__((aligned(4)));
+static s16 mix_acc[SOUND_SPF_MAX];
+static int half;                    // buffer half the DMA is playing
+static int spf;
+static u32 voice_samples;           // voice samples mixed this frame
+
+// Main loop → ISR
+static volatile u8 queue[SOUND_QUEUE];
+static volatile u32 q_head, q_tail;
+static volatile int music_req;       // song to start, -1 for none pending
+
+// Sequencer (ISR)
+static const SoundSong *song;
+static int row, tick;
+
+//=============================================================================
+// Setup
+//=============================================================================
+void sound_init(int channels, int rate) {
+    memset(&sound_stats, 0, sizeof(sound_stats));
+    q_head = q_tail = 0;
+    music_req = -1;
+    song = 0;
+    sound_config(channels, rate);
+}
+
+void sound_config(int channels, int rate) {
+    if (channels < SOUND_MUSIC_VOICES + 1) channels = SOUND_MUSIC_VOICES + 1;
+    if (channels > SOUND_CHANNELS_MAX) channels = SOUND_CHANNELS_MAX;
+    sound_channels = channels;
+    sound_rate = rate;
+    spf = rates[rate].spf;
+
+    REG_TM0CNT = 0;
+    REG_DMA[1].cnt = 0;
+    memset(voices, 0, sizeof(voices));
+    memset(mix_buf, 0, sizeof(mix_buf));
+    half = 0;
+
+    // DirectSound A on both speakers at full volume, clocked by timer 0
+    REG_SNDSTAT = SSTAT_ENABLE;
+    REG_SNDDSCNT = SDS_A100 | SDS_AL | SDS_AR | SDS_ATMR0 | SDS_ARESET;
+    REG_TM0D = (u16)(0x10000 - rates[rate].timer);
+    REG_TM0CNT = TM_ENABLE;
+    REG_DMA[1].src = mix_buf;
+    REG_DMA[1].dst = (void *)&REG_FIFO_A;
+    REG_DMA[1].cnt = DMA_DST_FIXED | DMA_REPEAT | DMA_32 | DMA_AT_FIFO | DMA_ENABLE;
+}
+
+int sound_rate_hz(int rate) {
+    return rates[rate].hz;
+}
+
+int sound_samples_per_frame(int rate) {
+    return rates[rate].spf;
+}
+
+//=============================================================================
+// Main loop side
+//=============================================================================
+int sound_sfx(int id) {
+    if (id >= SFX_COUNT) return 0;
+    if (q_head - q_tail >= SOUND_QUEUE) {
+        sound_stats.queue_full++;
+        return 0;
+    }
+    queue[q_head & (SOUND_QUEUE - 1)] = (u8)id;
+    q_head++;
+    return 1;
+}
+
+void sound_music(int id) {
+    music_req = id;
+}
+
+//=============================================================================
+// ISR side
+//=============================================================================
+static void voice_start(Voice *v, const SoundSample *s, u32 hz, int vol) {
+    v->data = s->data;
+    v->pos = 0;
+    v->inc = (hz << SOUND_FRAC) / rates[sound_rate].hz;
+    v->end = s->length << SOUND_FRAC;
+    v->loop = s->loop_start == SOUND_NO_LOOP ? 0 : (s->length - s->loop_start) << SOUND_FRAC;
+    v->vol = (u8)vol;
+    v->active = 1;
+}
+
+// Free voice, else the lowest priority one, closest to its end among equals
+static void start_sfx(int id, u32 *seen) {
+    SoundStats *ss = &sound_stats;
+    if (*seen & (1u << id)) {
+        ss->sfx_merged++;
+        return;
+    }
+    *seen |= 1u << id;
+    const SoundSample *s = &soundSamples[id];
+    int pick = -1;
+    for (int i = SOUND_MUSIC_VOICES; i < sound_channels; i++) {
+        Voice *v = &voices[i];
+        if (!v->active) {
+            pick = i;
+            break;
+        }
+        if (pick < 0 || v->prio < voices[pick].prio ||
+            (v->prio == voices[pick].prio && v->end - v->pos < voices[pick].end - voices[pick].pos))
+            pick = i;
+    }
+    Voice *v = &voices[pick];
+    if (v->active) {
+        if (v->prio > s->prio) {
+            ss->sfx_dropped++;
+            return;
+        }
+        ss->sfx_stolen++;
+    }
+    voice_start(v, s, s->rate, s->vol);
+    v->prio = s->prio;
+    v->id = (u8)id;
+    ss->sfx_played++;
+}
+
+static void music_tick(void) {
+    int req = music_req;
+    if (req >= 0) {
+        music_req = -1;
+        song = req < SONG_COUNT ? &soundSongs[req] : 0;
+        row = tick = 0;
+        for (int t = 0; t < SOUND_MUSIC_VOICES; t++) voices[t].active = 0;
+    }
+    if (!song) return;
+    if (tick == 0) {
+        const u8 *cells = &song->rows[row * song->tracks];
+        for (int t = 0; t < song->tracks; t++) {
+            int n = cells[t];
+            if (n == SOUND_NOTE_OFF) {
+                voices[t].active = 0;
+            } else if (n) {
+                const SoundSample *s = &soundSamples[song->inst[t]];
+                u32 hz = (u32)s->rate * soundNotePitch[n - SOUND_NOTE_LO] >> 12;
+                voice_start(&voices[t], s, hz, song->vol[t]);
+            }
+        }
+    }
+    if (++tick == song->ticks) {
+        tick = 0;
+        if (++row == song->num_rows) row = song->loop_row;
+    }
+}
+
+static IWRAM_CODE void mix_voice(Voice *v, s16 *acc, int n) {
+    const s8 *d = v->data;
+    u32 pos = v->pos, inc = v->inc, end = v->end;
+    int vol = v->vol;
+    int i;
+    for (i = 0; i < n; i++) {
+        acc[i] += d[pos >> SOUND_FRAC] * vol;
+        pos += inc;
+        if (pos >= end) {
+            if (!v->loop) {
+                v->active = 0;
+                i++;
+                break;
+            }
+            pos -= v->loop;
+        }
+    }
+    v->pos = pos;
+    voice_samples += i;
+}
+
+static IWRAM_CODE void mix(s8 *out, int n) {
+    memset(mix_acc, 0, n * sizeof(mix_acc[0]));
+    u32 active = 0;
+    voice_samples = 0;
+    for (int k = 0; k < sound_channels; k++) {
+        if (!voices[k].active) continue;
+        active++;
+        mix_voice(&voices[k], mix_acc, n);
+    }
+    u32 clipped = 0;
+    for (int i = 0; i < n; i++) {
+        int s = mix_acc[i] >> SOUND_MIX_SHIFT;
+        if (s > 127) { s = 127; clipped++; }
+        else if (s < -128) { s = -128; clipped++; }
+        out[i] = (s8)s;
+    }
+    sound_stats.voices = active;
+    if (active > sound_stats.voices_peak) sound_stats.voices_peak = active;
+    sound_stats.clipped += clipped;
+}
+
+IWRAM_CODE void sound_rewind(void) {
+    // The DMA ran on into the other half; after the second, rewind it
+    half ^= 1;
+    if (half == 0) {
+        REG_DMA[1].cnt = 0;
+        REG_DMA[1].src = mix_buf;
+        REG_DMA[1].cnt = DMA_DST_FIXED | DMA_REPEAT | DMA_32 | DMA_AT_FIFO | DMA_ENABLE;
+    }
+}
+
+IWRAM_CODE void sound_vblank(void) {
+    SoundStats *ss = &sound_stats;
+    u32 t0 = timing_cycles();
+
+    u32 seen = 0;
+    while (q_tail != q_head) {
+        start_sfx(queue[q_tail & (SOUND_QUEUE - 1)], &seen);
+        q_tail++;
+    }
+    music_tick();
+    mix(&mix_buf[(half ^ 1) * spf], spf);
+
+    u32 cycles = timing_cycles() - t0;
+    if (!cycles)        // host build: the timers do not run
+        cycles = SOUND_FRAME_CYCLES + spf * SOUND_OUT_CYCLES + voice_samples * SOUND_VOICE_CYCLES;
+    ss->frames++;
+    ss->cycles = cycles;
+    ss->cycles_total += cycles;
+    if (cycles > ss->cycles_peak) ss->cycles_peak = cycles;
+}
@@ -0,0 +1,33 @@
+// spawns.c — Actor spawn records for the world strip (ROM, sorted by col)
+//
+// A loose patrol every five columns along the strip, and a full garrison
+// around the fortress courtyard and on the main hall roof. Indices must
+// stay below ENT_NO_SPAWN.
+#include "entity.h"
+
+#define G ENT_GUARD
+#define S ENT_SLIME
+#define P ENT_PICKUP
+
+const SpawnDef world_spawns[] = {
+    { 12, 2,S}, { 17, 6,G}, { 22, 9,P}, { 27,13,G}, { 32, 4,S}, { 37,11,G},
+    { 42,12,P}, { 47,14,G}, { 52, 2,S}, { 57, 6,G}, { 62, 9,P}, { 67,13,G},
+    { 72, 4,S}, { 77,11,G}, { 82, 7,P}, { 87,14,G}, { 92, 2,S}, { 97, 6,G},
+    {102, 9,P}, {107, 2,G}, {112, 4,S}, {117,11,G}, {122, 7,P}, {127,14,G},
+    {132, 2,S}, {137, 6,G}, {142, 9,P}, {147,13,G}, {150,14,P}, {152, 5,S},
+    {152, 6,G}, {152, 7,G}, {152, 8,G}, {152, 9,G}, {152,10,S}, {153, 5,G},
+    {153, 6,S}, {153, 7,S}, {153, 8,S}, {153, 9,S}, {153,10,G}, {154, 5,S},
+    {154, 6,G}, {154, 7,G}, {154, 8,G}, {154, 9,G}, {154,10,S}, {154,14,P},
+    {155, 5,G}, {155,10,G}, {156, 5,S}, {156, 6,G}, {156, 9,G}, {156,10,S},
+    {157, 5,G}, {157,10,G}, {158, 5,S}, {158, 6,G}, {158, 9,G}, {158,10,S},
+    {158,14,P}, {159, 5,G}, {159,10,G}, {160, 5,S}, {160, 6,G}, {160, 9,G},
+    {160,10,S}, {161, 5,G}, {161,10,G}, {162, 5,S}, {162, 6,G}, {162, 9,G},
+    {162,10,S}, {162,14,P}, {163, 5,G}, {163,10,G}, {164, 5,S}, {164, 6,G},
+    {164, 9,G}, {164,10,S}, {165, 5,G}, {165,10,G}, {166, 5,S}, {166, 6,G},
+    {166, 7,G}, {166, 8,G}, {166, 9,G}, {166,10,S}, {166,14,P}, {167, 5,G},
+    {167, 6,S}, {167, 7,S}, {167, 8,S}, {167, 9,S}, {167,10,G}, {168, 5,S},
+    {168, 6,G}, {168, 7,G}, {168, 8,G}, {168, 9,G}, {168,10,S}, {170,14,P},
+    {174, 4,S}, {179,11,G}, {184, 7,P}, {189,14,G}, {194, 2,S},
+};
+
+const int num_world_spawns = sizeof(world_spawns) / sizeof(world_spawns[0]);
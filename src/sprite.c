@@ -0,0 +1,377 @@
+// sprite.c — Depth-sorted shadow OAM builder
+#include "sprite.h"
+#include "oammux.h"
+#include "player.h"
+#include "world.h"
+#include <string.h>
+
+SpriteStats sprite_stats;
+u16 sprite_lines[SCREEN_H];
+
+// OBJ size in pixels by [shape][size]
+static const u8 obj_w[4][4] = { { 8, 16, 32, 64 }, { 16, 32, 32, 64 }, { 8, 8, 16, 32 } };
+static const u8 obj_h[4][4] = { { 8, 16, 32, 64 }, { 8, 8, 16, 32 }, { 16, 32, 32, 64 } };
+
+// This frame's sprites, in sprite_add() order
+static int num_sprites;
+static u16 spr_key[SPRITE_MAX];
+static u8  spr_id[SPRITE_MAX];
+static u16 spr_attr0[SPRITE_MAX], spr_attr1[SPRITE_MAX], spr_attr2[SPRITE_MAX];
+static s16 spr_x[SPRITE_MAX], spr_y[SPRITE_MAX];
+static const MetaPiece *spr_pieces[SPRITE_MAX];    // meta-sprite, or NULL
+static const OBJ_ATTR *spr_objs[SPRITE_MAX];       // OBJ batch, or NULL
+static u8  spr_num_pieces[SPRITE_MAX];             // pieces or batch OBJs
+
+static u8 order[SPRITE_MAX];       // indices into the arrays above
+static u8 idx_of_id[256];          // this frame's index per owner id, or 0xFF
+
+// Previous frame's emitted order, by owner id, and its first OAM entry
+static u8 prev_ids[SPRITE_MAX];
+static u8 prev_obj[SPRITE_MAX];
+static int prev_count;
+static int prev_objs;
+
+// Visible OBJs of the submitted frame, and of the one last copied to OAM:
+// a frame withdrawn before its VBlank never reached OAM, so hiding is
+// against what the hardware actually shows
+static int submit_objs;
+static volatile int shown_objs;
+
+static u8 admitted[SPRITE_MAX];    // passed the line budget, by sprite index
+static u8 rotate_id;               // first sprite held back last frame
+
+// Multiplexed frames (oammux.h): entries live per line, writes per band
+static int mux_frame;
+static u16 mux_live[SCREEN_H];
+static u8  band_writes[SCREEN_H / MUX_BAND_LINES];
+static s16 mux_first[SPRITE_MAX];  // oammux index of each sorted sprite's first OBJ
+
+void sprite_init(void) {
+    memset(&sprite_stats, 0, sizeof(sprite_stats));
+    memset(idx_of_id, 0xFF, sizeof(idx_of_id));
+    prev_count = 0;
+    prev_objs = 0;
+    submit_objs = 0;
+    shown_objs = 0;
+    num_sprites = 0;
+    rotate_id = SPRITE_NO_ID;
+}
+
+void sprite_begin(void) {
+    num_sprites = 0;
+}
+
+void sprite_add(int id, u16 key, u16 attr0, u16 attr1, u16 attr2) {
+    if (num_sprites >= SPRITE_MAX) {
+        sprite_stats.dropped++;
+        return;
+    }
+    int j = num_sprites++;
+    spr_key[j] = key;
+    spr_id[j] = (u8)id;
+    spr_attr0[j] = attr0;
+    spr_attr1[j] = attr1;
+    spr_attr2[j] = attr2;
+    spr_pieces[j] = 0;
+    spr_objs[j] = 0;
+    idx_of_id[id] = (u8)j;
+}
+
+void sprite_add_meta(int id, u16 key, int x, int y, u16 attr0, u16 attr1, u16 attr2,
+                     const MetaPiece *pieces, int num_pieces) {
+    if (num_sprites >= SPRITE_MAX) {
+        sprite_stats.dropped++;
+        return;
+    }
+    int j = num_sprites++;
+    spr_key[j] = key;
+    spr_id[j] = (u8)id;
+    spr_attr0[j] = attr0;
+    spr_attr1[j] = attr1;
+    spr_attr2[j] = attr2;
+    spr_x[j] = (s16)x;
+    spr_y[j] = (s16)y;
+    spr_pieces[j] = pieces;
+    spr_objs[j] = 0;
+    spr_num_pieces[j] = (u8)num_pieces;
+    idx_of_id[id] = (u8)j;
+}
+
+void sprite_add_objs(int id, u16 key, const OBJ_ATTR *objs, int num_objs) {
+    if (num_sprites >= SPRITE_MAX) {
+        sprite_stats.dropped++;
+        return;
+    }
+    int j = num_sprites++;
+    spr_key[j] = key;
+    spr_id[j] = (u8)id;
+    spr_pieces[j] = 0;
+    spr_objs[j] = objs;
+    spr_num_pieces[j] = (u8)num_objs;
+    idx_of_id[id] = (u8)j;
+}
+
+void sprite_obj_size(u16 attr0, u16 attr1, int *w, int *h) {
+    *w = obj_w[attr0 >> 14][attr1 >> 14];
+    *h = obj_h[attr0 >> 14][attr1 >> 14];
+}
+
+static int num_objs(int j) {
+    return spr_pieces[j] || spr_objs[j] ? spr_num_pieces[j] : 1;
+}
+
+// ATTR0_HIDE doubles as the double-size bit of affine OBJs
+static inline int obj_hidden(u16 a0) {
+    return (a0 & (ATTR0_AFF | ATTR0_HIDE)) == ATTR0_HIDE;
+}
+
+// OAM attributes of OBJ q of sprite j; 0 if it is hidden
+static int sprite_obj(int j, int q, u16 *a0, u16 *a1, u16 *a2) {
+    const MetaPiece *p = spr_pieces[j];
+    if (spr_objs[j]) {
+        const OBJ_ATTR *o = &spr_objs[j][q];
+        *a0 = o->attr0;
+        *a1 = o->attr1;
+        *a2 = o->attr2;
+        return !obj_hidden(*a0);
+    }
+    if (!p) {
+        *a0 = spr_attr0[j];
+        *a1 = spr_attr1[j];
+        *a2 = spr_attr2[j];
+        return !obj_hidden(*a0);
+    }
+    p += q;
+    u16 b1 = spr_attr1[j];
+    int x = spr_x[j] + ((b1 & ATTR1_HFLIP) ? p->xf : p->x);
+    *a0 = spr_attr0[j] | p->attr0 | ATTR0_Y((spr_y[j] + p->y) & 0xFF);
+    *a1 = b1 | p->attr1 | ATTR1_X(x & 0x1FF);
+    *a2 = spr_attr2[j] + p->tile;
+    return 1;
+}
+
+// First and last screen line an OBJ covers (its y wraps at 256) and its
+// render cycles per line: its width, or 10 + twice the (possibly doubled)
+// width when affine. 0 if it covers none.
+static int obj_lines(u16 a0, u16 a1, int *cost, int *top, int *bottom) {
+    int w, h, y = a0 & 0xFF;
+    sprite_obj_size(a0, a1, &w, &h);
+    *cost = w;
+    if (a0 & ATTR0_AFF) {
+        if (a0 & ATTR0_HIDE) w *= 2, h *= 2;   // double size
+        *cost = 10 + 2 * w;
+    }
+    int end = y + h - 1;
+    if (y < SCREEN_H) *top = y;
+    else if (end >= 256) *top = 0, end -= 256;
+    else return 0;
+    *bottom = end < SCREEN_H ? end : SCREEN_H - 1;
+    return 1;
+}
+
+// Add (sign 1) or remove (sign -1) sprite j's OBJs from the line budgets;
+// returns nonzero when one is exceeded afterwards
+static int charge(int j, int sign) {
+    int budget = mux_frame ? SPRITE_LINE_CYCLES_HBL : SPRITE_LINE_CYCLES;
+    int over = 0;
+    for (int q = 0, n = num_objs(j); q < n; q++) {
+        u16 a0, a1, a2;
+        int cost, top, bottom;
+        if (!sprite_obj(j, q, &a0, &a1, &a2) || !obj_lines(a0, a1, &cost, &top, &bottom))
+            continue;
+        cost *= sign;
+        for (int l = top; l <= bottom; l++)
+            if ((sprite_lines[l] += cost) > budget) over = 1;
+        if (!mux_frame) continue;
+        // Multiplexed: the OBJ holds an entry from its band's write line
+        // until MUX_MARGIN lines after its last, and costs its band a write
+        int start = oammux_start_line(top);
+        int release = bottom + MUX_MARGIN;
+        if (release >= SCREEN_H) release = SCREEN_H - 1;
+        for (int l = start; l <= release; l++)
+            if ((mux_live[l] += sign) > MUX_OAM) over = 1;
+        if (start && (band_writes[top / MUX_BAND_LINES] += sign) > MUX_BAND_WRITES)
+            over = 1;
+    }
+    return over;
+}
+
+// Scanline and OAM budget over the sorted order: kept sprites first, then
+// the rest round-robin from last frame's first casualty. Returns sprites
+// held back.
+static u32 budget_lines(int m) {
+    memset(sprite_lines, 0, sizeof(sprite_lines));
+    memset(mux_live, 0, sizeof(mux_live));
+    memset(band_writes, 0, sizeof(band_writes));
+    int start = 0, objs = 0;
+    for (int k = 0; k < m; k++) {
+        int j = order[k];
+        admitted[j] = 0;
+        if (spr_id[j] == rotate_id) start = k;
+        if (!SPRITE_KEPT(spr_id[j])) continue;
+        admitted[j] = 1;
+        objs += num_objs(j);
+        if (charge(j, 1)) sprite_stats.kept_over++;
+    }
+    u32 culled = 0;
+    int first_out = SPRITE_NO_ID;
+    for (int t = 0, k = start; t < m; t++, k = (k + 1 == m) ? 0 : k + 1) {
+        int j = order[k];
+        if (SPRITE_KEPT(spr_id[j])) continue;
+        if (mux_frame || objs + num_objs(j) <= SPRITE_OAM) {
+            if (!charge(j, 1)) {
+                admitted[j] = 1;
+                objs += num_objs(j);
+                continue;
+            }
+            charge(j, -1);
+        }
+        if (first_out == SPRITE_NO_ID) first_out = spr_id[j];
+        culled++;
+    }
+    rotate_id = (u8)first_out;
+    return culled;
+}
+
+int sprite_end(void) {
+    int n = num_sprites, m = 0;
+
+    // Seed with last frame's order; sprites new this frame go at the end
+    for (int k = 0; k < prev_count; k++) {
+        int id = prev_ids[k];
+        int j = idx_of_id[id];
+        if (j == SPRITE_NO_ID) continue;
+        order[m++] = (u8)j;
+        idx_of_id[id] = SPRITE_NO_ID;
+    }
+    int carried = m;
+    for (int j = 0; j < n; j++) {
+        if (idx_of_id[spr_id[j]] == SPRITE_NO_ID) continue;
+        order[m++] = (u8)j;
+        idx_of_id[spr_id[j]] = SPRITE_NO_ID;
+    }
+
+    // Stable insertion sort, descending key: nearly sorted input is ~O(n)
+    u32 shifts = 0;
+    for (int k = 1; k < m; k++) {
+        u8 j = order[k];
+        u16 key = spr_key[j];
+        int p = k;
+        while (p > 0 && spr_key[order[p - 1]] < key) {
+            order[p] = order[p - 1];
+            p--;
+        }
+        order[p] = j;
+        shifts += k - p;
+    }
+
+    // More OBJs than OAM: multiplex this frame if we can
+    int total = 0;
+    for (int k = 0; k < m; k++) total += num_objs(order[k]);
+    mux_frame = total > SPRITE_OAM && oammux_enabled();
+    oammux_begin();
+
+    u32 culled = budget_lines(m);
+
+    // Emit in one pass, expanding meta-sprites into their pieces, then hide
+    // entries the previous frame used
+    int o = 0;
+    u32 overflow = 0;
+    for (int k = 0; k < m; k++) {
+        int j = order[k];
+        prev_ids[k] = spr_id[j];
+        prev_obj[k] = SPRITE_NO_ID;
+        mux_first[k] = -1;
+        if (!admitted[j]) continue;
+        for (int q = 0, np = num_objs(j); q < np; q++) {
+            u16 a0, a1, a2;
+            int visible = sprite_obj(j, q, &a0, &a1, &a2);
+            if (mux_frame) {
+                int cost, top, bottom;
+                if (!visible || !obj_lines(a0, a1, &cost, &top, &bottom)) continue;
+                int i = oammux_add(a0, a1, a2, top, bottom);
+                if (mux_first[k] < 0) mux_first[k] = (s16)i;
+                o++;
+                continue;
+            }
+            if (o == SPRITE_OAM) {
+                overflow += np - q;
+                break;
+            }
+            if (q == 0) prev_obj[k] = (u8)o;
+            obj_buffer[o].attr0 = a0;
+            obj_buffer[o].attr1 = a1;
+            obj_buffer[o].attr2 = a2;
+            o++;
+        }
+    }
+    u32 objs = o;
+    if (mux_frame) {
+        o = oammux_build(obj_buffer);
+        for (int k = 0; k < m; k++) {
+            int e = oammux_entry(mux_first[k]);
+            if (e >= 0) prev_obj[k] = (u8)e;
+        }
+    }
+    int shown = shown_objs;
+    int hide = prev_objs > shown ? prev_objs : shown;
+    for (int k = o; k < hide; k++)
+        obj_buffer[k].attr0 = ATTR0_HIDE;
+
+    int copy = o > shown ? o : shown;
+    prev_count = m;
+    prev_objs = o;
+    submit_objs = o;
+
+    SpriteStats *ss = &sprite_stats;
+    ss->frames++;
+    ss->count = m;
+    ss->objs = objs;
+    ss->obj_overflow += overflow;
+    u32 peak = 0;
+    for (int l = 0; l < SCREEN_H; l++)
+        if (sprite_lines[l] > peak) peak = sprite_lines[l];
+    ss->line_peak = peak;
+    ss->culled = culled;
+    ss->culled_total += culled;
+    ss->cull_frames += culled != 0;
+    ss->mux_frames += mux_frame;
+    ss->shifts = shifts;
+    if (shifts > ss->shifts_max) ss->shifts_max = shifts;
+    ss->new_ids = m - carried;
+    return copy;
+}
+
+void sprite_commit(void) {
+    shown_objs = submit_objs;
+}
+
+int sprite_slot(int id) {
+    for (int k = 0; k < prev_count; k++)
+        if (prev_ids[k] == id) return prev_obj[k] < SPRITE_OAM ? prev_obj[k] : -1;
+    return -1;
+}
+
+//=============================================================================
+// Occlusion against BG0
+//=============================================================================
+int sprite_bg_prio(int col, int row, int height, int world_y) {
+    // Check the cells one and two diagonals in front (toward the camera);
+    // if one is taller and its top reaches the sprite's feet, draw the
+    // sprite behind BG0 (BG is prio 1)
+    for (int dd = 1; dd <= 2; dd++) {
+        for (int dr = -1; dr <= 1; dr++) {
+            int fc = col + dd - dr;   // keeps fc + fr = col + row + dd
+            int fr = row + dr;
+            MapCell *front = get_map_cell(world_map, fc, fr);
+            if (front && front->height > height) {
+                int fwx, fwy;
+                iso_tile_to_world(fc, fr, &fwx, &fwy);
+                int ftop_y = fwy - front->height * SIDE_HEIGHT;
+                if (ftop_y <= world_y - height * SIDE_HEIGHT + 8)
+                    return 2;
+            }
+        }
+    }
+    return 0;
+}
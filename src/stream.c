@@ -0,0 +1,248 @@
+// stream.c — VRAM upload and 64×64 hardware tilemap ring buffer
+#include "stream.h"
+#include "compose.h"
+#include <string.h>
+
+// Ring buffer tracking
+int loaded_col_min, loaded_row_min;
+int stream_prefetch = 8;
+u32 stream_lines;
+
+// BG sets: set 0 at boot, the other staged for the next transition
+const u8 stream_cbb[TILE_SETS] = { TILE_CBB, TILE_CBB_ALT };
+const u8 stream_sbb[TILE_SETS] = { TILE_SBB, TILE_SBB_ALT };
+int stream_set;
+StreamStats stream_stats;
+int stream_stage_tiles = STAGE_TILES;
+int stream_stage_cols = STAGE_COLS;
+
+// Staging progress in the hidden set
+static int staging;
+static int stage_tile;                      // next dictionary tile
+static int stage_col;                       // next ring column, 0..64
+static int stage_col_min, stage_row_min;    // its ring window
+
+//=============================================================================
+// Upload tile dictionary to VRAM as 8bpp tiles
+//=============================================================================
+static void copy_tiles(int set, int first, int end) {
+    // Each 8bpp tile = 64 bytes = 16 words
+    u32 *dst = (u32 *)&tile_mem[stream_cbb[set]][0];
+    for (int t = first; t < end; t++) {
+        const u8 *src = tile_dict[t];
+        u32 *d = &dst[t * 16];
+        for (int i = 0; i < 16; i++) {
+            const u8 *s = &src[i * 4];
+            d[i] = s[0] | (s[1] << 8) | (s[2] << 16) | (s[3] << 24);
+        }
+    }
+}
+
+void upload_tiles_to_vram(void) {
+    // Boot: set 0 is shown, nothing staged
+    stream_set = 0;
+    staging = 0;
+    memset(&stream_stats, 0, sizeof(stream_stats));
+    upload_tiles_from(0);
+}
+
+void upload_tiles_from(int first) {
+    copy_tiles(stream_set, first, num_tiles);
+    // A set being staged picks the new tiles up on its next slice
+    if (staging && stage_tile > first) stage_tile = first;
+}
+
+//=============================================================================
+// Hardware screenblock helpers
+//=============================================================================
+static inline void hw_write_entry(int set, int hc, int hr, u16 tid) {
+    int sb = (hc >> 5) + (hr >> 5) * 2;
+    ((u16 *)se_mem[stream_sbb[set] + sb])[(hr & 31) * 32 + (hc & 31)] = tid;
+}
+
+static void fill_col(int set, int wtc, int row_min) {
+    int hc = wtc & 63;
+    for (int i = 0; i < 64; i++) {
+        int wtr = row_min + i;
+        u16 tid = 0;
+        if (wtc >= 0 && wtc < WORLD_TILE_W && wtr >= 0 && wtr < WORLD_TILE_H)
+            tid = world_tilemap[wtr * WORLD_TILE_W + wtc];
+        hw_write_entry(set, hc, wtr & 63, tid);
+    }
+}
+
+static void load_hw_col(int wtc) {
+    fill_col(stream_set, wtc, loaded_row_min);
+}
+
+static void load_hw_row(int wtr) {
+    int hr = wtr & 63;
+    for (int i = 0; i < 64; i++) {
+        int wtc = loaded_col_min + i;
+        u16 tid = 0;
+        if (wtc >= 0 && wtc < WORLD_TILE_W && wtr >= 0 && wtr < WORLD_TILE_H)
+            tid = world_tilemap[wtr * WORLD_TILE_W + wtc];
+        hw_write_entry(stream_set, wtc & 63, hr, tid);
+    }
+}
+
+static void load_hw_full(void) {
+    for (int i = 0; i < 64; i++)
+        load_hw_col(loaded_col_min + i);
+}
+
+//=============================================================================
+// Runtime: update hardware tilemap ring buffer as camera scrolls
+//=============================================================================
+static void step_col(int dir) {
+    if (dir > 0) { load_hw_col(loaded_col_min + 64); loaded_col_min++; }
+    else         { loaded_col_min--; load_hw_col(loaded_col_min); }
+    stream_lines++;
+}
+
+static void step_row(int dir) {
+    if (dir > 0) { load_hw_row(loaded_row_min + 64); loaded_row_min++; }
+    else         { loaded_row_min--; load_hw_row(loaded_row_min); }
+    stream_lines++;
+}
+
+void update_hw_tilemap(int cam_wx, int cam_wy) {
+    // Visible tile range (floor division: the window may be off-world)
+    int vis_c0 = (cam_wx - WORLD_PX_X0 - SCREEN_W / 2) >> 3;
+    int vis_c1 = (cam_wx - WORLD_PX_X0 + SCREEN_W / 2 - 1) >> 3;
+    int vis_r0 = (cam_wy - WORLD_PX_Y0 - SCREEN_H / 2) >> 3;
+    int vis_r1 = (cam_wy - WORLD_PX_Y0 + SCREEN_H / 2 - 1) >> 3;
+
+    // Required: the ring must cover every visible tile this frame
+    while (loaded_col_min > vis_c0)      step_col(-1);
+    while (loaded_col_min + 63 < vis_c1) step_col(+1);
+    while (loaded_row_min > vis_r0)      step_row(-1);
+    while (loaded_row_min + 63 < vis_r1) step_row(+1);
+
+    // Prefetch: move towards the camera-centred window. The window is not
+    // clamped to the world: near the edges it covers off-world tiles
+    // (loaded as 0) so the ring never wraps visible tiles from the far
+    // side of the window onto the screen. Every position between a
+    // covering one and the centred one also covers the screen.
+    int desired_col = ((vis_c0 + vis_c1 + 1) >> 1) - 32;
+    int desired_row = ((vis_r0 + vis_r1 + 1) >> 1) - 32;
+    for (int budget = stream_prefetch; budget > 0; budget--) {
+        int dc = desired_col - loaded_col_min;
+        int dr = desired_row - loaded_row_min;
+        if (dc == 0 && dr == 0) break;
+        int adc = dc < 0 ? -dc : dc, adr = dr < 0 ? -dr : dr;
+        if (adc >= adr) step_col(dc > 0 ? 1 : -1);
+        else            step_row(dr > 0 ? 1 : -1);
+    }
+}
+
+//=============================================================================
+// Recomposited tiles: rewrite the ones the ring holds
+//=============================================================================
+// Ring entries of `set` (window col_min/row_min, its first `cols` columns)
+// inside the rectangle
+static int refresh_set(int set, const ComposeRect *rect, int col_min, int row_min, int cols) {
+    int written = 0;
+    for (int wtr = rect->r0; wtr < rect->r1; wtr++) {
+        if (wtr < row_min || wtr >= row_min + 64) continue;
+        for (int wtc = rect->c0; wtc < rect->c1; wtc++) {
+            if (wtc < col_min || wtc >= col_min + cols) continue;
+            hw_write_entry(set, wtc & 63, wtr & 63, world_tilemap[wtr * WORLD_TILE_W + wtc]);
+            written++;
+        }
+    }
+    return written;
+}
+
+int stream_refresh(const ComposeRect *rect) {
+    int written = refresh_set(stream_set, rect, loaded_col_min, loaded_row_min, 64);
+    // Columns already staged in the hidden set hold the old entries too
+    if (staging)
+        written += refresh_set(stream_set ^ 1, rect, stage_col_min, stage_row_min, stage_col);
+    return written;
+}
+
+//=============================================================================
+// Initial hw tilemap load centered on the camera
+//=============================================================================
+void stream_init(int cam_wx, int cam_wy) {
+    int init_tc = (cam_wx - WORLD_PX_X0) / 8;
+    int init_tr = (cam_wy - WORLD_PX_Y0) / 8;
+    loaded_col_min = init_tc - 32;
+    loaded_row_min = init_tr - 32;
+    load_hw_full();
+}
+
+//=============================================================================
+// Staging: build the next view in the hidden set, then swap sets
+//=============================================================================
+void stream_stage(int cam_wx, int cam_wy) {
+    staging = 1;
+    stage_tile = 0;
+    stage_col = 0;
+    stage_col_min = (cam_wx - WORLD_PX_X0) / 8 - 32;
+    stage_row_min = (cam_wy - WORLD_PX_Y0) / 8 - 32;
+    stream_stats.stages++;
+}
+
+int stream_staged(void) {
+    return staging && stage_tile >= num_tiles && stage_col >= 64;
+}
+
+int stream_stage_step(void) {
+    if (!staging) {
+        stream_stats.cycles = 0;
+        return 0;
+    }
+    int hidden = stream_set ^ 1;
+    int end = stage_tile + stream_stage_tiles;
+    if (end > num_tiles) end = num_tiles;
+    int tiles = end > stage_tile ? end - stage_tile : 0;
+    copy_tiles(hidden, stage_tile, end);
+    stage_tile += tiles;
+    int cols = 0;
+    for (; cols < stream_stage_cols && stage_col < 64; cols++, stage_col++)
+        fill_col(hidden, stage_col_min + stage_col, stage_row_min);
+
+    StreamStats *st = &stream_stats;
+    st->cycles = tiles * STAGE_TILE_CYCLES + cols * STAGE_COL_CYCLES;
+    if (st->cycles > st->cycles_peak) st->cycles_peak = st->cycles;
+    if (tiles || cols) st->stage_frames++;
+    st->stage_tiles += tiles;
+    st->stage_cols += cols;
+    return stream_staged();
+}
+
+u16 stream_flip(void) {
+    if (stream_staged()) {
+        stream_set ^= 1;
+        loaded_col_min = stage_col_min;
+        loaded_row_min = stage_row_min;
+        staging = 0;
+        stream_stats.flips++;
+    }
+    return stream_bg0cnt();
+}
+
+u16 stream_bg0cnt(void) {
+    return BG_CBB(stream_cbb[stream_set]) | BG_SBB(stream_sbb[stream_set]) |
+           BG_8BPP | BG_SIZE3 | BG_PRIO(1);
+}
+
+//=============================================================================
+// BG0 scroll: put camera world pixel (cam_wx, cam_wy) at screen center
+//=============================================================================
+void stream_scroll(int cam_wx, int cam_wy, u16 *hofs, u16 *vofs) {
+    int scroll_x = cam_wx - WORLD_PX_X0 - SCREEN_W / 2;
+    int scroll_y = cam_wy - WORLD_PX_Y0 - SCREEN_H / 2;
+    *hofs = scroll_x & 0x1FF;
+    *vofs = scroll_y & 0x1FF;
+}
+
+// Immediate register write (tools); the game commits via present_submit()
+void stream_set_scroll(int cam_wx, int cam_wy) {
+    u16 hofs, vofs;
+    stream_scroll(cam_wx, cam_wy, &hofs, &vofs);
+    REG_BG0HOFS = hofs;
+    REG_BG0VOFS = vofs;
+}
@@ -0,0 +1,56 @@
+// timing.c — Fixed-timestep frame clock
+#include "timing.h"
+
+FrameStats frame_stats;
+volatile u32 vblank_count;
+
+static u32 consumed;        // VBlanks already turned into logic steps
+static int skipped_in_row;
+
+void timing_init(void) {
+    memset(&frame_stats, 0, sizeof(frame_stats));
+    consumed = vblank_count;
+    skipped_in_row = 0;
+    REG_TM2CNT = 0;
+    REG_TM3CNT = 0;
+    REG_TM2D = 0;
+    REG_TM3D = 0;
+    REG_TM3CNT = TM_ENABLE | TM_CASCADE;
+    REG_TM2CNT = TM_ENABLE | TM_FREQ_1;
+}
+
+void timing_vblank(void) {
+    vblank_count++;
+}
+
+int timing_steps_due(void) {
+    u32 now = vblank_count;
+    if (now == consumed) {
+        VBlankIntrWait();
+        now = vblank_count;
+    }
+    u32 due = now - consumed;
+    consumed = now;
+
+    frame_stats.last_due = due;
+    if (due > 1) frame_stats.overruns++;
+    if (due > MAX_CATCHUP_STEPS) {
+        // Too far behind to catch up: drop the excess (the game slows down
+        // for this stall) rather than spend every frame on logic
+        frame_stats.dropped += due - MAX_CATCHUP_STEPS;
+        due = MAX_CATCHUP_STEPS;
+    }
+    frame_stats.steps += due;
+    return (int)due;
+}
+
+int timing_render_due(void) {
+    if (vblank_count != consumed && skipped_in_row < MAX_SKIPPED_RENDERS) {
+        skipped_in_row++;
+        frame_stats.skipped++;
+        return 0;
+    }
+    skipped_in_row = 0;
+    frame_stats.renders++;
+    return 1;
+}
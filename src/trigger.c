@@ -0,0 +1,165 @@
+// trigger.c — Trigger zones along the strip: column-bucketed ROM index
+#include "trigger.h"
+#include "player.h"
+#include "particle.h"
+#include "sound.h"
+#include "../data/triggers.h"
+#include "../data/sounds.h"
+#include <string.h>
+
+TriggerStats trigger_stats;
+TriggerEvent trigger_events[TRIG_EVENTS_MAX];
+int trigger_num_events;
+int trigger_zone;
+int trigger_checkpoint_col, trigger_checkpoint_row;
+
+// Cursor: the player's bucket and its ROM list
+static int cursor;
+static const u8 *cur_ids;
+static int cur_count;
+
+static int last_col, last_row;
+static u8 inside[TRIG_INSIDE_MAX];
+static int num_inside;
+static u32 inside_bits[(TRIG_COUNT + 31) / 32];
+static u32 fired_bits[(TRIG_COUNT + 31) / 32];
+
+#define BIT_TEST(a, k)   ((a)[(k) >> 5] & (1u << ((k) & 31)))
+#define BIT_SET(a, k)    ((a)[(k) >> 5] |= 1u << ((k) & 31))
+#define BIT_CLR(a, k)    ((a)[(k) >> 5] &= ~(1u << ((k) & 31)))
+
+static inline int contains(const TriggerDef *t, int col, int row) {
+    return col >= t->col_lo && col <= t->col_hi && row >= t->row_lo && row <= t->row_hi;
+}
+
+static void set_cursor(int col) {
+    int b = col >> TRIG_BUCKET_SHIFT;
+    if (b >= TRIG_BUCKETS) {
+        // Host benchmark maps run past the compiled strip
+        cursor = b;
+        cur_count = 0;
+        return;
+    }
+    cursor = b;
+    cur_ids = &trigBucketIds[trigBucketStart[b]];
+    cur_count = trigBucketStart[b + 1] - trigBucketStart[b];
+    if ((u32)cur_count > trigger_stats.bucket_peak) trigger_stats.bucket_peak = cur_count;
+}
+
+void trigger_init(void) {
+    memset(&trigger_stats, 0, sizeof(trigger_stats));
+    memset(inside_bits, 0, sizeof(inside_bits));
+    memset(fired_bits, 0, sizeof(fired_bits));
+    num_inside = 0;
+    trigger_num_events = 0;
+    trigger_zone = ZONE_MEADOW;
+    trigger_checkpoint_col = player.tile_col;
+    trigger_checkpoint_row = player.tile_row;
+    last_col = last_row = -1;
+    cur_ids = trigBucketIds;
+    set_cursor(0);
+}
+
+//=============================================================================
+// Events
+//=============================================================================
+static void emit(int id, int edge) {
+    trigger_stats.events++;
+    if (trigger_num_events == TRIG_EVENTS_MAX) {
+        trigger_stats.dropped++;
+        return;
+    }
+    trigger_events[trigger_num_events].id = (u8)id;
+    trigger_events[trigger_num_events].edge = (u8)edge;
+    trigger_num_events++;
+}
+
+// Built-in reactions; cutscene events are left to their consumers
+static void enter(int id, int col, int row) {
+    const TriggerDef *t = &trigDefs[id];
+    switch (t->kind) {
+    case TRIG_ZONE:
+        trigger_zone = t->arg;
+        break;
+    case TRIG_CHECKPOINT:
+        trigger_checkpoint_col = col;
+        trigger_checkpoint_row = row;
+        break;
+    case TRIG_PICKUP:
+        particle_effect(FX_SPARKS, col, row, player.height, player.facing);
+        sound_sfx(SFX_CHIME);
+        break;
+    }
+}
+
+//=============================================================================
+// Update
+//=============================================================================
+void trigger_update(int col, int row) {
+    trigger_num_events = 0;
+    if (col == last_col && row == last_row) return;
+    last_col = col;
+    last_row = row;
+    TriggerStats *ts = &trigger_stats;
+    ts->updates++;
+    ts->naive += TRIG_COUNT;
+
+    // Exits: only the rectangles the player was inside
+    for (int k = 0; k < num_inside; ) {
+        int id = inside[k];
+        ts->tests++;
+        if (contains(&trigDefs[id], col, row)) {
+            k++;
+            continue;
+        }
+        inside[k] = inside[--num_inside];
+        BIT_CLR(inside_bits, id);
+        emit(id, TRIG_EXIT);
+    }
+
+    // Enters: the cursor's bucket, sorted by first column
+    if ((col >> TRIG_BUCKET_SHIFT) != cursor) set_cursor(col);
+    for (int k = 0; k < cur_count; k++) {
+        int id = cur_ids[k];
+        const TriggerDef *t = &trigDefs[id];
+        if (t->col_lo > col) break;
+        if (BIT_TEST(inside_bits, id)) continue;
+        if ((t->flags & TRIG_ONCE) && BIT_TEST(fired_bits, id)) continue;
+        ts->tests++;
+        if (!contains(t, col, row)) continue;
+        if (num_inside == TRIG_INSIDE_MAX) {
+            ts->dropped++;
+            continue;
+        }
+        inside[num_inside++] = (u8)id;
+        BIT_SET(inside_bits, id);
+        BIT_SET(fired_bits, id);
+        emit(id, TRIG_ENTER);
+        enter(id, col, row);
+    }
+}
+
+int trigger_fired(int id) {
+    return BIT_TEST(fired_bits, id) != 0;
+}
+
+void trigger_mark_fired(int id) {
+    BIT_SET(fired_bits, id);
+}
+
+int trigger_verify(int col, int row) {
+    int bad = 0;
+    for (int id = 0; id < TRIG_COUNT; id++) {
+        const TriggerDef *t = &trigDefs[id];
+        int in = BIT_TEST(inside_bits, id) != 0;
+        int should = contains(t, col, row);
+        // A once-only trigger fired earlier stays quiet on re-entry
+        if (should && !in && (t->flags & TRIG_ONCE) && BIT_TEST(fired_bits, id))
+            continue;
+        bad += in != should;
+    }
+    int listed = 0;
+    for (int k = 0; k < num_inside; k++)
+        listed += BIT_TEST(inside_bits, inside[k]) != 0;
+    return bad || listed != num_inside;
+}
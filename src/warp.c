@@ -0,0 +1,109 @@
+// warp.c — Zone transitions: staged BG set, one-register flip at VBlank
+#include "warp.h"
+#include "stream.h"
+#include "player.h"
+#include "world.h"
+#include "present.h"
+#include <string.h>
+
+WarpStats warp_stats;
+int warp_state;
+
+static int dest_col, dest_row;
+static int mask;
+static int level;               // mask closed this far, 0..WARP_MASK_FRAMES
+static u32 steps;
+
+void warp_init(void) {
+    memset(&warp_stats, 0, sizeof(warp_stats));
+    warp_state = WARP_IDLE;
+    level = 0;
+}
+
+// Where camera_update() settles with the player standing on the destination
+static void dest_camera(int *cam_wx, int *cam_wy) {
+    int wx, wy;
+    iso_tile_to_world(dest_col, dest_row, &wx, &wy);
+    *cam_wx = wx;
+    *cam_wy = wy - world_map[dest_row][dest_col].height * SIDE_HEIGHT;
+}
+
+int warp_start(int col, int row, int how) {
+    if (warp_state != WARP_IDLE) {
+        warp_stats.refused++;
+        return 0;
+    }
+    dest_col = col;
+    dest_row = row;
+    mask = how;
+    int cam_wx, cam_wy;
+    dest_camera(&cam_wx, &cam_wy);
+    stream_stage(cam_wx, cam_wy);
+    warp_state = WARP_STAGING;
+    steps = 0;
+    warp_stats.stage_frames = 0;
+    return 1;
+}
+
+// Behind the closed mask: move the player and camera, swap BG sets
+static void arrive(void) {
+    int wx, wy;
+    iso_tile_to_world(dest_col, dest_row, &wx, &wy);
+    player.world_x = INT2FP(wx);
+    player.world_y = INT2FP(wy);
+    player.tile_col = dest_col;
+    player.tile_row = dest_row;
+    player.height = world_map[dest_row][dest_col].height;
+    player.moving = 0;
+    player.jumping = player.jump_timer = player.jump_visual_dy = 0;
+    player.falling = player.fall_timer = player.fall_visual_dy = 0;
+    camera.x = player.world_x;
+    camera.y = player.world_y - INT2FP(player.height * SIDE_HEIGHT);
+    stream_flip();
+}
+
+void warp_update(void) {
+    if (warp_state == WARP_IDLE) return;
+    steps++;
+    switch (warp_state) {
+    case WARP_STAGING:
+        if (!stream_staged()) break;
+        if (mask == WARP_CUT) {
+            arrive();
+            warp_state = WARP_OPENING;
+        } else {
+            warp_state = WARP_CLOSING;
+        }
+        break;
+    case WARP_CLOSING:
+        if (++level < WARP_MASK_FRAMES) break;
+        arrive();
+        warp_state = WARP_OPENING;
+        break;
+    case WARP_OPENING:
+        if (level > 0) {
+            level--;
+            break;
+        }
+        warp_state = WARP_IDLE;
+        warp_stats.warps++;
+        warp_stats.steps = steps;
+        break;
+    }
+}
+
+void warp_render(void) {
+    stream_stage_step();
+    if (stream_stats.cycles) warp_stats.stage_frames++;
+    u16 bg0cnt = stream_bg0cnt();
+    u16 mosaic = 0, bldcnt = 0, bldy = 0;
+    if (level && mask == WARP_MOSAIC) {
+        int size = level * 15 / WARP_MASK_FRAMES;
+        bg0cnt |= BG_MOSAIC;
+        mosaic = MOS_BH(size) | MOS_BV(size);
+    } else if (level && mask == WARP_FADE) {
+        bldcnt = BLD_BG0 | BLD_OBJ | BLD_BD | BLD_BLACK;
+        bldy = level * 16 / WARP_MASK_FRAMES;
+    }
+    present_display(bg0cnt, mosaic, bldcnt, bldy);
+}
@@ -0,0 +1,189 @@
+// world.c — World map and procedural generation
+#include "world.h"
+
+MapCell world_map[MAP_ROWS][MAP_COLS];
+
+//=============================================================================
+// RNG
+//=============================================================================
+u32 rng_state = 0xDEADBEEF;
+u32 rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+//=============================================================================
+// World generation with height
+//=============================================================================
+void generate_world(void) {
+    // Default: flat grass at height 1
+    for (int r = 0; r < MAP_ROWS; r++) {
+        for (int c = 0; c < MAP_COLS; c++) {
+            world_map[r][c].ground = GROUND_GRASS;
+            world_map[r][c].side = SIDE_GRASS;
+            world_map[r][c].height = 1;
+        }
+    }
+
+    // === ROAD: stone path through center ===
+    for (int c = 0; c < MAP_COLS; c++) {
+        int road_center = 7 + ((c * 3 + c / 7) % 4) - 1;
+        for (int r = 0; r < MAP_ROWS; r++) {
+            int dist = r - road_center;
+            if (dist < 0) dist = -dist;
+            if (dist <= 1) {
+                world_map[r][c].ground = GROUND_STONE;
+                world_map[r][c].side = SIDE_STONE;
+            }
+        }
+    }
+
+    // === HILLS: rolling terrain (height 2-3) ===
+    // Hill cluster 1: cols 10-25, rows 0-5
+    for (int c = 10; c <= 25; c++) {
+        for (int r = 0; r <= 5; r++) {
+            int dc = c - 17, dr = r - 2;
+            int d2 = dc * dc + dr * dr * 2;
+            if (d2 < 20) {
+                world_map[r][c].height = (d2 < 8) ? 3 : 2;
+            }
+        }
+    }
+
+    // Hill cluster 2: cols 55-70, rows 0-6
+    for (int c = 55; c <= 70; c++) {
+        for (int r = 0; r <= 6; r++) {
+            int dc = c - 62, dr = r - 3;
+            int d2 = dc * dc + dr * dr * 2;
+            if (d2 < 30) {
+                world_map[r][c].height = (d2 < 10) ? 3 : 2;
+            }
+        }
+    }
+
+    // Hill cluster 3: cols 120-135, rows 10-15
+    for (int c = 120; c <= 135; c++) {
+        for (int r = 10; r <= 15; r++) {
+            int dc = c - 127, dr = r - 12;
+            int d2 = dc * dc + dr * dr * 2;
+            if (d2 < 25) {
+                world_map[r][c].height = (d2 < 8) ? 3 : 2;
+            }
+        }
+    }
+
+    // === RIVER VALLEY: cols 40-55, height 0 with water ===
+    for (int c = 38; c <= 57; c++) {
+        int river_center = 4 + ((c - 38) * 6) / 20;
+        for (int r = 0; r < MAP_ROWS; r++) {
+            int dist = r - river_center;
+            if (dist < 0) dist = -dist;
+            if (dist <= 2) {
+                world_map[r][c].height = 0;
+                world_map[r][c].ground = GROUND_WATER;
+                world_map[r][c].side = SIDE_DIRT;
+            } else if (dist == 3) {
+                world_map[r][c].ground = GROUND_DIRT;
+                world_map[r][c].side = SIDE_DIRT;
+            }
+        }
+    }
+
+    // === LAKE: cols 100-115, rows 8-14, height 0 ===
+    for (int c = 100; c <= 115; c++) {
+        for (int r = 8; r <= 14; r++) {
+            int dc = c - 107, dr = r - 11;
+            int d2 = dc * dc + dr * dr * 3;
+            if (d2 <= 35) {
+                world_map[r][c].height = 0;
+                world_map[r][c].ground = GROUND_WATER;
+                world_map[r][c].side = SIDE_DIRT;
+            }
+        }
+    }
+
+    // === FORTRESS: cols 150-170, rows 3-12, brick walls + roof ===
+    for (int c = 150; c <= 170; c++) {
+        for (int r = 3; r <= 12; r++) {
+            int on_wall = 0;
+            // Outer walls
+            if (r == 3 || r == 12) on_wall = 1;
+            if (c == 150 || c == 170) on_wall = 1;
+
+            if (on_wall) {
+                world_map[r][c].ground = GROUND_ROOF;
+                world_map[r][c].side = SIDE_BRICK;
+                world_map[r][c].height = 4;
+            } else if (c >= 152 && c <= 168 && r >= 5 && r <= 10) {
+                // Inner courtyard floor - stone at height 2
+                world_map[r][c].ground = GROUND_STONE;
+                world_map[r][c].side = SIDE_STONE;
+                world_map[r][c].height = 2;
+            }
+
+            // Corner towers (even higher)
+            if ((c >= 149 && c <= 151 && (r >= 2 && r <= 4)) ||
+                (c >= 169 && c <= 171 && (r >= 2 && r <= 4)) ||
+                (c >= 149 && c <= 151 && (r >= 11 && r <= 13)) ||
+                (c >= 169 && c <= 171 && (r >= 11 && r <= 13))) {
+                world_map[r][c].ground = GROUND_ROOF;
+                world_map[r][c].side = SIDE_BRICK;
+                world_map[r][c].height = 4;
+            }
+
+            // Main hall inside fortress
+            if (c >= 155 && c <= 165 && r >= 6 && r <= 9) {
+                world_map[r][c].ground = GROUND_ROOF;
+                world_map[r][c].side = SIDE_BRICK;
+                world_map[r][c].height = 3;
+            }
+        }
+    }
+
+    // === DIRT PATCHES: cols 80-95 ===
+    for (int c = 80; c <= 95; c++) {
+        for (int r = 0; r < MAP_ROWS; r++) {
+            rng_state = (u32)(c * 31 + r * 97 + 12345);
+            rng_next();
+            if ((rng_next() % 100) < 50 && world_map[r][c].ground == GROUND_GRASS) {
+                world_map[r][c].ground = GROUND_DIRT;
+                world_map[r][c].side = SIDE_DIRT;
+            }
+        }
+    }
+
+    // === STONE RUINS: cols 175-195 ===
+    for (int c = 175; c <= 195; c++) {
+        for (int r = 0; r < MAP_ROWS; r++) {
+            if (r == 3 || r == 12) {
+                world_map[r][c].ground = GROUND_STONE;
+                world_map[r][c].side = SIDE_STONE;
+                world_map[r][c].height = 2;
+            }
+            if ((c == 175 || c == 195) && r >= 3 && r <= 12) {
+                world_map[r][c].ground = GROUND_STONE;
+                world_map[r][c].side = SIDE_STONE;
+                world_map[r][c].height = 2;
+            }
+            if (c >= 180 && c <= 190 && r >= 5 && r <= 10) {
+                world_map[r][c].ground = GROUND_STONE;
+                world_map[r][c].side = SIDE_STONE;
+                world_map[r][c].height = 3;
+            }
+        }
+    }
+
+    // === Small pond near start ===
+    for (int c = 5; c <= 10; c++) {
+        for (int r = 1; r <= 4; r++) {
+            int dc = c - 7, dr = r - 2;
+            if (dc * dc + dr * dr <= 4) {
+                world_map[r][c].height = 0;
+                world_map[r][c].ground = GROUND_WATER;
+                world_map[r][c].side = SIDE_DIRT;
+            }
+        }
+    }
+}
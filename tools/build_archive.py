@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""Pack runtime-loaded assets into one indexed ROM archive.
+
+The archive is a header (magic, count), an index of 16-byte entries (id,
+compression, offset, stored size, unpacked size; include/asset.h) and the
+asset data, each 4-byte aligned, addressed in place by the runtime. Every
+asset is stored raw, BIOS LZ77 (type 0x10, VRAM-safe: no 1-byte
+displacements) or BIOS RLE (type 0x30), whichever is smallest, unless it is
+marked in-place (read directly from ROM, so always raw). None of the current
+assets has runs long enough for RLE to beat LZ77, so every packed one is
+LZ77; the RLE path is there for run-heavy data.
+
+Inputs are the converters' generated arrays (data/fx.c, data/anim_hero.c,
+data/metatiles.c); zone palettes are tints of the metatile palette. Each
+zone lists the assets it loads on entry. Outputs data/archive.c/.h.
+"""
+import os
+import re
+import struct
+
+DATA_DIR = os.path.join(os.path.dirname(__file__), '..', 'data')
+OUT_DIR = DATA_DIR
+
+MAGIC = 0x31435241                   # "ARC1"
+RAW, LZ77, RLE = 0, 1, 2
+BG_COLOR = (2, 2, 5)                 # palette index 0: the backdrop
+
+# Zones in ZONE_* order (include/trigger.h), with an RGB tint for the terrain
+ZONES = [
+    ('meadow',    (1.00, 1.00, 1.00)),
+    ('river',     (0.94, 1.00, 1.06)),
+    ('hills',     (1.04, 1.00, 0.94)),
+    ('fields',    (1.08, 1.03, 0.88)),
+    ('lake',      (0.88, 0.97, 1.12)),
+    ('highlands', (0.96, 1.02, 1.04)),
+    ('fortress',  (0.84, 0.84, 0.92)),
+    ('ruins',     (1.02, 0.92, 0.84)),
+]
+
+
+def c_array(path, name):
+    """Bytes of a generated `const unsigned int/short/char name[] = {...}`."""
+    text = open(os.path.join(DATA_DIR, path)).read()
+    m = re.search(r'const unsigned (int|short|char) ' + name + r'\[[^\]]*\][^=]*=\s*\{(.*?)\};',
+                  text, re.S)
+    if not m:
+        raise SystemExit(f"{path}: no array {name}")
+    width = {'int': 4, 'short': 2, 'char': 1}[m.group(1)]
+    body = re.sub(r'//[^\n]*', '', m.group(2))
+    values = [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', body)]
+    return b''.join(v.to_bytes(width, 'little') for v in values)
+
+
+def tint(pal, k):
+    out = bytearray()
+    for i in range(0, len(pal), 2):
+        c = struct.unpack_from('<H', pal, i)[0]
+        rgb = (c & 31, (c >> 5) & 31, (c >> 10) & 31) if i else BG_COLOR
+        r, g, b = (min(31, round(v * f)) for v, f in zip(rgb, k))
+        out += struct.pack('<H', r | g << 5 | b << 10)
+    return bytes(out)
+
+
+def lz77(data):
+    """GBA BIOS LZ77, greedy; displacements of 2+ for 16-bit VRAM writes."""
+    out = bytearray(struct.pack('<I', 0x10 | len(data) << 8))
+    i = 0
+    while i < len(data):
+        flag_at = len(out)
+        out.append(0)
+        for bit in range(8):
+            if i >= len(data):
+                break
+            best_len, best_disp = 0, 0
+            for disp in range(2, min(4096, i) + 1):
+                n = 0
+                while n < 18 and i + n < len(data) and data[i + n] == data[i + n - disp]:
+                    n += 1
+                if n > best_len:
+                    best_len, best_disp = n, disp
+                    if n == 18:
+                        break
+            if best_len >= 3:
+                out[flag_at] |= 0x80 >> bit
+                v = (best_len - 3) << 12 | (best_disp - 1)
+                out += bytes((v >> 8, v & 0xFF))
+                i += best_len
+            else:
+                out.append(data[i])
+                i += 1
+    return bytes(out)
+
+
+def rle(data):
+    """GBA BIOS RLE: runs of 3..130, literal stretches of 1..128."""
+    out = bytearray(struct.pack('<I', 0x30 | len(data) << 8))
+    i, lit = 0, bytearray()
+    while i < len(data):
+        n = 1
+        while n < 130 and i + n < len(data) and data[i + n] == data[i]:
+            n += 1
+        if n >= 3:
+            if lit:
+                out += bytes((len(lit) - 1,)) + lit
+                lit = bytearray()
+            out += bytes((0x80 | (n - 3), data[i]))
+            i += n
+        else:
+            lit.append(data[i])
+            i += 1
+            if len(lit) == 128:
+                out += bytes((127,)) + lit
+                lit = bytearray()
+    if lit:
+        out += bytes((len(lit) - 1,)) + lit
+    return bytes(out)
+
+
+def pack(data, in_place):
+    best = (RAW, data)
+    if not in_place:
+        for comp, fn in ((LZ77, lz77), (RLE, rle)):
+            z = fn(data)
+            if len(z) < len(best[1]):
+                best = (comp, z)
+    return best
+
+
+def main():
+    mt_pal = c_array('metatiles.c', 'mt_palette')
+    # name, data, in place
+    assets = [
+        ('fx_tiles', c_array('fx.c', 'fxTiles'), False),
+        ('fx_pal',   c_array('fx.c', 'fxPal'), True),
+        ('hero_pal', c_array('anim_hero.c', 'anim_heroPal'), True),
+    ]
+    for zone, k in ZONES:
+        assets.append((f'pal_{zone}', tint(mt_pal, k), False))
+    # Per zone: (asset, destination, argument)
+    zone_loads = [[(f'pal_{zone}', 'ASSET_DST_BG_PAL', 0)] for zone, _ in ZONES]
+
+    ids = {name: i for i, (name, _, _) in enumerate(assets)}
+    index, blob = [], bytearray()
+    base = 8 + 16 * len(assets)
+    for i, (name, data, in_place) in enumerate(assets):
+        comp, stored = pack(data, in_place)
+        index.append((i, comp, base + len(blob), len(stored), len(data)))
+        blob += stored
+        blob += bytes(-len(blob) % 4)
+    archive = struct.pack('<IHH', MAGIC, len(assets), 0)
+    for i, comp, ofs, size, raw in index:
+        archive += struct.pack('<HBBIII', i, comp, 0, ofs, size, raw)
+    archive += blob
+    words = struct.unpack(f'<{len(archive) // 4}I', archive)
+
+    comp_name = {RAW: 'raw', LZ77: 'lz77', RLE: 'rle'}
+    with open(os.path.join(OUT_DIR, 'archive.c'), 'w') as f:
+        f.write('// Auto-generated by build_archive.py — DO NOT EDIT\n')
+        f.write('#include "archive.h"\n\n')
+        f.write(f'// {len(assets)} assets, {len(archive)} bytes '
+                f'({sum(a[4] for a in index)} unpacked)\n')
+        for (name, _, _), (i, comp, ofs, size, raw) in zip(assets, index):
+            f.write(f'//   {i:2} {name:14} {comp_name[comp]:5} {size:5} / {raw:5} bytes at {ofs}\n')
+        f.write(f'const unsigned int assetArchive[{len(words)}] __attribute__((aligned(4))) = {{\n')
+        for i in range(0, len(words), 8):
+            f.write('    ' + ','.join(f'0x{w:08X}' for w in words[i:i + 8]) + ',\n')
+        f.write('};\n\n')
+        f.write('const char *const assetNames[ASSET_COUNT] = {\n')
+        f.write(''.join(f'    "{name}",\n' for name, _, _ in assets))
+        f.write('};\n\n')
+        loads = [l for z in zone_loads for l in z]
+        f.write('// Zone z loads assetZoneLoads[assetZoneStart[z] .. assetZoneStart[z + 1])\n')
+        f.write('const AssetLoad assetZoneLoads[ASSET_ZONE_LOADS] = {\n')
+        for name, dst, arg in loads:
+            f.write(f'    {{ ASSET_{name.upper()}, {dst}, {arg} }},\n')
+        f.write('};\n\n')
+        starts = [0]
+        for z in zone_loads:
+            starts.append(starts[-1] + len(z))
+        f.write('const unsigned char assetZoneStart[NUM_ZONES + 1] = {\n')
+        f.write('    ' + ', '.join(str(s) for s in starts) + ',\n')
+        f.write('};\n')
+
+    with open(os.path.join(OUT_DIR, 'archive.h'), 'w') as f:
+        f.write('// Auto-generated by build_archive.py — DO NOT EDIT\n')
+        f.write('#ifndef ARCHIVE_H\n#define ARCHIVE_H\n\n#include "asset.h"\n#include "trigger.h"\n\n')
+        for name, i in ids.items():
+            f.write(f'#define ASSET_{name.upper()} {i}\n')
+        f.write(f'#define ASSET_COUNT {len(assets)}\n')
+        f.write(f'#define ASSET_ZONE_LOADS {sum(len(z) for z in zone_loads)}\n\n')
+        f.write(f'extern const unsigned int assetArchive[{len(words)}];\n')
+        f.write('extern const char *const assetNames[ASSET_COUNT];\n')
+        f.write('extern const AssetLoad assetZoneLoads[ASSET_ZONE_LOADS];\n')
+        f.write('extern const unsigned char assetZoneStart[NUM_ZONES + 1];\n')
+        f.write('\n#endif // ARCHIVE_H\n')
+
+    print(f"archive: {len(assets)} assets, {len(archive)} bytes, "
+          f"{sum(a[4] for a in index)} unpacked")
+
+
+if __name__ == '__main__':
+    main()
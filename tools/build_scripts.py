@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Assemble event scripts (assets/scripts/*.evs) into ROM bytecode.
+
+Each line is an instruction, a `label:` or a `script <name> [boot]
+[cutscene <n>]` header; `;` starts a comment. Instructions map one to one
+onto the SOP_* opcodes of include/script.h, operands are emitted as bytes
+(u16 little endian), and jump targets are byte offsets from the start of
+their script. Symbolic operands (effect kinds, actor types, directions,
+transition masks, keys) are written as their C names so the data follows
+the headers. Outputs data/scripts.c/.h.
+"""
+import glob
+import os
+import re
+import sys
+
+SRC_DIR = os.path.join(os.path.dirname(__file__), '..', 'assets', 'scripts')
+OUT_DIR = os.path.join(os.path.dirname(__file__), '..', 'data')
+
+NUM_CUTSCENES = 4                    # cutscene triggers in build_triggers.py
+MAX_SCRIPTS = 255                    # ids are u8, 0xFF is SCRIPT_NONE
+MAX_CODE = 0xFFFF
+
+FX = {'slash': 'FX_SLASH', 'sparks': 'FX_SPARKS', 'dust': 'FX_DUST', 'splash': 'FX_SPLASH'}
+ENT = {'guard': 'ENT_GUARD', 'slime': 'ENT_SLIME', 'pickup': 'ENT_PICKUP'}
+DIR = {'se': 'DIR_SE', 'ne': 'DIR_NE', 'nw': 'DIR_NW', 'sw': 'DIR_SW'}
+KEYS = {'a': 'KEY_A', 'b': 'KEY_B', 'select': 'KEY_SELECT', 'start': 'KEY_START',
+        'right': 'KEY_RIGHT', 'left': 'KEY_LEFT', 'up': 'KEY_UP', 'down': 'KEY_DOWN',
+        'r': 'KEY_R', 'l': 'KEY_L'}
+MASK = {'cut': 'WARP_CUT', 'mosaic': 'WARP_MOSAIC', 'fade': 'WARP_FADE'}
+
+# mnemonic: opcode, operand kinds
+#   u8/s8/u16/s16 numbers, reg r0..r3, label (u16 offset), col/row tile
+#   numbers, fx/ent/dir/mask names, keys a|b|..., script name
+OPS = {
+    'end':       ('SOP_END', []),
+    'yield':     ('SOP_YIELD', []),
+    'wait':      ('SOP_WAIT', ['u16']),
+    'wait_move': ('SOP_WAIT_MOVE', []),
+    'wait_col':  ('SOP_WAIT_COL', ['col']),
+    'wait_key':  ('SOP_WAIT_KEY', ['keys']),
+    'wait_flag': ('SOP_WAIT_FLAG', ['flag']),
+    'set':       ('SOP_SET', ['reg', 's16']),
+    'add':       ('SOP_ADD', ['reg', 's8']),
+    'jmp':       ('SOP_JMP', ['label']),
+    'jnz':       ('SOP_JNZ', ['reg', 'label']),
+    'djnz':      ('SOP_DJNZ', ['reg', 'label']),
+    'flag':      ('SOP_FLAG', ['flag']),
+    'fx':        ('SOP_FX', ['fx', 'col', 'row']),
+    'fxp':       ('SOP_FXP', ['fx', 's8', 's8']),
+    'spawn':     ('SOP_SPAWN', ['ent', 'col', 'row', 'dir']),
+    'run':       ('SOP_RUN', ['script']),
+    'warp':      ('SOP_WARP', ['col', 'row', 'mask']),
+}
+SIZE = {'u8': 1, 's8': 1, 'u16': 2, 's16': 2, 'reg': 1, 'label': 2, 'col': 1, 'row': 1,
+        'fx': 1, 'ent': 1, 'dir': 1, 'mask': 1, 'keys': 2, 'flag': 1, 'script': 1}
+RANGE = {'u8': (0, 255), 's8': (-128, 127), 'u16': (0, 0xFFFF), 's16': (-32768, 32767),
+         'col': (0, 199), 'row': (0, 15), 'flag': (0, 31)}
+
+
+class Script:
+    def __init__(self, name, where):
+        self.name, self.where = name, where
+        self.boot, self.cutscene = False, None
+        self.lines, self.labels = [], {}
+        self.size = 0
+
+
+def fail(where, msg):
+    sys.exit(f"{where}: {msg}")
+
+
+def parse(path, scripts):
+    cur = None
+    for n, raw in enumerate(open(path), 1):
+        where = f"{os.path.basename(path)}:{n}"
+        line = raw.split(';', 1)[0].strip()
+        if not line:
+            continue
+        words = line.split()
+        if words[0] == 'script':
+            if len(words) < 2:
+                fail(where, "script needs a name")
+            cur = Script(words[1], where)
+            rest = words[2:]
+            while rest:
+                if rest[0] == 'boot':
+                    cur.boot, rest = True, rest[1:]
+                elif rest[0] == 'cutscene' and len(rest) > 1:
+                    cur.cutscene, rest = int(rest[1], 0), rest[2:]
+                else:
+                    fail(where, f"unknown script attribute '{rest[0]}'")
+            if any(s.name == cur.name for s in scripts):
+                fail(where, f"script '{cur.name}' defined twice")
+            scripts.append(cur)
+            continue
+        if cur is None:
+            fail(where, "instruction outside a script")
+        if line.endswith(':'):
+            label = line[:-1]
+            if label in cur.labels:
+                fail(where, f"label '{label}' defined twice")
+            cur.labels[label] = cur.size
+            continue
+        op = words[0]
+        if op not in OPS:
+            fail(where, f"unknown instruction '{op}'")
+        kinds = OPS[op][1]
+        if len(words) - 1 != len(kinds):
+            fail(where, f"'{op}' takes {len(kinds)} operands")
+        cur.lines.append((where, op, words[1:]))
+        cur.size += 1 + sum(SIZE[k] for k in kinds)
+
+
+def operand(where, kind, text, script, ids):
+    """Bytes of one operand, as C expressions."""
+    def number():
+        try:
+            v = int(text, 0)
+        except ValueError:
+            fail(where, f"'{text}' is not a number")
+        lo, hi = RANGE[kind]
+        if not lo <= v <= hi:
+            fail(where, f"{v} out of range for {kind}")
+        return v
+
+    if kind in ('u8', 'col', 'row', 'flag'):
+        return [str(number())]
+    if kind == 's8':
+        return [str(number() & 0xFF)]
+    if kind in ('u16', 's16'):
+        v = number() & 0xFFFF
+        return [str(v & 0xFF), str(v >> 8)]
+    if kind == 'reg':
+        m = re.fullmatch(r'r([0-3])', text)
+        if not m:
+            fail(where, f"'{text}' is not a register (r0..r3)")
+        return [m.group(1)]
+    if kind == 'label':
+        if text not in script.labels:
+            fail(where, f"unknown label '{text}'")
+        v = script.labels[text]
+        return [str(v & 0xFF), str(v >> 8)]
+    if kind == 'keys':
+        names = []
+        for k in text.split('|'):
+            if k not in KEYS:
+                fail(where, f"unknown key '{k}'")
+            names.append(KEYS[k])
+        expr = '|'.join(names)
+        return [f'({expr}) & 0xFF', f'({expr}) >> 8']
+    if kind == 'script':
+        if text not in ids:
+            fail(where, f"unknown script '{text}'")
+        return [f'SCRIPT_{text.upper()}']
+    table = {'fx': FX, 'ent': ENT, 'dir': DIR, 'mask': MASK}[kind]
+    if text not in table:
+        fail(where, f"unknown {kind} '{text}' (one of {', '.join(table)})")
+    return [table[text]]
+
+
+def main():
+    scripts = []
+    for path in sorted(glob.glob(os.path.join(SRC_DIR, '*.evs'))):
+        parse(path, scripts)
+    if not scripts:
+        sys.exit("no scripts")
+    if len(scripts) > MAX_SCRIPTS:
+        sys.exit(f"{len(scripts)} scripts, ids hold {MAX_SCRIPTS}")
+    ids = {s.name: i for i, s in enumerate(scripts)}
+    cutscene = ['SCRIPT_NONE'] * NUM_CUTSCENES
+    boot = [s for s in scripts if s.boot]
+    if len(boot) > 1:
+        fail(boot[1].where, "only one boot script")
+    for s in scripts:
+        if s.cutscene is not None:
+            if not 0 <= s.cutscene < NUM_CUTSCENES:
+                fail(s.where, f"cutscene {s.cutscene} out of range")
+            if cutscene[s.cutscene] != 'SCRIPT_NONE':
+                fail(s.where, f"cutscene {s.cutscene} already has a script")
+            cutscene[s.cutscene] = f'SCRIPT_{s.name.upper()}'
+        if not s.lines or s.lines[-1][1] not in ('end', 'jmp'):
+            fail(s.where, f"script '{s.name}' must finish with end or jmp")
+
+    starts, total = [], 0
+    for s in scripts:
+        starts.append(total)
+        total += s.size
+    if total > MAX_CODE:
+        sys.exit(f"{total} bytes of bytecode, offsets hold {MAX_CODE}")
+
+    with open(os.path.join(OUT_DIR, 'scripts.c'), 'w') as f:
+        f.write('// Auto-generated by build_scripts.py — DO NOT EDIT\n')
+        f.write('#include "scripts.h"\n#include "entity.h"\n#include "particle.h"\n#include "warp.h"\n\n')
+        f.write(f'// {len(scripts)} scripts, {total} bytes\n')
+        f.write(f'const unsigned char scriptCode[{total}] = {{\n')
+        for s, start in zip(scripts, starts):
+            f.write(f'    // {s.name} @ {start}\n')
+            for where, op, args in s.lines:
+                out = [OPS[op][0]]
+                for kind, text in zip(OPS[op][1], args):
+                    out += operand(where, kind, text, s, ids)
+                f.write('    ' + ', '.join(out) + ',\n')
+        f.write('};\n\n')
+        f.write('const unsigned short scriptStart[SCRIPT_COUNT] = {\n    ')
+        f.write(', '.join(str(v) for v in starts))
+        f.write(',\n};\n\n')
+        f.write(f'const unsigned char scriptCutscene[{NUM_CUTSCENES}] = {{\n    ')
+        f.write(', '.join(cutscene))
+        f.write(',\n};\n')
+
+    with open(os.path.join(OUT_DIR, 'scripts.h'), 'w') as f:
+        f.write('// Auto-generated by build_scripts.py — DO NOT EDIT\n')
+        f.write('#ifndef SCRIPTS_H\n#define SCRIPTS_H\n\n#include "script.h"\n\n')
+        for s in scripts:
+            f.write(f'#define SCRIPT_{s.name.upper()} {ids[s.name]}\n')
+        f.write(f'#define SCRIPT_COUNT {len(scripts)}\n')
+        f.write(f'#define SCRIPT_BOOT '
+                f'{"SCRIPT_" + boot[0].name.upper() if boot else "SCRIPT_NONE"}\n')
+        f.write(f'#define SCRIPT_CUTSCENES {NUM_CUTSCENES}\n\n')
+        f.write(f'extern const unsigned char scriptCode[{total}];\n')
+        f.write('extern const unsigned short scriptStart[SCRIPT_COUNT];\n')
+        f.write(f'extern const unsigned char scriptCutscene[SCRIPT_CUTSCENES];\n')
+        f.write('\n#endif // SCRIPTS_H\n')
+
+    print(f"scripts: {len(scripts)} ({', '.join(s.name for s in scripts)}), {total} bytes")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""Synthesize the sound bank: SFX, instrument waves and songs.
+
+There are no recorded sounds yet, so effects are generated here from noise,
+sweeps and decays, and the music is a two-track song over single-cycle
+instrument waves (include/sound.h). Samples are 8-bit signed PCM; effects
+are made at SFX_RATE, instruments store one cycle at SOUND_NOTE_BASE (C4).
+Outputs data/sounds.c/.h.
+"""
+import math
+import os
+import random
+
+OUT_DIR = os.path.join(os.path.dirname(__file__), '..', 'data')
+
+SFX_RATE = 10512
+WAVE_LEN = 32
+NOTE_BASE = 60                       # SOUND_NOTE_BASE
+NOTE_LO, NOTE_HI = 36, 96            # soundNotePitch[] range
+NOTE_OFF = 1
+
+
+def clip(v):
+    return max(-128, min(127, int(round(v))))
+
+
+def seconds(t):
+    return int(SFX_RATE * t)
+
+
+def noise(rng, n, decay, smooth):
+    """Decaying noise through a one-pole low-pass (smooth 0..1)."""
+    out, y = [], 0.0
+    for i in range(n):
+        y += (rng.uniform(-1, 1) - y) * (1 - smooth)
+        out.append(y * math.exp(-decay * i / n))
+    return out
+
+
+def sweep(n, f0, f1, decay, square=False):
+    out, ph = [], 0.0
+    for i in range(n):
+        f = f0 + (f1 - f0) * i / n
+        ph += f / SFX_RATE
+        s = math.sin(2 * math.pi * ph)
+        if square:
+            s = 1.0 if s >= 0 else -1.0
+        out.append(s * math.exp(-decay * i / n))
+    return out
+
+
+def mix(*parts):
+    n = max(len(p) for p, _ in parts)
+    return [sum(p[i] * g for p, g in parts if i < len(p)) for i in range(n)]
+
+
+def sfx_slash(rng):
+    n = seconds(0.10)
+    hiss = noise(rng, n, 3.0, 0.2)
+    whoosh = sweep(n, 1800, 400, 3.0)
+    return mix((hiss, 90), (whoosh, 30))
+
+
+def sfx_hit(rng):
+    n = seconds(0.09)
+    return mix((sweep(n, 160, 60, 4.0, square=True), 70), (noise(rng, n, 6.0, 0.5), 60))
+
+
+def sfx_jump(rng):
+    return [v * 60 for v in sweep(seconds(0.12), 300, 720, 1.5, square=True)]
+
+
+def sfx_land(rng):
+    n = seconds(0.07)
+    return mix((noise(rng, n, 5.0, 0.85), 127), (sweep(n, 90, 50, 5.0), 50))
+
+
+def sfx_splash(rng):
+    n = seconds(0.22)
+    return mix((noise(rng, n, 3.5, 0.45), 110), (noise(rng, n, 6.0, 0.05), 30))
+
+
+def sfx_chime(rng):
+    n = seconds(0.35)
+    return mix((sweep(n, 1760, 1760, 3.0), 50), (sweep(n, 2637, 2637, 4.0), 40))
+
+
+# name, generator, priority, volume
+SFX = [
+    ('slash',  sfx_slash,  2, 24),
+    ('hit',    sfx_hit,    3, 32),
+    ('jump',   sfx_jump,   1, 18),
+    ('land',   sfx_land,   1, 20),
+    ('splash', sfx_splash, 1, 22),
+    ('chime',  sfx_chime,  4, 28),
+]
+
+# Instruments: one cycle each, looped
+INSTRUMENTS = [
+    ('square',   [48 if i < WAVE_LEN // 2 else -48 for i in range(WAVE_LEN)]),
+    ('triangle', [100 * (1 - 4 * abs(i / WAVE_LEN - 0.5)) for i in range(WAVE_LEN)]),
+]
+
+# Songs: rows of one cell per track; notes like C4/F#3, '.' holds, '-' releases
+NAMES = {'C': 0, 'C#': 1, 'D': 2, 'D#': 3, 'E': 4, 'F': 5, 'F#': 6, 'G': 7, 'G#': 8,
+         'A': 9, 'A#': 10, 'B': 11}
+
+FIELD_LEAD = """
+E5 . G5 . A5 . G5 . E5 . D5 . C5 . - .
+D5 . E5 . G5 . E5 . D5 . C5 . A4 . - .
+C5 . D5 . E5 . G5 . A5 . G5 . E5 . D5 .
+E5 . . . D5 . . . C5 . . . - . . .
+"""
+FIELD_BASS = """
+C3 . - . C3 . G2 . C3 . - . C3 . G2 .
+A2 . - . A2 . E3 . A2 . - . A2 . E3 .
+F2 . - . F2 . C3 . F2 . - . F2 . C3 .
+G2 . - . G2 . D3 . G2 . - . B2 . D3 .
+"""
+
+# name, ticks per row, loop row, [(instrument, volume, cells)]
+SONGS = [
+    ('field', 8, 0, [('square', 10, FIELD_LEAD), ('triangle', 16, FIELD_BASS)]),
+]
+
+
+def note(cell):
+    if cell == '.':
+        return 0
+    if cell == '-':
+        return NOTE_OFF
+    name, octave = cell[:-1], int(cell[-1])
+    n = 12 * (octave + 1) + NAMES[name]
+    if not NOTE_LO <= n < NOTE_HI:
+        raise SystemExit(f"note {cell} outside the pitch table")
+    return n
+
+
+def c_bytes(f, values, per_line=16):
+    for i in range(0, len(values), per_line):
+        f.write('    ' + ','.join(f'{v:4}' for v in values[i:i + per_line]) + ',\n')
+
+
+def main():
+    rng = random.Random(1)
+    samples = []                       # (name, data, loop_start, rate, prio, vol)
+    for name, gen, prio, vol in SFX:
+        samples.append((name, [clip(v) for v in gen(rng)], None, SFX_RATE, prio, vol))
+    base_hz = 440.0 * 2 ** ((NOTE_BASE - 69) / 12)
+    for name, wave in INSTRUMENTS:
+        samples.append((name, [clip(v) for v in wave], 0, round(base_hz * WAVE_LEN), 0, 0))
+    inst_ids = {name: len(SFX) + i for i, (name, _) in enumerate(INSTRUMENTS)}
+
+    with open(os.path.join(OUT_DIR, 'sounds.c'), 'w') as f:
+        f.write('// Auto-generated by build_sounds.py — DO NOT EDIT\n')
+        f.write('#include "sounds.h"\n\n')
+        total = 0
+        for name, data, _, _, _, _ in samples:
+            f.write(f'static const s8 snd_{name}[{len(data)}] __attribute__((aligned(4))) = {{\n')
+            c_bytes(f, data)
+            f.write('};\n\n')
+            total += len(data)
+        f.write(f'// {len(SFX)} effects at {SFX_RATE} Hz, {len(INSTRUMENTS)} instruments, '
+                f'{total} bytes\n')
+        f.write('const SoundSample soundSamples[SND_SAMPLES] = {\n')
+        for name, data, loop, rate, prio, vol in samples:
+            loop_s = 'SOUND_NO_LOOP' if loop is None else str(loop)
+            f.write(f'    {{ snd_{name}, {len(data)}, {loop_s}, {rate}, {prio}, {vol} }},\n')
+        f.write('};\n\n')
+
+        # Pitch multipliers relative to SOUND_NOTE_BASE, 4.12 fixed point
+        pitch = [round(4096 * 2 ** ((n - NOTE_BASE) / 12)) for n in range(NOTE_LO, NOTE_HI)]
+        f.write(f'const u16 soundNotePitch[{NOTE_HI - NOTE_LO}] = {{\n')
+        for i in range(0, len(pitch), 12):
+            f.write('    ' + ','.join(f'{p:5}' for p in pitch[i:i + 12]) + ',\n')
+        f.write('};\n\n')
+
+        for name, ticks, loop, tracks in SONGS:
+            cols = [[note(c) for c in cells.split()] for _, _, cells in tracks]
+            rows = len(cols[0])
+            if any(len(c) != rows for c in cols):
+                raise SystemExit(f"song {name}: tracks differ in length")
+            f.write(f'static const u8 song_{name}[{rows * len(cols)}] = {{\n')
+            c_bytes(f, [cols[t][r] for r in range(rows) for t in range(len(cols))])
+            f.write('};\n\n')
+        f.write('const SoundSong soundSongs[SONG_COUNT] = {\n')
+        for name, ticks, loop, tracks in SONGS:
+            rows = len(tracks[0][2].split())
+            insts = ', '.join(f'SND_{i.upper()}' for i, _, _ in tracks)
+            vols = ', '.join(str(v) for _, v, _ in tracks)
+            f.write(f'    {{ song_{name}, {rows}, {loop}, {ticks}, {len(tracks)}, '
+                    f'{{ {insts} }}, {{ {vols} }} }},\n')
+        f.write('};\n')
+
+    with open(os.path.join(OUT_DIR, 'sounds.h'), 'w') as f:
+        f.write('// Auto-generated by build_sounds.py — DO NOT EDIT\n')
+        f.write('#ifndef SOUNDS_H\n#define SOUNDS_H\n\n#include "sound.h"\n\n')
+        for i, (name, _, _, _) in enumerate(SFX):
+            f.write(f'#define SFX_{name.upper()} {i}\n')
+        f.write(f'#define SFX_COUNT {len(SFX)}\n')
+        for name, i in inst_ids.items():
+            f.write(f'#define SND_{name.upper()} {i}\n')
+        f.write(f'#define SND_SAMPLES {len(samples)}\n\n')
+        for i, (name, _, _, _) in enumerate(SONGS):
+            f.write(f'#define SONG_{name.upper()} {i}\n')
+        f.write(f'#define SONG_COUNT {len(SONGS)}\n')
+        f.write(f'#define SOUND_NOTE_HI {NOTE_HI}\n\n')
+        f.write('extern const SoundSample soundSamples[SND_SAMPLES];\n')
+        f.write('extern const SoundSong soundSongs[SONG_COUNT];\n')
+        f.write(f'extern const u16 soundNotePitch[{NOTE_HI - NOTE_LO}];\n')
+        f.write('\n#endif // SOUNDS_H\n')
+
+    print(f"sounds: {len(SFX)} effects, {len(INSTRUMENTS)} instruments, "
+          f"{sum(len(s[1]) for s in samples)} sample bytes, {len(SONGS)} songs")
+
+
+if __name__ == '__main__':
+    main()
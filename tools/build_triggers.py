@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Compile the strip's trigger rectangles into a column-bucketed ROM index.
+
+Triggers are inclusive tile rectangles (include/trigger.h). The strip is cut
+into BUCKET_COLS-wide buckets; each bucket lists the triggers overlapping it,
+sorted by first column so the runtime can stop at the first one starting
+east of the player. A trigger spanning several buckets is listed in each.
+Outputs data/triggers.c/.h.
+"""
+import os
+import sys
+
+OUT_DIR = os.path.join(os.path.dirname(__file__), '..', 'data')
+
+MAP_COLS = 200
+MAP_ROWS = 16
+BUCKET_COLS = 8
+MAX_TRIGGERS = 255                  # ids are u8
+
+# name, (col_lo, col_hi), (row_lo, row_hi), kind, arg, flags
+TRIGGERS = [
+    # Regions, matching generate_world(); together they tile the strip
+    ('meadow',      (0, 37),    (0, 15), 'TRIG_ZONE', 'ZONE_MEADOW', 0),
+    ('river',       (38, 57),   (0, 15), 'TRIG_ZONE', 'ZONE_RIVER', 0),
+    ('hills',       (58, 79),   (0, 15), 'TRIG_ZONE', 'ZONE_HILLS', 0),
+    ('fields',      (80, 99),   (0, 15), 'TRIG_ZONE', 'ZONE_FIELDS', 0),
+    ('lake',        (100, 119), (0, 15), 'TRIG_ZONE', 'ZONE_LAKE', 0),
+    ('highlands',   (120, 147), (0, 15), 'TRIG_ZONE', 'ZONE_HIGHLANDS', 0),
+    ('fortress',    (148, 172), (0, 15), 'TRIG_ZONE', 'ZONE_FORTRESS', 0),
+    ('ruins',       (173, 199), (0, 15), 'TRIG_ZONE', 'ZONE_RUINS', 0),
+    # Checkpoints on the road
+    ('cp_start',    (2, 4),     (4, 10), 'TRIG_CHECKPOINT', 0, 0),
+    ('cp_ford',     (35, 37),   (4, 10), 'TRIG_CHECKPOINT', 1, 0),
+    ('cp_fields',   (78, 80),   (4, 10), 'TRIG_CHECKPOINT', 2, 0),
+    ('cp_lake',     (97, 99),   (4, 10), 'TRIG_CHECKPOINT', 3, 0),
+    ('cp_gate',     (144, 147), (4, 10), 'TRIG_CHECKPOINT', 4, 0),
+    ('cp_ruins',    (172, 174), (4, 10), 'TRIG_CHECKPOINT', 5, 0),
+    # Cutscenes, played once
+    ('cs_river',    (38, 39),   (0, 15), 'TRIG_CUTSCENE', 0, 'TRIG_ONCE'),
+    ('cs_gate',     (148, 149), (5, 10), 'TRIG_CUTSCENE', 1, 'TRIG_ONCE'),
+    ('cs_hall',     (155, 165), (6, 9),  'TRIG_CUTSCENE', 2, 'TRIG_ONCE'),
+    ('cs_ruins',    (180, 190), (5, 10), 'TRIG_CUTSCENE', 3, 'TRIG_ONCE'),
+    # Hidden pickups: hill tops, the lake shore, the hall roof, the ruins dais
+    ('cache_hill1', (17, 17),   (2, 2),  'TRIG_PICKUP', 0, 'TRIG_ONCE'),
+    ('cache_hill2', (62, 62),   (3, 3),  'TRIG_PICKUP', 1, 'TRIG_ONCE'),
+    ('cache_shore', (107, 108), (6, 7),  'TRIG_PICKUP', 2, 'TRIG_ONCE'),
+    ('cache_hill3', (127, 127), (12, 12), 'TRIG_PICKUP', 3, 'TRIG_ONCE'),
+    ('cache_roof',  (160, 160), (7, 8),  'TRIG_PICKUP', 4, 'TRIG_ONCE'),
+    ('cache_dais',  (185, 185), (7, 8),  'TRIG_PICKUP', 5, 'TRIG_ONCE'),
+]
+
+
+def check(t):
+    name, (c0, c1), (r0, r1) = t[:3]
+    if not (0 <= c0 <= c1 < MAP_COLS and 0 <= r0 <= r1 < MAP_ROWS):
+        sys.exit(f"trigger {name}: rectangle outside the {MAP_COLS}x{MAP_ROWS} map")
+
+
+def main():
+    if BUCKET_COLS & (BUCKET_COLS - 1):
+        sys.exit("BUCKET_COLS must be a power of two (the runtime shifts)")
+    if len(TRIGGERS) > MAX_TRIGGERS:
+        sys.exit(f"{len(TRIGGERS)} triggers, ids hold {MAX_TRIGGERS}")
+    for t in TRIGGERS:
+        check(t)
+    # Sort by first column; bucket lists then come out sorted too
+    trigs = sorted(TRIGGERS, key=lambda t: (t[1][0], t[1][1]))
+    nbuckets = (MAP_COLS + BUCKET_COLS - 1) // BUCKET_COLS
+    buckets = []
+    for b in range(nbuckets):
+        lo, hi = b * BUCKET_COLS, (b + 1) * BUCKET_COLS - 1
+        buckets.append([i for i, t in enumerate(trigs) if t[1][0] <= hi and t[1][1] >= lo])
+    ids = [i for b in buckets for i in b]
+    starts = [0]
+    for b in buckets:
+        starts.append(starts[-1] + len(b))
+
+    with open(os.path.join(OUT_DIR, 'triggers.c'), 'w') as f:
+        f.write('// Auto-generated by build_triggers.py — DO NOT EDIT\n')
+        f.write('#include "triggers.h"\n\n')
+        f.write(f'// {len(trigs)} triggers, sorted by first column\n')
+        f.write(f'const TriggerDef trigDefs[TRIG_COUNT] = {{\n')
+        for name, (c0, c1), (r0, r1), kind, arg, flags in trigs:
+            f.write(f'    {{ {c0:3}, {c1:3}, {r0:2}, {r1:2}, {kind}, {arg}, {flags}, 0 }},'
+                    f'  // {name}\n')
+        f.write('};\n\n')
+        f.write(f'// {nbuckets} buckets of {BUCKET_COLS} columns: '
+                f'trigBucketIds[trigBucketStart[b] .. trigBucketStart[b + 1])\n')
+        f.write(f'const unsigned short trigBucketStart[TRIG_BUCKETS + 1] = {{\n')
+        for i in range(0, len(starts), 13):
+            f.write('    ' + ','.join(f'{s:3}' for s in starts[i:i + 13]) + ',\n')
+        f.write('};\n\n')
+        f.write(f'const unsigned char trigBucketIds[{len(ids)}] = {{\n')
+        for b, lst in enumerate(buckets):
+            f.write('    ' + ''.join(f'{i:2},' for i in lst) +
+                    f'  // cols {b * BUCKET_COLS}-{(b + 1) * BUCKET_COLS - 1}\n')
+        f.write('};\n')
+
+    with open(os.path.join(OUT_DIR, 'triggers.h'), 'w') as f:
+        f.write('// Auto-generated by build_triggers.py — DO NOT EDIT\n')
+        f.write('#ifndef TRIGGERS_H\n#define TRIGGERS_H\n\n#include "trigger.h"\n\n')
+        f.write(f'#define TRIG_COUNT {len(trigs)}\n')
+        f.write(f'#define TRIG_BUCKET_SHIFT {BUCKET_COLS.bit_length() - 1}\n')
+        f.write(f'#define TRIG_BUCKETS {nbuckets}\n')
+        f.write(f'#define TRIG_BUCKET_MAX {max(len(b) for b in buckets)}\n\n')
+        f.write('extern const TriggerDef trigDefs[TRIG_COUNT];\n')
+        f.write('extern const unsigned short trigBucketStart[TRIG_BUCKETS + 1];\n')
+        f.write(f'extern const unsigned char trigBucketIds[{len(ids)}];\n')
+        f.write('\n#endif // TRIGGERS_H\n')
+
+    print(f"triggers: {len(trigs)} in {nbuckets} buckets, {len(ids)} list entries, "
+          f"up to {max(len(b) for b in buckets)} per bucket")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,365 @@
+#!/usr/bin/env python3
+"""Convert indexed sprite sheets into 4bpp OBJ cells + animation tables.
+
+Each sheet is a grid of 32x32 cells, one row per facing direction. Rows
+listed in `mirror` must be exact horizontal flips of another row; they are
+not stored, and the runtime draws the source row with ATTR1_HFLIP instead.
+Animations are lists of (cell, duration) frames with a loop point.
+
+Cells are trimmed into meta-sprites: the non-empty 8x8 tiles of each cell
+are covered by the fewest OBJ tiles (then the fewest OBJ pieces) using the
+hardware shapes, and only those tiles are stored, piece by piece in 1D
+mapping order. The runtime expands a cell into one OAM entry per piece.
+Outputs data/anim_<name>.c/.h for include/anim.h.
+
+Effect graphics (include/particle.h) go to data/fx.c/.h: the sword slash
+frames, kept whole since they are drawn rotated, and the 8x8 particle
+frames below, sharing one 16-colour palette.
+"""
+import os
+import sys
+from PIL import Image
+
+ASSETS_DIR = os.path.join(os.path.dirname(__file__), '..', 'assets')
+OUT_DIR = os.path.join(os.path.dirname(__file__), '..', 'data')
+
+CELL = 32
+CELL_TILES = CELL // 8
+CELL_BYTES = 16 * 32                 # 16 tiles of 4bpp
+MAX_PIECES = 4
+DIRS = ['SE', 'NE', 'NW', 'SW']      # DIR_* order in game.h
+HOLD = 0xFF
+
+SHEETS = [
+    {
+        'name': 'hero',
+        'png': 'sprites/hero_walk_idx.png',
+        'rows': ['SW', 'SE', 'NW', 'NE'],       # sheet row order
+        'mirror': {'SE': 'SW', 'NE': 'NW'},     # row: source row
+        'anims': [
+            # name, [(cell, duration)], loop frame (or HOLD)
+            ('idle',   [(0, 1)],                        HOLD),
+            ('walk',   [(c, 4) for c in range(6)],      0),
+            ('patrol', [(c, 8) for c in range(6)],      0),
+        ],
+    },
+]
+
+# Effects: RGBA strips of square frames (alpha < 128 is transparent), then
+# 8x8 particles drawn here. Keys: '.' transparent, others FX_COLOURS.
+FX_STRIPS = [('slash', 'sprites/sword_slash.png', 32)]
+FX_COLOURS = {
+    'w': (255, 255, 220), 'y': (255, 240, 100), 'o': (220, 200, 100),
+    'g': (150, 130, 100), 'G': (200, 185, 150),
+    'c': (120, 180, 255), 'B': (40, 90, 200),
+}
+FX_PARTICLES = [
+    ('spark', [
+        ['...w....',
+         '...y....',
+         '...y....',
+         'wyyoyyw.',
+         '...y....',
+         '...y....',
+         '...w....',
+         '........'],
+        ['........',
+         '........',
+         '...y....',
+         '..yoy...',
+         '...y....',
+         '........',
+         '........',
+         '........'],
+    ]),
+    ('dust', [
+        ['........',
+         '..gggg..',
+         '.gGGGgg.',
+         '.gGGGGg.',
+         '.gGGGGg.',
+         '.ggGGgg.',
+         '..gggg..',
+         '........'],
+        ['........',
+         '........',
+         '...gg...',
+         '..gGGg..',
+         '..gGGg..',
+         '...gg...',
+         '........',
+         '........'],
+    ]),
+    ('drop', [
+        ['........',
+         '........',
+         '...c....',
+         '..cwc...',
+         '..cBc...',
+         '...B....',
+         '........',
+         '........'],
+    ]),
+]
+
+
+def rgb_to_gba(r, g, b):
+    """Convert 8-bit RGB to GBA 15-bit BGR."""
+    return ((b >> 3) << 10) | ((g >> 3) << 5) | (r >> 3)
+
+
+def cell_pixels(img, row, col):
+    px = img.load()
+    return [[px[col * CELL + x, row * CELL + y] for x in range(CELL)] for y in range(CELL)]
+
+
+# OBJ sizes in tiles (w, h) -> (ATTR0 shape, ATTR1 size)
+OBJ_SHAPES = {
+    (1, 1): ('ATTR0_SQUARE', 'ATTR1_SIZE_8'),  (2, 2): ('ATTR0_SQUARE', 'ATTR1_SIZE_16'),
+    (4, 4): ('ATTR0_SQUARE', 'ATTR1_SIZE_32'), (2, 1): ('ATTR0_WIDE', 'ATTR1_SIZE_8'),
+    (4, 1): ('ATTR0_WIDE', 'ATTR1_SIZE_16'),   (4, 2): ('ATTR0_WIDE', 'ATTR1_SIZE_32'),
+    (1, 2): ('ATTR0_TALL', 'ATTR1_SIZE_8'),    (1, 4): ('ATTR0_TALL', 'ATTR1_SIZE_16'),
+    (2, 4): ('ATTR0_TALL', 'ATTR1_SIZE_32'),
+}
+
+
+def tile_to_4bpp(cell, tx, ty):
+    """8 words of one 8x8 tile, low nibble = left pixel."""
+    words = []
+    for y in range(8):
+        w = 0
+        for x in range(8):
+            w |= (cell[ty * 8 + y][tx * 8 + x] & 15) << (4 * x)
+        words.append(w)
+    return words
+
+
+def trim(cell):
+    """Cover the non-empty tiles with non-overlapping OBJ rectangles.
+
+    Exhaustive over the 4x4 tile grid: fewest tiles, then fewest pieces.
+    Returns [(tx, ty, w, h)].
+    """
+    solid = {(tx, ty) for ty in range(CELL_TILES) for tx in range(CELL_TILES)
+             if any(cell[ty * 8 + y][tx * 8 + x] for y in range(8) for x in range(8))}
+    best = [None]
+
+    def search(todo, used, pieces, tiles):
+        if best[0] and (tiles, len(pieces)) >= best[0][0]:
+            return
+        if not todo:
+            best[0] = ((tiles, len(pieces)), list(pieces))
+            return
+        if len(pieces) == MAX_PIECES:
+            return
+        tx0, ty0 = min(todo, key=lambda t: (t[1], t[0]))
+        for (w, h) in OBJ_SHAPES:
+            for x in range(tx0 - w + 1, tx0 + 1):
+                for y in range(ty0 - h + 1, ty0 + 1):
+                    if x < 0 or y < 0 or x + w > CELL_TILES or y + h > CELL_TILES:
+                        continue
+                    cover = {(x + i, y + j) for j in range(h) for i in range(w)}
+                    if cover & used:
+                        continue
+                    pieces.append((x, y, w, h))
+                    search(todo - cover, used | cover, pieces, tiles + w * h)
+                    pieces.pop()
+
+    search(solid, set(), [], 0)
+    return best[0][1]
+
+
+def check_cell(name, px, words, pieces):
+    """Re-assemble the cell from its pieces, plain and mirrored."""
+    for flip in (False, True):
+        out = [[0] * CELL for _ in range(CELL)]
+        for x, xf, y, tile, (shape, size) in pieces:
+            w, h = next(k for k, v in OBJ_SHAPES.items() if v == (shape, size))
+            for j in range(h * 8):
+                for i in range(w * 8):
+                    t = tile + (j // 8) * w + i // 8
+                    v = (words[t * 8 + j % 8] >> (4 * (i % 8))) & 15
+                    if flip:
+                        out[y + j][xf + w * 8 - 1 - i] = v
+                    else:
+                        out[y + j][x + i] = v
+        ref = [row[::-1] for row in px] if flip else px
+        if out != ref:
+            sys.exit(f"{name}: meta-sprite does not reproduce its cell")
+
+
+def convert(sheet):
+    name = sheet['name']
+    img = Image.open(os.path.join(ASSETS_DIR, sheet['png']))
+    if img.mode != 'P':
+        sys.exit(f"{sheet['png']}: needs an indexed (palette) PNG")
+    rows = sheet['rows']
+    cells_per_row = img.width // CELL
+    mirror = sheet['mirror']
+
+    # Stored rows: sheet order minus mirrored ones
+    stored = [r for r in rows if r not in mirror]
+    for dst, src in mirror.items():
+        for c in range(cells_per_row):
+            a = cell_pixels(img, rows.index(src), c)
+            b = cell_pixels(img, rows.index(dst), c)
+            if any(a[y][x] != b[y][CELL - 1 - x] for y in range(CELL) for x in range(CELL)):
+                sys.exit(f"{name}: row {dst} cell {c} is not a mirror of {src}")
+
+    dir_row = []
+    dir_flip = 0
+    for i, d in enumerate(DIRS):
+        src = mirror.get(d, d)
+        dir_row.append(stored.index(src))
+        if d in mirror:
+            dir_flip |= 1 << i
+
+    # Trim every stored cell into OBJ pieces; tiles are stored per piece,
+    # row-major, as 1D OBJ mapping expects
+    words, cells, pieces = [], [], []
+    for r in stored:
+        for c in range(cells_per_row):
+            px = cell_pixels(img, rows.index(r), c)
+            first_word, first_piece = len(words), len(pieces)
+            for tx, ty, w, h in trim(px):
+                tile = (len(words) - first_word) // 8
+                pieces.append((tx * 8, CELL - (tx + w) * 8, ty * 8, tile, OBJ_SHAPES[(w, h)]))
+                for j in range(h):
+                    for i in range(w):
+                        words += tile_to_4bpp(px, tx + i, ty + j)
+            cells.append((first_word, (len(words) - first_word) // 8,
+                          first_piece, len(pieces) - first_piece))
+            check_cell(name, px, words[first_word:], pieces[first_piece:])
+
+    pal = img.getpalette()[:48]
+    pal += [0] * (48 - len(pal))
+    gba_pal = [rgb_to_gba(*pal[i * 3:i * 3 + 3]) for i in range(16)]
+    gba_pal[0] = 0
+
+    frames, seqs = [], []
+    for aname, fr, loop in sheet['anims']:
+        seqs.append((aname, len(frames), len(fr), loop))
+        frames += fr
+
+    sym = f'anim_{name}'
+    with open(os.path.join(OUT_DIR, f'{sym}.c'), 'w') as f:
+        f.write('// Auto-generated by convert_sprites.py — DO NOT EDIT\n')
+        f.write(f'#include "{sym}.h"\n\n')
+        ncells = len(stored) * cells_per_row
+        f.write(f'// {len(stored)} stored rows ({", ".join(stored)}) x {cells_per_row} cells, '
+                f'trimmed to {len(words) // 8} tiles, {len(words) * 4} bytes\n')
+        f.write(f'const unsigned int {sym}Tiles[{len(words)}] __attribute__((aligned(4))) = {{\n')
+        for i in range(0, len(words), 8):
+            f.write('    ' + ','.join(f'0x{w:08X}' for w in words[i:i + 8]) + ',\n')
+        f.write('};\n\n')
+        f.write(f'const unsigned short {sym}Pal[16] __attribute__((aligned(4))) = {{\n    ')
+        f.write(','.join(f'0x{c:04X}' for c in gba_pal))
+        f.write(',\n};\n\n')
+        f.write(f'static const MetaPiece {sym}_pieces[] = {{\n')
+        for k, (word, ntiles, first, count) in enumerate(cells):
+            f.write(f'    // cell {k}: {ntiles} tiles\n')
+            for x, xf, y, tile, (shape, size) in pieces[first:first + count]:
+                f.write(f'    {{ {x}, {xf}, {y}, {tile}, {shape}, {size} }},\n')
+        f.write('};\n\n')
+        f.write(f'static const MetaCell {sym}_cells[] = {{\n')
+        for word, ntiles, first, count in cells:
+            f.write(f'    {{ {word}, {ntiles}, {first}, {count}, 0 }},\n')
+        f.write('};\n\n')
+        f.write(f'static const AnimFrame {sym}_frames[] = {{\n')
+        for aname, first, count, loop in seqs:
+            f.write(f'    // {aname}\n    ')
+            f.write(' '.join(f'{{ {c}, {d} }},' for c, d in frames[first:first + count]))
+            f.write('\n')
+        f.write('};\n\n')
+        f.write(f'static const AnimSeq {sym}_seqs[] = {{\n')
+        for aname, first, count, loop in seqs:
+            lp = 'ANIM_HOLD' if loop == HOLD else str(loop)
+            f.write(f'    {{ {first}, {count}, {lp}, 0 }},  // {aname}\n')
+        f.write('};\n\n')
+        f.write(f'const AnimSet {sym} = {{\n')
+        f.write(f'    {sym}Tiles, {sym}Pal, {sym}_cells, {sym}_pieces, {sym}_frames, {sym}_seqs,\n')
+        f.write(f'    {len(seqs)}, {cells_per_row},\n')
+        f.write(f'    {{ {", ".join(str(r) for r in dir_row)} }},  // {" ".join(DIRS)}\n')
+        f.write(f'    0x{dir_flip:X},\n')
+        f.write('};\n')
+
+    with open(os.path.join(OUT_DIR, f'{sym}.h'), 'w') as f:
+        guard = f'ANIM_{name.upper()}_H'
+        f.write('// Auto-generated by convert_sprites.py — DO NOT EDIT\n')
+        f.write(f'#ifndef {guard}\n#define {guard}\n\n#include "anim.h"\n\n')
+        for i, (aname, *_rest) in enumerate(seqs):
+            f.write(f'#define {name.upper()}_ANIM_{aname.upper()} {i}\n')
+        f.write(f'\n#define {sym}TilesLen {len(words) * 4}\n')
+        f.write(f'extern const unsigned int {sym}Tiles[{len(words)}];\n')
+        f.write(f'extern const unsigned short {sym}Pal[16];\n')
+        f.write(f'extern const AnimSet {sym};\n')
+        f.write(f'\n#endif // {guard}\n')
+
+    full = len(rows) * cells_per_row * CELL_BYTES
+    print(f"{sym}: {ncells} cells stored as {len(pieces)} OBJ pieces, "
+          f"{len(words) // 8} of {ncells * 16} tiles ({len(words) * 4} bytes, was {full}), "
+          f"{len(seqs)} anims, {len(frames)} frames")
+
+
+def convert_fx():
+    colours = [(0, 0, 0)]
+
+    def index(rgb):
+        if rgb not in colours:
+            colours.append(rgb)
+        return colours.index(rgb)
+
+    words, groups = [], []
+    for name, png, size in FX_STRIPS:
+        img = Image.open(os.path.join(ASSETS_DIR, png)).convert('RGBA')
+        px = img.load()
+        first = len(words) // 8
+        for f in range(img.width // size):
+            cell = [[index(px[f * size + x, y][:3]) if px[f * size + x, y][3] >= 128 else 0
+                     for x in range(size)] for y in range(size)]
+            for ty in range(size // 8):
+                for tx in range(size // 8):
+                    words += tile_to_4bpp(cell, tx, ty)
+        groups.append((name, first, img.width // size, (size // 8) ** 2))
+    for name, frames in FX_PARTICLES:
+        first = len(words) // 8
+        for art in frames:
+            cell = [[0 if ch == '.' else index(FX_COLOURS[ch]) for ch in line] for line in art]
+            words += tile_to_4bpp(cell, 0, 0)
+        groups.append((name, first, len(frames), 1))
+    if len(colours) > 16:
+        sys.exit(f"fx: {len(colours)} colours, a palette bank holds 16")
+    gba_pal = [rgb_to_gba(*c) for c in colours] + [0] * (16 - len(colours))
+    gba_pal[0] = 0
+
+    with open(os.path.join(OUT_DIR, 'fx.c'), 'w') as f:
+        f.write('// Auto-generated by convert_sprites.py — DO NOT EDIT\n')
+        f.write('#include "fx.h"\n\n')
+        f.write(f'// {", ".join(f"{n} {c}x{t}" for n, _, c, t in groups)} tiles, '
+                f'{len(words) * 4} bytes\n')
+        f.write(f'const unsigned int fxTiles[{len(words)}] __attribute__((aligned(4))) = {{\n')
+        for i in range(0, len(words), 8):
+            f.write('    ' + ','.join(f'0x{w:08X}' for w in words[i:i + 8]) + ',\n')
+        f.write('};\n\n')
+        f.write('const unsigned short fxPal[16] __attribute__((aligned(4))) = {\n    ')
+        f.write(','.join(f'0x{c:04X}' for c in gba_pal))
+        f.write(',\n};\n')
+
+    with open(os.path.join(OUT_DIR, 'fx.h'), 'w') as f:
+        f.write('// Auto-generated by convert_sprites.py — DO NOT EDIT\n')
+        f.write('#ifndef FX_H\n#define FX_H\n\n')
+        for name, first, count, tiles in groups:
+            f.write(f'#define FX_TILE_{name.upper()} {first}\n')
+            f.write(f'#define FX_{name.upper()}_FRAMES {count}\n')
+        f.write(f'\n#define fxTilesLen {len(words) * 4}\n')
+        f.write(f'extern const unsigned int fxTiles[{len(words)}];\n')
+        f.write('extern const unsigned short fxPal[16];\n')
+        f.write('\n#endif // FX_H\n')
+
+    print(f"fx: {len(words) // 8} tiles ({len(words) * 4} bytes), {len(colours) - 1} colours")
+
+
+if __name__ == '__main__':
+    for s in SHEETS:
+        convert(s)
+    convert_fx()